@@ -10,6 +10,14 @@ endif()
 set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${COMPILER_CXX_WARNING_FLAGS}")	# Default compiler flags
 set(CMAKE_EXE_LINKER_FLAGS  "${CMAKE_EXE_LINKER_FLAGS} ${LINKER_CXX_LD_FLAGS}")	# Default linker flags
 
+if(ENABLE_NATIVE_ARCHITECTURE)
+	add_compile_options(${COMPILER_CXX_NATIVE_ARCHITECTURE_FLAGS})	# Not portable to other machines
+endif()
+
+if(SKIP_INNER_VALIDATION)
+	add_compile_definitions(HERD_SKIP_INNER_VALIDATION)	# See Generic/ValidationPolicy.h
+endif()
+
 # Utilities
 
 set(CMAKE_LINK_WHAT_YOU_USE ON)
@@ -53,6 +53,23 @@ if(ENABLE_CODE_COVERAGE)
 	endif()
 endif()
 
+# Profiling counters
+
+if(NOT DEFINED ENABLE_PROFILING)
+	message(FATAL_ERROR "ENABLE_PROFILING not defined")
+endif()
+
+if(ENABLE_PROFILING)
+	set(PROFILING_TARGET ProfilingTarget)
+	herd_add_interface_library(TARGET ${PROFILING_TARGET} INSTALL)
+	
+	target_compile_definitions(${PROFILING_TARGET} INTERFACE HERD_ENABLE_PROFILING)	# See Generic/Profiling.h
+	
+	list(APPEND INSTRUMENTATION_DEPS ${PROFILING_TARGET})
+	
+	message(STATUS "Profiling counters enabled")
+endif()
+
 # Instrumentation target
 set(INSTRUMENTATION_TARGET InstrumentationTarget)
 herd_add_interface_library(TARGET ${INSTRUMENTATION_TARGET} INSTALL
@@ -8,6 +8,8 @@ set(LINKER_CXX_COVERAGE_FLAGS --coverage)
 set(COMPILER_CXX_SANITISER_FLAGS -fno-omit-frame-pointer -fsanitize=address -fsanitize=undefined)	# Sanitiser
 set(LINKER_CXX_SANITISER_FLAGS -fsanitize=address -fsanitize=undefined -static-libasan)	# Sanitiser
 
+set(COMPILER_CXX_NATIVE_ARCHITECTURE_FLAGS -march=native)	# Instruction set of the build machine. Enables the wider SIMD paths in Eigen
+
 #Linker
 #Try LLD. It is faster and actively developed
 find_program(LLD lld)
@@ -0,0 +1,90 @@
+/**
+ * @file BenchmarkUtils.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "BenchmarkUtils.h"
+
+#include <SSE/MainSequence.h>
+#include <SSE/SingleStarEvolution.h>
+
+#include <cmath>
+
+namespace Herd::Benchmarks
+{
+
+/**
+ * @param[in, out] io_rPhase Main sequence computer
+ * @param i_Mass Mass
+ * @param i_Count Number of states
+ * @return States at the midpoints of \c i_Count equal divisions of the main sequence
+ */
+std::vector< Herd::SSE::EvolutionState > GenerateMainSequenceStates( Herd::SSE::MainSequence& io_rPhase, Herd::Generic::Mass i_Mass, std::size_t i_Count )
+{
+  Herd::SSE::EvolutionState zams;
+  zams.m_TrackPoint.m_Mass = i_Mass;
+  io_rPhase.Evolve( zams );  // Initialises the state to ZAMS
+
+  Herd::Generic::Time tMS = io_rPhase.EndsAt();
+
+  std::vector< Herd::SSE::EvolutionState > states;
+  states.reserve( i_Count );
+  for( std::size_t index = 0; index < i_Count; ++index )
+  {
+    Herd::SSE::EvolutionState state = zams;
+    state.m_DeltaT.Set( tMS * ( index + 0.5 ) / i_Count );
+    state.m_TrackPoint.m_Age = state.m_DeltaT;
+    io_rPhase.Evolve( state );
+
+    states.push_back( state );
+  }
+
+  return states;
+}
+
+/**
+ * @param i_Count Number of stars
+ * @return Stars with masses at the quantiles of the Salpeter IMF over SingleStarEvolutuionSpecs::s_EvolvableMassRange
+ * @remarks The masses are deterministic, so that the population is the same across the runs and the platforms
+ */
+std::vector< Herd::SSE::PopulationEvolution::InitialConditions > GeneratePopulation( std::size_t i_Count )
+{
+  const auto& rMassRange = Herd::SSE::SingleStarEvolutuionSpecs::s_EvolvableMassRange;
+
+  // Inverse of the CDF of the IMF
+  double exponent = 1. - s_SalpeterExponent;
+  double lower = std::pow( rMassRange.Lower(), exponent );
+  double upper = std::pow( rMassRange.Upper(), exponent );
+
+  std::vector< Herd::SSE::PopulationEvolution::InitialConditions > population( i_Count );
+  for( std::size_t index = 0; index < i_Count; ++index )
+  {
+    double quantile = ( index + 0.5 ) / i_Count;
+
+    auto& rStar = population[ index ];
+    rStar.m_Mass.Set( std::pow( std::lerp( lower, upper, quantile ), 1. / exponent ) );
+    rStar.m_Z.Set( s_Metallicity );
+    rStar.m_EvolveUntil.Set( s_EvolveUntil );
+  }
+
+  return population;
+}
+
+/**
+ * @param i_ItemsPerIteration Number of items processed in an iteration
+ * @return Counter for the time per item
+ * @remarks The counter reports the inverse of the item rate, i.e. in s. The console output scales it to ns or us
+ */
+benchmark::Counter MakeTimePerItemCounter( double i_ItemsPerIteration )
+{
+  return benchmark::Counter( i_ItemsPerIteration, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert );
+}
+
+}
@@ -0,0 +1,43 @@
+/**
+ * @file BenchmarkUtils.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef HE6AED727_FFB1_478E_AD77_8E0A3D82A84A
+#define HE6AED727_FFB1_478E_AD77_8E0A3D82A84A
+
+#include <Generic/Quantity.h>
+#include <SSE/EvolutionState.h>
+#include <SSE/PopulationEvolution.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace Herd::SSE
+{
+class MainSequence;
+}
+
+namespace Herd::Benchmarks
+{
+
+inline constexpr double s_Metallicity = 0.02; ///< Metallicity for all benchmarks
+inline constexpr double s_EvolveUntil = 13800.; ///< Evolution cut-off in Myr. Age of the universe
+inline constexpr double s_SalpeterExponent = 2.35; ///< Exponent of the Salpeter IMF
+
+std::vector< Herd::SSE::EvolutionState > GenerateMainSequenceStates( Herd::SSE::MainSequence& io_rPhase, Herd::Generic::Mass i_Mass, std::size_t i_Count ); ///< Generates states uniformly spaced over the main sequence
+std::vector< Herd::SSE::PopulationEvolution::InitialConditions > GeneratePopulation( std::size_t i_Count ); ///< Generates a population with a Salpeter IMF
+
+benchmark::Counter MakeTimePerItemCounter( double i_ItemsPerIteration ); ///< Makes a counter that reports the time per item
+}
+
+#endif /* HE6AED727_FFB1_478E_AD77_8E0A3D82A84A */
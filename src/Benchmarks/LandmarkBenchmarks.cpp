@@ -0,0 +1,220 @@
+/**
+ * @file LandmarkBenchmarks.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "BenchmarkUtils.h"
+
+#include <Generic/Quantity.h>
+#include <Generic/QuantityRange.h>
+#include <SSE/Landmarks/BaseOfGiantBranch.h>
+#include <SSE/Landmarks/GiantBranchRadius.h>
+#include <SSE/Landmarks/HeliumIgnition.h>
+#include <SSE/Landmarks/TabulatedLandmark.h>
+#include <SSE/Landmarks/TerminalMainSequence.h>
+#include <SSE/Landmarks/ZeroAgeMainSequence.h>
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+const Herd::Generic::ClosedRange s_MassRange( 0.2, 100. ); ///< Mass range for the landmark evaluations. Valid for all landmarks
+constexpr std::size_t s_MassCount = 256;  ///< Number of masses for the landmark evaluations
+constexpr double s_TableTolerance = 1e-6; ///< Relative error bound for the tabulated landmarks
+
+/**
+ * @return Masses uniformly spaced in \f$ \log_{10} M \f$ over \c s_MassRange
+ * @remarks Consecutive masses differ, so that the single-entry mass caches of the landmarks always miss
+ */
+std::vector< Herd::Generic::Mass > GenerateMasses()
+{
+  double lower = std::log10( s_MassRange.Lower() );
+  double upper = std::log10( s_MassRange.Upper() );
+
+  std::vector< Herd::Generic::Mass > masses;
+  masses.reserve( s_MassCount );
+  for( std::size_t index = 0; index < s_MassCount; ++index )
+  {
+    masses.emplace_back( std::pow( 10., std::lerp( lower, upper, ( index + 0.5 ) / s_MassCount ) ) );
+  }
+
+  return masses;
+}
+
+/**
+ * @brief Construction with an empty metallicity cache
+ * @param io_rState Benchmark state
+ */
+template< class TLandmark >
+void BenchmarkConstruction( benchmark::State& io_rState )
+{
+  Herd::Generic::Metallicity z( 0.5 * Herd::Benchmarks::s_Metallicity ); // Not canonical, so that the coefficients are released with the landmark
+  for( auto _ : io_rState )
+  {
+    TLandmark landmark( z );
+    benchmark::DoNotOptimize( landmark );
+  }
+}
+
+/**
+ * @brief Construction when the metallicity-dependent coefficients are already in the cache
+ * @param io_rState Benchmark state
+ */
+template< class TLandmark >
+void BenchmarkCachedConstruction( benchmark::State& io_rState )
+{
+  Herd::Generic::Metallicity z( Herd::Benchmarks::s_Metallicity );
+  TLandmark warmUp( z );  // Populates the cache
+
+  for( auto _ : io_rState )
+  {
+    TLandmark landmark( z );
+    benchmark::DoNotOptimize( landmark );
+  }
+}
+
+/**
+ * @brief Evaluates the age, luminosity and radius over a range of masses
+ * @param io_rState Benchmark state
+ * @param io_rLandmark Landmark
+ */
+void EvaluateLandmark( benchmark::State& io_rState, Herd::SSE::ILandmark& io_rLandmark )
+{
+  auto masses = GenerateMasses();
+  for( auto _ : io_rState )
+  {
+    for( auto mass : masses )
+    {
+      benchmark::DoNotOptimize( io_rLandmark.Age( mass ) );
+      benchmark::DoNotOptimize( io_rLandmark.Luminosity( mass ) );
+      benchmark::DoNotOptimize( io_rLandmark.Radius( mass ) );
+    }
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * masses.size() );
+}
+
+/**
+ * @brief Evaluates the age, luminosity and radius over a range of masses, in one call per mass
+ * @param io_rState Benchmark state
+ * @param io_rLandmark Landmark
+ */
+void EvaluateLandmarkFused( benchmark::State& io_rState, Herd::SSE::ILandmark& io_rLandmark )
+{
+  auto masses = GenerateMasses();
+  for( auto _ : io_rState )
+  {
+    for( auto mass : masses )
+    {
+      benchmark::DoNotOptimize( io_rLandmark.Evaluate( mass ) );
+    }
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * masses.size() );
+}
+
+/**
+ * @brief Evaluation of the analytic landmark functions
+ * @param io_rState Benchmark state
+ */
+template< class TLandmark >
+void BenchmarkEvaluation( benchmark::State& io_rState )
+{
+  TLandmark landmark( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) );
+  EvaluateLandmark( io_rState, landmark );
+}
+
+/**
+ * @brief Fused evaluation of the analytic landmark functions. Only ZAMS and TMS share intermediates between the quantities
+ * @param io_rState Benchmark state
+ */
+template< class TLandmark >
+void BenchmarkFusedEvaluation( benchmark::State& io_rState )
+{
+  TLandmark landmark( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) );
+  EvaluateLandmarkFused( io_rState, landmark );
+}
+
+/**
+ * @brief Evaluation of the tabulated landmark functions
+ * @param io_rState Benchmark state
+ */
+template< class TLandmark >
+void BenchmarkTabulatedEvaluation( benchmark::State& io_rState )
+{
+  Herd::SSE::TabulatedLandmark landmark( std::make_unique< TLandmark >( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) ), s_MassRange,
+      s_TableTolerance );
+  EvaluateLandmark( io_rState, landmark );
+}
+
+/**
+ * @brief Evaluation of the giant branch radius
+ * @param io_rState Benchmark state
+ */
+void BenchmarkGiantBranchRadius( benchmark::State& io_rState )
+{
+  Herd::SSE::GiantBranchRadius computer( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) );
+  Herd::SSE::ZeroAgeMainSequence zams( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) );
+
+  auto masses = GenerateMasses();
+  std::vector< Herd::Generic::Luminosity > luminosities;
+  luminosities.reserve( masses.size() );
+  for( auto mass : masses )
+  {
+    luminosities.push_back( Herd::Generic::Luminosity( 10. * zams.Luminosity( mass ) ) );
+  }
+
+  for( auto _ : io_rState )
+  {
+    for( std::size_t index = 0; index < masses.size(); ++index )
+    {
+      benchmark::DoNotOptimize( computer.Compute( masses[ index ], luminosities[ index ] ) );
+    }
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * masses.size() );
+}
+
+}
+
+// @formatter:off
+BENCHMARK_TEMPLATE( BenchmarkConstruction, Herd::SSE::ZeroAgeMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkConstruction, Herd::SSE::TerminalMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkConstruction, Herd::SSE::BaseOfGiantBranch );
+BENCHMARK_TEMPLATE( BenchmarkConstruction, Herd::SSE::HeliumIgnition );
+BENCHMARK_TEMPLATE( BenchmarkConstruction, Herd::SSE::GiantBranchRadius );
+
+BENCHMARK_TEMPLATE( BenchmarkCachedConstruction, Herd::SSE::ZeroAgeMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkCachedConstruction, Herd::SSE::TerminalMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkCachedConstruction, Herd::SSE::BaseOfGiantBranch );
+BENCHMARK_TEMPLATE( BenchmarkCachedConstruction, Herd::SSE::HeliumIgnition );
+BENCHMARK_TEMPLATE( BenchmarkCachedConstruction, Herd::SSE::GiantBranchRadius );
+
+BENCHMARK_TEMPLATE( BenchmarkEvaluation, Herd::SSE::ZeroAgeMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkEvaluation, Herd::SSE::TerminalMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkEvaluation, Herd::SSE::BaseOfGiantBranch );
+BENCHMARK_TEMPLATE( BenchmarkEvaluation, Herd::SSE::HeliumIgnition );
+
+BENCHMARK_TEMPLATE( BenchmarkFusedEvaluation, Herd::SSE::ZeroAgeMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkFusedEvaluation, Herd::SSE::TerminalMainSequence );
+
+BENCHMARK_TEMPLATE( BenchmarkTabulatedEvaluation, Herd::SSE::ZeroAgeMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkTabulatedEvaluation, Herd::SSE::TerminalMainSequence );
+BENCHMARK_TEMPLATE( BenchmarkTabulatedEvaluation, Herd::SSE::BaseOfGiantBranch );
+BENCHMARK_TEMPLATE( BenchmarkTabulatedEvaluation, Herd::SSE::HeliumIgnition );
+
+BENCHMARK( BenchmarkGiantBranchRadius );
+// @formatter:on
@@ -0,0 +1,68 @@
+/**
+ * @file PopulationBenchmarks.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "BenchmarkUtils.h"
+
+#include <SSE/PopulationEvolution.h>
+#include <SSE/SingleStarEvolution.h>
+#include <SSE/TrackPoint.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+constexpr std::size_t s_PopulationSize = 1000; ///< Number of stars in the population
+
+/**
+ * @brief Evolves a fixed population, sampled from the Salpeter IMF
+ * @param io_rState Benchmark state. The argument is the number of threads
+ * @remarks Reports stars/s as the item rate, and the time per timestep
+ */
+void BenchmarkPopulationEvolve( benchmark::State& io_rState )
+{
+  auto population = Herd::Benchmarks::GeneratePopulation( s_PopulationSize );
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  // Total number of timesteps in the population. Deterministic, so computed once, outside of the timed region
+  std::size_t timestepCount = 0;
+  Herd::SSE::SingleStarEvolutuion simulator;
+  for( const auto& rStar : population )
+  {
+    simulator.Evolve( rStar.m_Mass, rStar.m_Z, rStar.m_EvolveUntil, parameters );
+    timestepCount += simulator.TimestepStatistics().Total().m_AcceptedSteps; // Independent of the output policy
+  }
+
+  Herd::SSE::PopulationEvolution evolution( io_rState.range( 0 ) );
+  std::vector< Herd::SSE::TrackPoint > finalStates( population.size() );
+  for( auto _ : io_rState )
+  {
+    evolution.Evolve( population, parameters, finalStates );
+    benchmark::DoNotOptimize( finalStates.data() );
+    benchmark::ClobberMemory();
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * population.size() );
+  io_rState.counters[ "timesteps" ] = timestepCount;
+  io_rState.counters[ "time_per_timestep" ] = Herd::Benchmarks::MakeTimePerItemCounter( timestepCount );
+}
+
+}
+
+// @formatter:off
+BENCHMARK( BenchmarkPopulationEvolve )->Arg( 1 )->Arg( std::max( 1u, std::thread::hardware_concurrency() ) )->Unit( benchmark::kMillisecond )->UseRealTime();
+// @formatter:on
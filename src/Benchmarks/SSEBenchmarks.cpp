@@ -0,0 +1,137 @@
+/**
+ * @file SSEBenchmarks.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "BenchmarkUtils.h"
+
+#include <Generic/Quantity.h>
+#include <SSE/ConvectiveEnvelope.h>
+#include <SSE/EvolutionState.h>
+#include <SSE/MainSequence.h>
+#include <SSE/SingleStarEvolution.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+namespace
+{
+
+constexpr std::size_t s_StateCount = 64;  ///< Number of main sequence states per benchmark iteration
+
+/**
+ * @brief MainSequence::Evolve over the main sequence of a star
+ * @param io_rState Benchmark state. The argument is the mass in \f$ M_{\odot} \f$
+ */
+void BenchmarkMainSequenceEvolve( benchmark::State& io_rState )
+{
+  Herd::Generic::Mass mass( io_rState.range( 0 ) );
+  Herd::SSE::MainSequence phase( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) );
+  auto states = Herd::Benchmarks::GenerateMainSequenceStates( phase, mass, s_StateCount );
+
+  // A short step from each state
+  Herd::Generic::Time deltaT( 1e-3 * phase.EndsAt() );
+  for( auto& rState : states )
+  {
+    rState.m_DeltaT = deltaT;
+  }
+
+  for( auto _ : io_rState )
+  {
+    for( const auto& rState : states )
+    {
+      Herd::SSE::EvolutionState state = rState;
+      benchmark::DoNotOptimize( phase.Evolve( state ) );
+      benchmark::DoNotOptimize( state );
+    }
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * states.size() );
+}
+
+/**
+ * @brief ConvectiveEnvelope::Compute over the main sequence of a star
+ * @param io_rState Benchmark state. The argument is the mass in \f$ M_{\odot} \f$
+ */
+void BenchmarkConvectiveEnvelopeCompute( benchmark::State& io_rState )
+{
+  Herd::Generic::Mass mass( io_rState.range( 0 ) );
+  Herd::Generic::Metallicity z( Herd::Benchmarks::s_Metallicity );
+  Herd::SSE::MainSequence phase( z );
+  Herd::SSE::ConvectiveEnvelope computer( mass, z );
+  auto states = Herd::Benchmarks::GenerateMainSequenceStates( phase, mass, s_StateCount );
+
+  for( auto _ : io_rState )
+  {
+    for( const auto& rState : states )
+    {
+      benchmark::DoNotOptimize( computer.Compute( rState ) );
+    }
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * states.size() );
+}
+
+/**
+ * @brief SingleStarEvolutuion::ComputeTimestep over the main sequence of a star
+ * @param io_rState Benchmark state. The argument is the mass in \f$ M_{\odot} \f$
+ */
+void BenchmarkComputeTimestep( benchmark::State& io_rState )
+{
+  Herd::Generic::Mass mass( io_rState.range( 0 ) );
+  Herd::SSE::MainSequence phase( Herd::Generic::Metallicity( Herd::Benchmarks::s_Metallicity ) );
+  auto states = Herd::Benchmarks::GenerateMainSequenceStates( phase, mass, s_StateCount );
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+  Herd::Generic::Time evolveUntil( Herd::Benchmarks::s_EvolveUntil );
+
+  for( auto _ : io_rState )
+  {
+    for( const auto& rState : states )
+    {
+      benchmark::DoNotOptimize( Herd::SSE::SingleStarEvolutuion::ComputeTimestep( phase, rState, parameters, evolveUntil ) );
+    }
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() * states.size() );
+}
+
+/**
+ * @brief SingleStarEvolutuion::Evolve for a star
+ * @param io_rState Benchmark state. The argument is the mass in \f$ M_{\odot} \f$
+ */
+void BenchmarkSingleStarEvolve( benchmark::State& io_rState )
+{
+  Herd::Generic::Mass mass( io_rState.range( 0 ) );
+  Herd::Generic::Metallicity z( Herd::Benchmarks::s_Metallicity );
+  Herd::Generic::Time evolveUntil( Herd::Benchmarks::s_EvolveUntil );
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  Herd::SSE::SingleStarEvolutuion simulator;
+  for( auto _ : io_rState )
+  {
+    simulator.Evolve( mass, z, evolveUntil, parameters );
+    benchmark::DoNotOptimize( simulator.Trajectory().size() );
+  }
+
+  io_rState.SetItemsProcessed( io_rState.iterations() );
+  io_rState.counters[ "time_per_timestep" ] = Herd::Benchmarks::MakeTimePerItemCounter( simulator.Trajectory().size() );
+}
+
+}
+
+// @formatter:off
+BENCHMARK( BenchmarkMainSequenceEvolve )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Arg( 64 );
+BENCHMARK( BenchmarkConvectiveEnvelopeCompute )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Arg( 64 );
+BENCHMARK( BenchmarkComputeTimestep )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Arg( 64 );
+BENCHMARK( BenchmarkSingleStarEvolve )->Arg( 1 )->Arg( 4 )->Arg( 16 )->Arg( 64 );
+// @formatter:on
@@ -40,6 +40,15 @@ void ThrowPreconditionError( const char* i_pElement, const char* i_pExpected, do
   throw( Herd::Exceptions::PreconditionError( i_pElement, i_pExpected, i_Actual ) ); // @suppress("Symbol is not resolved")
 }
 
+/**
+ * @param i_pMessage Exception message
+ * @throws RuntimeError
+ */
+void ThrowRuntimeError( const char* i_pMessage )
+{
+  throw( Herd::Exceptions::RuntimeError( i_pMessage ) );
+}
+
 /**
  * @brief Throws if value is negative
  * @param i_Value Value to be tested
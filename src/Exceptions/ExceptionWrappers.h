@@ -20,6 +20,7 @@ namespace Herd::Exceptions
 
 [[noreturn]] void ThrowPreconditionError( const char* i_pElement, const char* i_pExpected, const char* i_pActual ); ///< Wrapper for PreconditionError
 [[noreturn]] void ThrowPreconditionError( const char* i_pElement, const char* i_pExpected, double i_Actual ); ///< Wrapper for PreconditionError
+[[noreturn]] void ThrowRuntimeError( const char* i_pMessage ); ///< Wrapper for RuntimeError
 
 // gcc warning for [[noreturn]], the functions appear to return
 void ThrowPreconditionErrorIfNegative( double i_Value, const char* i_pName );  ///< Wrapper for Precondition error with condition check
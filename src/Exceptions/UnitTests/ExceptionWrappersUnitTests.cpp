@@ -19,6 +19,7 @@
 
 #include <Exceptions/ExceptionWrappers.h>
 #include <Exceptions/PreconditionError.h>
+#include <Exceptions/RuntimeError.h>
 
 BOOST_FIXTURE_TEST_SUITE( ExceptionWrappersTestSuite, Herd::UnitTestUtils::RandomTestFixture, *Herd::UnitTestUtils::Labels::s_Compile )
 
@@ -26,6 +27,7 @@ BOOST_AUTO_TEST_CASE( TestExceptionWrappers )
 {
   BOOST_CHECK_THROW( Herd::Exceptions::ThrowPreconditionError( "Bad", "Good", "BadString" ), Herd::Exceptions::PreconditionError );
   BOOST_CHECK_THROW( Herd::Exceptions::ThrowPreconditionError( "Bad", "Good", 0. ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::Exceptions::ThrowRuntimeError( "Failure" ), Herd::Exceptions::RuntimeError );
 
   {
     double value = GenerateNumber( -10., -1. ); // @suppress("Invalid arguments")
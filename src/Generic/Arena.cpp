@@ -0,0 +1,120 @@
+/**
+ * @file Arena.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "Arena.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace Herd::Generic
+{
+
+/**
+ * @param i_InitialSize Size of the first block, in bytes
+ * @pre \c i_InitialSize>0
+ * @throws PreconditionError If the precondition is violated
+ */
+Arena::Arena( std::size_t i_InitialSize )
+{
+  if( i_InitialSize == 0 )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_InitialSize", ">0", i_InitialSize );
+  }
+
+  AddBlock( i_InitialSize );
+}
+
+/**
+ * @remarks The objects allocated from the arena must be destroyed before the call
+ */
+void Arena::Reset()
+{
+  if( m_Blocks.size() > 1 )
+  {
+    std::size_t capacity = Capacity();
+    m_Blocks.clear();
+    AddBlock( capacity );
+  }
+
+  m_Offset = 0;
+}
+
+/**
+ * @return Total size of the blocks, in bytes
+ */
+std::size_t Arena::Capacity() const
+{
+  std::size_t output = 0;
+  for( const auto& rBlock : m_Blocks )
+  {
+    output += rBlock.m_Size;
+  }
+
+  return output;
+}
+
+/**
+ * @return Number of blocks. 1 if the allocations since the last reset fit into the first block
+ */
+std::size_t Arena::BlockCount() const
+{
+  return m_Blocks.size();
+}
+
+/**
+ * @param i_Bytes Size of the allocation
+ * @param i_Alignment Alignment of the allocation
+ * @return Pointer to the allocated memory
+ * @remarks If the current block does not have enough space, a new block at least twice the size is added
+ */
+void* Arena::do_allocate( std::size_t i_Bytes, std::size_t i_Alignment )
+{
+  void* pMemory = m_Blocks.back().m_pMemory.get() + m_Offset;
+  std::size_t space = m_Blocks.back().m_Size - m_Offset;
+  if( !std::align( i_Alignment, i_Bytes, pMemory, space ) )
+  {
+    [[unlikely]] AddBlock( std::max( 2 * m_Blocks.back().m_Size, i_Bytes + i_Alignment ) );
+
+    pMemory = m_Blocks.back().m_pMemory.get();
+    space = m_Blocks.back().m_Size;
+    std::align( i_Alignment, i_Bytes, pMemory, space ); // Always fits
+  }
+
+  m_Offset = m_Blocks.back().m_Size - space + i_Bytes;
+  return pMemory;
+}
+
+void Arena::do_deallocate( [[maybe_unused]] void* i_pMemory, [[maybe_unused]] std::size_t i_Bytes, [[maybe_unused]] std::size_t i_Alignment )
+{
+}
+
+/**
+ * @param i_rOther Other resource
+ * @return \c true if \c i_rOther is this object
+ */
+bool Arena::do_is_equal( const std::pmr::memory_resource& i_rOther ) const noexcept
+{
+  return this == &i_rOther;
+}
+
+/**
+ * @param i_Size Size of the block, in bytes
+ */
+void Arena::AddBlock( std::size_t i_Size )
+{
+  m_Blocks.push_back( Block { std::make_unique_for_overwrite< std::byte[] >( i_Size ), i_Size } );
+  m_Offset = 0;
+}
+
+}
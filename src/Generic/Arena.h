@@ -0,0 +1,126 @@
+/**
+ * @file Arena.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H6C0F2A91_3D5B_4E87_A1C4_9B72E05D3F68
+#define H6C0F2A91_3D5B_4E87_A1C4_9B72E05D3F68
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace Herd::Generic
+{
+
+/**
+ * @brief Monotonic memory resource that retains its memory when reset
+ * @remarks Allocation is a pointer increment, and deallocation does nothing. The memory is reclaimed in bulk by Reset
+ * @remarks After a reset, the blocks are merged into one, so that a workload of the same size is served without touching the upstream allocator
+ * @remarks Not thread-safe. Intended to be owned by a thread, e.g. one per worker of a population
+ */
+class Arena final : public std::pmr::memory_resource
+{
+public:
+
+  explicit Arena( std::size_t i_InitialSize = 4096 ); ///< Constructor
+
+  Arena( const Arena& ) = delete; ///< Deleted copy constructor
+  Arena& operator=( const Arena& ) = delete; ///< Deleted copy assignment
+
+  void Reset(); ///< Makes the entire memory available again
+
+  std::size_t Capacity() const; ///< Total size of the blocks
+  std::size_t BlockCount() const; ///< Number of blocks
+
+private:
+
+  void* do_allocate( std::size_t i_Bytes, std::size_t i_Alignment ) override; ///< Allocates memory
+  void do_deallocate( void* i_pMemory, std::size_t i_Bytes, std::size_t i_Alignment ) override; ///< Does nothing
+  bool do_is_equal( const std::pmr::memory_resource& i_rOther ) const noexcept override; ///< Whether the memory can be deallocated by another resource
+
+  void AddBlock( std::size_t i_Size ); ///< Allocates a new block, and makes it the current block
+
+  /**
+   * @brief A contiguous block of memory
+   */
+  struct Block
+  {
+    std::unique_ptr< std::byte[] > m_pMemory; ///< Memory
+    std::size_t m_Size; ///< Size in bytes
+  };
+
+  std::vector< Block > m_Blocks; ///< Blocks. Only the last one has free space
+  std::size_t m_Offset = 0; ///< Offset of the first free byte in the last block
+};
+
+/**
+ * @brief Destroys an object created by MakeArenaPtr, and returns its memory to the resource
+ * @tparam T Type of the object. Must be the dynamic type
+ */
+template< class T >
+class ArenaDeleter
+{
+public:
+
+  /**
+   * @param io_pResource Resource, from which the object is allocated
+   */
+  explicit ArenaDeleter( std::pmr::memory_resource* io_pResource = std::pmr::get_default_resource() ) :
+      m_pResource( io_pResource )
+  {
+  }
+
+  /**
+   * @param io_pObject Object to be deleted
+   */
+  void operator()( T* io_pObject ) const
+  {
+    io_pObject->~T();
+    m_pResource->deallocate( io_pObject, sizeof(T), alignof(T) );
+  }
+
+private:
+
+  std::pmr::memory_resource* m_pResource; ///< Resource, from which the object is allocated
+};
+
+/**
+ * @brief Owning pointer to an object allocated from a memory resource
+ */
+template< class T >
+using ArenaPtr = std::unique_ptr< T, ArenaDeleter< T > >;
+
+/**
+ * @param io_pResource Resource, from which the object is allocated
+ * @param i_rArguments Constructor arguments
+ * @return Owning pointer to the new object
+ * @tparam T Type of the object
+ * @remarks The counterpart of \c std::make_unique for a memory resource. The resource must outlive the object
+ */
+template< class T, class ... TArguments >
+ArenaPtr< T > MakeArenaPtr( std::pmr::memory_resource* io_pResource, TArguments&&... i_rArguments )
+{
+  void* pMemory = io_pResource->allocate( sizeof(T), alignof(T) );
+  try
+  {
+    return ArenaPtr< T >( new ( pMemory ) T( std::forward< TArguments >( i_rArguments )... ), ArenaDeleter< T >( io_pResource ) );
+  } catch( ... )
+  {
+    io_pResource->deallocate( pMemory, sizeof(T), alignof(T) );
+    throw;
+  }
+}
+
+}
+
+#endif /* H6C0F2A91_3D5B_4E87_A1C4_9B72E05D3F68 */
@@ -0,0 +1,164 @@
+/**
+ * @file MonotoneCubicInterpolator.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "MonotoneCubicInterpolator.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iterator>
+#include <utility>
+
+namespace Herd::Generic
+{
+
+/**
+ * @param i_X Knots
+ * @param i_Y Values at the knots
+ * @pre \c i_X has at least 2 elements
+ * @pre \c i_X is strictly increasing
+ * @pre \c i_Y has the same size as \c i_X
+ * @throws PreconditionError If any preconditions are violated
+ */
+MonotoneCubicInterpolator::MonotoneCubicInterpolator( std::vector< double > i_X, std::vector< double > i_Y ) :
+    m_X( std::move( i_X ) ), m_Y( std::move( i_Y ) )
+{
+  if( m_X.size() < 2 )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_X.size()", ">=2", m_X.size() );
+  }
+
+  if( m_Y.size() != m_X.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Y.size()", "Same as i_X.size()", m_Y.size() );
+  }
+
+  if( std::adjacent_find( m_X.begin(), m_X.end(), std::greater_equal<>() ) != m_X.end() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_X", "Strictly increasing", "Not strictly increasing" );
+  }
+
+  ComputeSlopes();
+}
+
+/**
+ * @param i_X Query point
+ * @return Interpolated value
+ * @pre \c i_X is within [Lower(), Upper()]
+ * @throws PreconditionError If the precondition is violated
+ */
+double MonotoneCubicInterpolator::operator()( double i_X ) const
+{
+  if( !( i_X >= m_X.front() && i_X <= m_X.back() ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_X", "Within [Lower(), Upper()]", i_X );
+  }
+
+  // Index of the interval. The last knot belongs to the last interval
+  std::size_t index = std::distance( m_X.begin(), std::upper_bound( m_X.begin(), std::prev( m_X.end() ), i_X ) ) - 1;
+
+  double h = m_X[ index + 1 ] - m_X[ index ];
+  double t = ( i_X - m_X[ index ] ) / h;
+  double t2 = t * t;
+  double t3 = t2 * t;
+
+  // Cubic Hermite basis
+  double h00 = 2. * t3 - 3. * t2 + 1.;
+  double h10 = t3 - 2. * t2 + t;
+  double h01 = -2. * t3 + 3. * t2;
+  double h11 = t3 - t2;
+
+  return h00 * m_Y[ index ] + h10 * h * m_Slopes[ index ] + h01 * m_Y[ index + 1 ] + h11 * h * m_Slopes[ index + 1 ];
+}
+
+/**
+ * @return First knot
+ */
+double MonotoneCubicInterpolator::Lower() const
+{
+  return m_X.front();
+}
+
+/**
+ * @return Last knot
+ */
+double MonotoneCubicInterpolator::Upper() const
+{
+  return m_X.back();
+}
+
+/**
+ * @return Number of knots
+ */
+std::size_t MonotoneCubicInterpolator::KnotCount() const
+{
+  return m_X.size();
+}
+
+void MonotoneCubicInterpolator::ComputeSlopes()
+{
+  std::size_t knotCount = m_X.size();
+
+  std::vector< double > h( knotCount - 1 );  // Interval widths
+  std::vector< double > delta( knotCount - 1 ); // Slopes of the secants
+  for( std::size_t index = 0; index + 1 < knotCount; ++index )
+  {
+    h[ index ] = m_X[ index + 1 ] - m_X[ index ];
+    delta[ index ] = ( m_Y[ index + 1 ] - m_Y[ index ] ) / h[ index ];
+  }
+
+  m_Slopes.assign( knotCount, 0. );
+
+  // Two knots: linear interpolation
+  if( knotCount == 2 )
+  {
+    m_Slopes[ 0 ] = delta[ 0 ];
+    m_Slopes[ 1 ] = delta[ 0 ];
+    return;
+  }
+
+  // Interior knots: weighted harmonic mean. 0 at a local extremum
+  for( std::size_t index = 1; index + 1 < knotCount; ++index )
+  {
+    if( delta[ index - 1 ] * delta[ index ] > 0. )
+    {
+      double w1 = 2. * h[ index ] + h[ index - 1 ];
+      double w2 = h[ index ] + 2. * h[ index - 1 ];
+      m_Slopes[ index ] = ( w1 + w2 ) / ( w1 / delta[ index - 1 ] + w2 / delta[ index ] );
+    }
+  }
+
+  // End knots: shape-preserving three-point estimate
+  auto ComputeEndSlope = []( double i_H0, double i_H1, double i_Delta0, double i_Delta1 )
+  {
+    double slope = ( ( 2. * i_H0 + i_H1 ) * i_Delta0 - i_H0 * i_Delta1 ) / ( i_H0 + i_H1 );
+
+    if( std::signbit( slope ) != std::signbit( i_Delta0 ) || i_Delta0 == 0. )
+    {
+      return 0.;
+    }
+
+    if( std::signbit( i_Delta0 ) != std::signbit( i_Delta1 ) && std::abs( slope ) > std::abs( 3. * i_Delta0 ) )
+    {
+      return 3. * i_Delta0;
+    }
+
+    return slope;
+  };
+
+  m_Slopes.front() = ComputeEndSlope( h[ 0 ], h[ 1 ], delta[ 0 ], delta[ 1 ] );
+  m_Slopes.back() = ComputeEndSlope( h[ knotCount - 2 ], h[ knotCount - 3 ], delta[ knotCount - 2 ], delta[ knotCount - 3 ] );
+}
+
+}
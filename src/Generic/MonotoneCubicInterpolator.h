@@ -0,0 +1,50 @@
+/**
+ * @file MonotoneCubicInterpolator.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H13EFB74E_1B8C_4B2F_860A_44CC6D16B3DF
+#define H13EFB74E_1B8C_4B2F_860A_44CC6D16B3DF
+
+#include <cstddef>
+#include <vector>
+
+namespace Herd::Generic
+{
+
+/**
+ * @brief Piecewise cubic Hermite interpolation that preserves the monotonicity of the data
+ * @remarks The slopes at the knots are the weighted harmonic mean of the slopes of the neighbouring intervals, and 0 at local extrema
+ * @cite Fritsch84
+ */
+class MonotoneCubicInterpolator
+{
+public:
+
+  MonotoneCubicInterpolator( std::vector< double > i_X, std::vector< double > i_Y ); ///< Constructor
+
+  double operator()( double i_X ) const; ///< Interpolates at a point
+
+  double Lower() const; ///< Smallest knot
+  double Upper() const; ///< Largest knot
+
+  std::size_t KnotCount() const; ///< Number of knots
+
+private:
+
+  void ComputeSlopes(); ///< Computes the slopes at the knots
+
+  std::vector< double > m_X; ///< Knots
+  std::vector< double > m_Y; ///< Values at the knots
+  std::vector< double > m_Slopes; ///< Slopes at the knots
+};
+}
+
+#endif /* H13EFB74E_1B8C_4B2F_860A_44CC6D16B3DF */
@@ -0,0 +1,182 @@
+/**
+ * @file Profiling.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "Profiling.h"
+
+#if defined( __x86_64__ ) || defined( __i386__ )
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+
+namespace
+{
+
+/**
+ * @return Current value of the cycle counter
+ * @remarks The time stamp counter on x86, a monotonic clock in nanoseconds elsewhere
+ */
+uint64_t ReadCycleCounter()
+{
+#if defined( __x86_64__ ) || defined( __i386__ )
+  return __rdtsc();
+#else
+  return std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now().time_since_epoch() ).count();
+#endif
+}
+
+}
+
+namespace Herd::Generic
+{
+
+/**
+ * @param i_rOther Counter to be added
+ * @return A reference to this object
+ */
+ProfilingCounter& ProfilingCounter::operator+=( const ProfilingCounter& i_rOther )
+{
+  m_Calls += i_rOther.m_Calls;
+  m_Cycles += i_rOther.m_Cycles;
+  return *this;
+}
+
+/**
+ * @param i_rOther Counter to be subtracted
+ * @return A reference to this object
+ */
+ProfilingCounter& ProfilingCounter::operator-=( const ProfilingCounter& i_rOther )
+{
+  m_Calls -= i_rOther.m_Calls;
+  m_Cycles -= i_rOther.m_Cycles;
+  return *this;
+}
+
+/**
+ * @param i_Function Profiled function
+ * @return A reference to the counter for \c i_Function
+ * @pre \c i_Function is not \c e_Count
+ */
+ProfilingCounter& ProfilingReport::operator[]( ProfiledFunction i_Function )
+{
+  return m_Counters[ static_cast< std::size_t >( i_Function ) ];
+}
+
+/**
+ * @param i_Function Profiled function
+ * @return A constant reference to the counter for \c i_Function
+ * @pre \c i_Function is not \c e_Count
+ */
+const ProfilingCounter& ProfilingReport::operator[]( ProfiledFunction i_Function ) const
+{
+  return m_Counters[ static_cast< std::size_t >( i_Function ) ];
+}
+
+/**
+ * @param i_rOther Report to be added
+ * @return A reference to this object
+ */
+ProfilingReport& ProfilingReport::operator+=( const ProfilingReport& i_rOther )
+{
+  for( std::size_t index = 0; index < m_Counters.size(); ++index )
+  {
+    m_Counters[ index ] += i_rOther.m_Counters[ index ];
+  }
+
+  return *this;
+}
+
+/**
+ * @param i_rOther Report to be subtracted
+ * @return A reference to this object
+ */
+ProfilingReport& ProfilingReport::operator-=( const ProfilingReport& i_rOther )
+{
+  for( std::size_t index = 0; index < m_Counters.size(); ++index )
+  {
+    m_Counters[ index ] -= i_rOther.m_Counters[ index ];
+  }
+
+  return *this;
+}
+
+void ProfilingReport::Reset()
+{
+  m_Counters.fill( ProfilingCounter() );
+}
+
+/**
+ * @param i_Function Profiled function
+ * @return Name of \c i_Function. Empty for \c e_Count
+ */
+std::string_view ProfilingReport::Name( ProfiledFunction i_Function )
+{
+  switch( i_Function )
+  {
+    case ProfiledFunction::e_MainSequenceEvolve:
+      return "MainSequence::Evolve";
+    case ProfiledFunction::e_LandmarkAge:
+      return "ILandmark::Age";
+    case ProfiledFunction::e_LandmarkLuminosity:
+      return "ILandmark::Luminosity";
+    case ProfiledFunction::e_LandmarkRadius:
+      return "ILandmark::Radius";
+    case ProfiledFunction::e_LandmarkEvaluate:
+      return "ILandmark::Evaluate";
+    case ProfiledFunction::e_ConvectiveEnvelope:
+      return "ConvectiveEnvelope::Compute";
+    case ProfiledFunction::e_StellarWind:
+      return "StellarWindMassLoss::Compute";
+    case ProfiledFunction::e_RotationInitialise:
+      return "StellarRotation::Initialise";
+    case ProfiledFunction::e_RotationLossRate:
+      return "StellarRotation::ComputeAngularMomentumLossRate";
+    case ProfiledFunction::e_RotationAngularVelocity:
+      return "StellarRotation::ComputeAngularVelocity";
+    case ProfiledFunction::e_TimestepTrial:
+      return "SingleStarEvolutuion::ComputeTimestep trial";
+    case ProfiledFunction::e_Count:
+      break;
+  }
+
+  return {};
+}
+
+/**
+ * @return A reference to the report of the calling thread
+ * @remarks The report lives as long as the thread. To attribute the counts to a piece of work, take a copy before it, and subtract it afterwards
+ */
+ProfilingReport& ProfilingReport::ThreadReport()
+{
+  thread_local ProfilingReport report;
+  return report;
+}
+
+/**
+ * @param i_Function Profiled function
+ */
+ActiveProfilingScope::ActiveProfilingScope( ProfiledFunction i_Function ) :
+    m_Function( i_Function ), m_Start( ReadCycleCounter() )
+{
+}
+
+/**
+ * @remarks Updates the counter of the profiled function in the report of the calling thread
+ */
+ActiveProfilingScope::~ActiveProfilingScope()
+{
+  ProfilingCounter& rCounter = ProfilingReport::ThreadReport()[ m_Function ];
+  ++rCounter.m_Calls;
+  rCounter.m_Cycles += ReadCycleCounter() - m_Start;
+}
+
+}
@@ -0,0 +1,133 @@
+/**
+ * @file Profiling.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H2A7E4C19_6B3D_4F08_9C51_D0E83B6F7A24
+#define H2A7E4C19_6B3D_4F08_9C51_D0E83B6F7A24
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace Herd::Generic
+{
+
+/**
+ * @brief Functions on the hot path of the evolution loop, for which the profiling counters are kept
+ */
+enum class ProfiledFunction
+{
+  e_MainSequenceEvolve, // MainSequence::Evolve
+  e_LandmarkAge,  // ILandmark::Age, over all landmarks
+  e_LandmarkLuminosity, // ILandmark::Luminosity, over all landmarks
+  e_LandmarkRadius, // ILandmark::Radius, over all landmarks
+  e_LandmarkEvaluate, // ILandmark::Evaluate, over all landmarks, and TerminalMainSequence::EvaluateWithTHook
+  e_ConvectiveEnvelope, // ConvectiveEnvelope::Compute
+  e_StellarWind,  // StellarWindMassLoss::Compute
+  e_RotationInitialise, // StellarRotation::InitialiseAtZAMS and StellarRotation::InitialiseAtNSOrBH
+  e_RotationLossRate, // StellarRotation::ComputeAngularMomentumLossRate
+  e_RotationAngularVelocity,  // StellarRotation::ComputeAngularVelocity
+  e_TimestepTrial,  // An iteration of the trial loop in SingleStarEvolutuion::ComputeTimestep
+  e_Count // Number of profiled functions
+};
+
+/**
+ * @brief If \c true, the profiling counters are updated
+ * @remarks \c true if the CMake option \c ENABLE_PROFILING is on. Otherwise, ProfilingScope compiles to nothing
+ */
+#ifdef HERD_ENABLE_PROFILING
+inline constexpr bool s_IsProfilingEnabled = true;
+#else
+inline constexpr bool s_IsProfilingEnabled = false;
+#endif
+
+/**
+ * @brief Call count and time spent in a function
+ */
+struct ProfilingCounter
+{
+  uint64_t m_Calls = 0; ///< Number of calls
+  uint64_t m_Cycles = 0; ///< Time spent in the calls, including the nested profiled functions. Time stamp counter ticks on x86, nanoseconds elsewhere
+
+  ProfilingCounter& operator+=( const ProfilingCounter& i_rOther ); ///< Accumulates another counter
+  ProfilingCounter& operator-=( const ProfilingCounter& i_rOther ); ///< Removes the counts of another counter
+};
+
+/**
+ * @brief Profiling counters for each ProfiledFunction
+ * @remarks Each thread updates its own report, so the counters need no synchronisation. Reports of different threads are combined with \c +=
+ */
+class ProfilingReport
+{
+public:
+
+  Herd::Generic::ProfilingCounter& operator[]( Herd::Generic::ProfiledFunction i_Function ); ///< Element access
+  const Herd::Generic::ProfilingCounter& operator[]( Herd::Generic::ProfiledFunction i_Function ) const; ///< Element access
+
+  ProfilingReport& operator+=( const ProfilingReport& i_rOther ); ///< Accumulates another report
+  ProfilingReport& operator-=( const ProfilingReport& i_rOther ); ///< Removes the counts of another report, e.g. an earlier snapshot
+
+  void Reset(); ///< Sets all counters to zero
+
+  static std::string_view Name( Herd::Generic::ProfiledFunction i_Function ); ///< Returns the name of a profiled function
+
+  static ProfilingReport& ThreadReport(); ///< Returns the report of the calling thread
+
+private:
+
+  std::array< Herd::Generic::ProfilingCounter, static_cast< std::size_t >( Herd::Generic::ProfiledFunction::e_Count ) > m_Counters; ///< Counters, indexed by ProfiledFunction
+};
+
+/**
+ * @brief Adds the duration of its lifetime to the report of the calling thread
+ */
+class ActiveProfilingScope
+{
+public:
+
+  explicit ActiveProfilingScope( Herd::Generic::ProfiledFunction i_Function ); ///< Constructor
+  ~ActiveProfilingScope(); ///< Destructor
+
+  ActiveProfilingScope( const ActiveProfilingScope& ) = delete; ///< Deleted copy constructor
+  ActiveProfilingScope& operator=( const ActiveProfilingScope& ) = delete; ///< Deleted copy assignment
+
+private:
+
+  Herd::Generic::ProfiledFunction m_Function; ///< Profiled function
+  uint64_t m_Start; ///< Cycle counter at construction
+};
+
+/**
+ * @brief Stand-in for ActiveProfilingScope when profiling is disabled
+ */
+class InactiveProfilingScope
+{
+public:
+
+  /**
+   * @brief Constructor. Does nothing
+   */
+  explicit constexpr InactiveProfilingScope( Herd::Generic::ProfiledFunction )
+  {
+  }
+};
+
+/**
+ * @brief Profiles the enclosing scope
+ * @remarks Usage: <tt>[[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_X );</tt>
+ */
+using ProfilingScope = std::conditional_t< s_IsProfilingEnabled, ActiveProfilingScope, InactiveProfilingScope >;
+
+}
+
+#endif /* H2A7E4C19_6B3D_4F08_9C51_D0E83B6F7A24 */
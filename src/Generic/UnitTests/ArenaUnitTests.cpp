@@ -0,0 +1,132 @@
+/**
+ * @file ArenaUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <boost/test/unit_test.hpp>
+
+#include <Generic/Arena.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Counts the live instances
+ */
+struct Counted
+{
+  /**
+   * @param io_rCount Number of live instances
+   * @param i_bThrow If \c true, the constructor throws
+   */
+  Counted( int& io_rCount, bool i_bThrow ) :
+      m_rCount( io_rCount )
+  {
+    if( i_bThrow )
+    {
+      throw std::runtime_error( "Failed" );
+    }
+
+    ++m_rCount;
+  }
+
+  ~Counted()
+  {
+    --m_rCount;
+  }
+
+  int& m_rCount; ///< Number of live instances
+};
+
+}
+
+BOOST_FIXTURE_TEST_SUITE( ArenaTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( AllocationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  BOOST_CHECK_THROW( Herd::Generic::Arena( 0 ), Herd::Exceptions::PreconditionError );
+
+  std::size_t initialSize = GenerateNumber( static_cast< std::size_t >( 16 ), static_cast< std::size_t >( 256 ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Arena arena( initialSize );
+  BOOST_TEST( arena.Capacity() == initialSize ); // @suppress("Invalid arguments")
+  BOOST_TEST( arena.BlockCount() == 1 ); // @suppress("Invalid arguments")
+
+  // Aligned and non-overlapping, beyond the first block
+  std::vector< std::byte* > allocations;
+  std::vector< std::size_t > sizes;
+  std::size_t total = 0;
+  bool bAligned = true;
+  while( total < 4 * initialSize )
+  {
+    std::size_t size = GenerateNumber( static_cast< std::size_t >( 1 ), static_cast< std::size_t >( 64 ) ); // @suppress("Invalid arguments")
+    std::size_t alignment = std::size_t( 1 ) << GenerateNumber( 0u, 6u ); // @suppress("Invalid arguments")
+    std::byte* pMemory = static_cast< std::byte* >( arena.allocate( size, alignment ) );
+    bAligned &= reinterpret_cast< std::uintptr_t >( pMemory ) % alignment == 0;
+
+    allocations.push_back( pMemory );
+    sizes.push_back( size );
+    total += size;
+  }
+
+  bool bOverlaps = false;
+  for( std::size_t i = 0; i < allocations.size(); ++i )
+  {
+    for( std::size_t j = i + 1; j < allocations.size(); ++j )
+    {
+      bOverlaps |= allocations[ i ] < allocations[ j ] + sizes[ j ] && allocations[ j ] < allocations[ i ] + sizes[ i ];
+    }
+  }
+  BOOST_TEST( bAligned ); // @suppress("Invalid arguments")
+  BOOST_TEST( !bOverlaps ); // @suppress("Invalid arguments")
+  BOOST_TEST( arena.BlockCount() > 1 ); // @suppress("Invalid arguments")
+
+  // Reset merges the blocks, so that the same workload fits into one
+  std::size_t capacity = arena.Capacity();
+  arena.Reset();
+  BOOST_TEST( arena.BlockCount() == 1 ); // @suppress("Invalid arguments")
+  BOOST_TEST( arena.Capacity() == capacity ); // @suppress("Invalid arguments")
+
+  for( std::size_t index = 0; index < sizes.size(); ++index )
+  {
+    [[maybe_unused]] void* pMemory = arena.allocate( sizes[ index ], 1 );
+  }
+  BOOST_TEST( arena.BlockCount() == 1 ); // @suppress("Invalid arguments")
+
+  BOOST_TEST( arena.is_equal( arena ) ); // @suppress("Invalid arguments")
+  BOOST_TEST( !arena.is_equal( *std::pmr::new_delete_resource() ) ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( ArenaPtrTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  int count = 0;
+  Herd::Generic::Arena arena;
+
+  {
+    Herd::Generic::ArenaPtr< Counted > pArena = Herd::Generic::MakeArenaPtr< Counted >( &arena, count, false );
+    Herd::Generic::ArenaPtr< Counted > pHeap = Herd::Generic::MakeArenaPtr< Counted >( std::pmr::new_delete_resource(), count, false );
+    BOOST_TEST( count == 2 ); // @suppress("Invalid arguments")
+  }
+  BOOST_TEST( count == 0 ); // @suppress("Invalid arguments")
+
+  BOOST_CHECK_THROW( Herd::Generic::MakeArenaPtr< Counted >( std::pmr::new_delete_resource(), count, true ), std::runtime_error );
+  BOOST_CHECK_THROW( Herd::Generic::MakeArenaPtr< Counted >( &arena, count, true ), std::runtime_error );
+  BOOST_TEST( count == 0 ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,84 @@
+/**
+ * @file MonotoneCubicInterpolatorUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <boost/test/unit_test.hpp>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/MonotoneCubicInterpolator.h>
+
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cmath>
+#include <vector>
+
+#include <range/v3/algorithm.hpp>
+
+BOOST_FIXTURE_TEST_SUITE( MonotoneCubicInterpolatorTests, Herd::UnitTestUtils::RandomTestFixture, *boost::unit_test::tolerance(1e-12) )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile)
+{
+  BOOST_CHECK_THROW( Herd::Generic::MonotoneCubicInterpolator( { 0. }, { 0. } ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::Generic::MonotoneCubicInterpolator( { 0., 1. }, { 0. } ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::Generic::MonotoneCubicInterpolator( { 0., 1., 1. }, { 0., 1., 2. } ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::Generic::MonotoneCubicInterpolator( { 1., 0. }, { 0., 1. } ), Herd::Exceptions::PreconditionError );
+
+  Herd::Generic::MonotoneCubicInterpolator interpolator( { 0., 1. }, { 0., 1. } );
+  BOOST_TEST( interpolator.Lower() == 0. ); // @suppress("Invalid arguments")
+  BOOST_TEST( interpolator.Upper() == 1. ); // @suppress("Invalid arguments")
+  BOOST_CHECK_THROW( interpolator( -0.1 ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( interpolator( 1.1 ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( interpolator( std::nan( "" ) ), Herd::Exceptions::PreconditionError );
+}
+
+BOOST_AUTO_TEST_CASE( OperationTest, *Herd::UnitTestUtils::Labels::s_Compile)
+{
+  // Random, monotonically increasing data
+  std::size_t knotCount = 10;
+  std::vector< double > x( knotCount );
+  std::vector< double > y( knotCount );
+  for( std::size_t index = 0; index < knotCount; ++index )
+  {
+    x[ index ] = ( index == 0 ? 0. : x[ index - 1 ] ) + GenerateNumber( 0.1, 1. ); // @suppress("Invalid arguments")
+    y[ index ] = ( index == 0 ? 0. : y[ index - 1 ] ) + GenerateNumber( 0., 1. ); // @suppress("Invalid arguments")
+  }
+
+  Herd::Generic::MonotoneCubicInterpolator interpolator( x, y );
+
+  // Knots are reproduced
+  for( std::size_t index = 0; index < knotCount; ++index )
+  {
+    BOOST_TEST( interpolator( x[ index ] ) == y[ index ] ); // @suppress("Invalid arguments")
+  }
+
+  // Monotonicity is preserved
+  std::size_t sampleCount = 1000;
+  std::vector< double > samples( sampleCount );
+  for( std::size_t index = 0; index < sampleCount; ++index )
+  {
+    samples[ index ] = interpolator( x.front() + ( x.back() - x.front() ) * index / ( sampleCount - 1 ) );
+  }
+
+  BOOST_TEST( ranges::cpp20::is_sorted( samples ) );  // @suppress("Invalid arguments")
+
+  // Linear data is reproduced exactly
+  double a = GenerateNumber( -1., 1. ); // @suppress("Invalid arguments")
+  double b = GenerateNumber( -1., 1. ); // @suppress("Invalid arguments")
+  std::vector< double > linear( knotCount );
+  ranges::cpp20::transform( x, linear.begin(), [ & ]( double i_X ){ return a + b * i_X; } );
+
+  Herd::Generic::MonotoneCubicInterpolator linearInterpolator( x, linear );
+  double query = GenerateNumber( x.front(), x.back() ); // @suppress("Invalid arguments")
+  BOOST_TEST( std::abs( linearInterpolator( query ) - ( a + b * query ) ) < 1e-10 ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,107 @@
+/**
+ * @file ProfilingUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <boost/test/unit_test.hpp>
+
+#include <Generic/Profiling.h>
+
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+BOOST_FIXTURE_TEST_SUITE( ProfilingTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ReportTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  constexpr std::size_t functionCount = static_cast< std::size_t >( Herd::Generic::ProfiledFunction::e_Count );
+  for( std::size_t index = 0; index < functionCount; ++index )
+  {
+    BOOST_TEST( !Herd::Generic::ProfilingReport::Name( static_cast< Herd::Generic::ProfiledFunction >( index ) ).empty() ); // @suppress("Invalid arguments")
+  }
+
+  Herd::Generic::ProfilingReport report1;
+  Herd::Generic::ProfilingReport report2;
+  for( std::size_t index = 0; index < functionCount; ++index )
+  {
+    BOOST_TEST( report1[ static_cast< Herd::Generic::ProfiledFunction >( index ) ].m_Calls == 0 ); // @suppress("Invalid arguments")
+    BOOST_TEST( report1[ static_cast< Herd::Generic::ProfiledFunction >( index ) ].m_Cycles == 0 ); // @suppress("Invalid arguments")
+  }
+
+  uint64_t calls1 = GenerateNumber( 0u, 1000u ); // @suppress("Invalid arguments")
+  uint64_t calls2 = GenerateNumber( 0u, 1000u ); // @suppress("Invalid arguments")
+  uint64_t cycles1 = GenerateNumber( 0u, 100000u ); // @suppress("Invalid arguments")
+  uint64_t cycles2 = GenerateNumber( 0u, 100000u ); // @suppress("Invalid arguments")
+
+  constexpr Herd::Generic::ProfiledFunction function = Herd::Generic::ProfiledFunction::e_StellarWind;
+  report1[ function ] = { calls1, cycles1 };
+  report2[ function ] = { calls2, cycles2 };
+
+  Herd::Generic::ProfilingReport sum = report1;
+  sum += report2;
+  BOOST_TEST( sum[ function ].m_Calls == calls1 + calls2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( sum[ function ].m_Cycles == cycles1 + cycles2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( sum[ Herd::Generic::ProfiledFunction::e_TimestepTrial ].m_Calls == 0 ); // @suppress("Invalid arguments")
+
+  sum -= report1;
+  BOOST_TEST( sum[ function ].m_Calls == calls2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( sum[ function ].m_Cycles == cycles2 ); // @suppress("Invalid arguments")
+
+  sum.Reset();
+  BOOST_TEST( sum[ function ].m_Calls == 0 ); // @suppress("Invalid arguments")
+  BOOST_TEST( sum[ function ].m_Cycles == 0 ); // @suppress("Invalid arguments")
+}
+
+// Each thread counts into its own report
+BOOST_AUTO_TEST_CASE( ScopeTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  constexpr Herd::Generic::ProfiledFunction function = Herd::Generic::ProfiledFunction::e_ConvectiveEnvelope;
+  unsigned int callCount = GenerateNumber( 1u, 10u ); // @suppress("Invalid arguments")
+
+  Herd::Generic::ProfilingReport start = Herd::Generic::ProfilingReport::ThreadReport();
+  Herd::Generic::ProfilingReport threadCounts;
+  std::thread thread( [ & ]()
+  {
+    Herd::Generic::ProfilingReport threadStart = Herd::Generic::ProfilingReport::ThreadReport();
+    for( unsigned int index = 0; index < 2 * callCount; ++index )
+    {
+      [[maybe_unused]] Herd::Generic::ProfilingScope scope( function );
+    }
+
+    threadCounts = Herd::Generic::ProfilingReport::ThreadReport();
+    threadCounts -= threadStart;
+  } );
+
+  for( unsigned int index = 0; index < callCount; ++index )
+  {
+    [[maybe_unused]] Herd::Generic::ProfilingScope scope( function );
+  }
+
+  thread.join();
+
+  Herd::Generic::ProfilingReport counts = Herd::Generic::ProfilingReport::ThreadReport();
+  counts -= start;
+
+  uint64_t expected = Herd::Generic::s_IsProfilingEnabled ? callCount : 0;
+  BOOST_TEST( counts[ function ].m_Calls == expected ); // @suppress("Invalid arguments")
+  BOOST_TEST( threadCounts[ function ].m_Calls == 2 * expected ); // @suppress("Invalid arguments")
+  BOOST_TEST( counts[ Herd::Generic::ProfiledFunction::e_StellarWind ].m_Calls == 0 ); // @suppress("Invalid arguments")
+
+  if constexpr( !Herd::Generic::s_IsProfilingEnabled )
+  {
+    BOOST_TEST( counts[ function ].m_Cycles == 0 ); // @suppress("Invalid arguments")
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,83 @@
+/**
+ * @file WorkStealingSchedulerUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include <boost/test/unit_test.hpp>
+
+#include <Generic/WorkStealingScheduler.h>
+
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <range/v3/algorithm.hpp>
+
+BOOST_FIXTURE_TEST_SUITE( WorkStealingSchedulerTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ExecutionTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  unsigned int threadCount = GenerateNumber( 1u, 8u ); // @suppress("Invalid arguments")
+  Herd::Generic::WorkStealingScheduler scheduler( threadCount );
+  BOOST_TEST( scheduler.ThreadCount() == threadCount );
+
+  // Repeated batches, each task is executed exactly once. Uneven task durations trigger stealing
+  for( std::size_t batch = 0; batch < 3; ++batch )
+  {
+    std::size_t taskCount = GenerateNumber( static_cast< std::size_t >( 0 ), static_cast< std::size_t >( 1000 ) ); // @suppress("Invalid arguments")
+    std::vector< std::atomic< unsigned int > > executionCounts( taskCount );
+    std::atomic< bool > bValidWorkers = true; // Boost.Test macros are not thread-safe
+    scheduler.Run( taskCount, [ & ]( std::size_t i_WorkerIndex, std::size_t i_TaskIndex )
+    {
+      if( i_WorkerIndex >= threadCount )
+      {
+        bValidWorkers = false;
+      }
+
+      volatile double sink = 0;
+      for( std::size_t idx = 0; idx < ( i_TaskIndex % 7 ) * 1000; ++idx )
+      {
+        sink = sink + 1.;
+      }
+      ++executionCounts[ i_TaskIndex ];
+    } );
+
+    BOOST_TEST( bValidWorkers );
+    BOOST_TEST( ranges::cpp20::all_of( executionCounts, []( const auto& i_rCount )
+    { return i_rCount == 1;} ) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( ExceptionTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::WorkStealingScheduler scheduler( 4 );
+
+  std::size_t taskCount = 100;
+  std::size_t failingTask = GenerateNumber( static_cast< std::size_t >( 0 ), taskCount - 1 ); // @suppress("Invalid arguments")
+  BOOST_CHECK_THROW( scheduler.Run( taskCount, [ & ]( std::size_t, std::size_t i_TaskIndex )
+  {
+    if( i_TaskIndex == failingTask )
+    {
+      throw std::runtime_error( "Task failure" );
+    }
+  } ), std::runtime_error );
+
+  // The scheduler is still usable
+  std::atomic< std::size_t > executed = 0;
+  scheduler.Run( taskCount, [ & ]( std::size_t, std::size_t )
+  { ++executed;} );
+  BOOST_TEST( executed == taskCount );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
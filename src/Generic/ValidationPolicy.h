@@ -0,0 +1,45 @@
+/**
+ * @file ValidationPolicy.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H5D18608C_9E8B_4A0F_8570_591F37203DBE
+#define H5D18608C_9E8B_4A0F_8570_591F37203DBE
+
+namespace Herd::Generic
+{
+
+/**
+ * @brief Selects whether a group of precondition checks is performed
+ * @tparam IsEnabled If \c false, the checks are compiled out
+ */
+template< bool IsEnabled >
+struct ValidationPolicy
+{
+  inline static constexpr bool s_IsEnabled = IsEnabled; ///< If \c true, the checks are performed
+};
+
+using FullValidation = ValidationPolicy< true >; ///< Checks are performed
+using NoValidation = ValidationPolicy< false >; ///< Checks are compiled out
+
+/**
+ * @brief Policy for the checks on the hot paths inside the evolution loop
+ * @remarks These checks repeat the validation of states that the library produces itself. The inputs are always validated at the API boundary
+ * @remarks NoValidation if the CMake option \c SKIP_INNER_VALIDATION is on
+ */
+#ifdef HERD_SKIP_INNER_VALIDATION
+using InnerValidation = NoValidation;
+#else
+using InnerValidation = FullValidation;
+#endif
+
+}
+
+#endif /* H5D18608C_9E8B_4A0F_8570_591F37203DBE */
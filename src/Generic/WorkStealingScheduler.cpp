@@ -0,0 +1,230 @@
+/**
+ * @file WorkStealingScheduler.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "WorkStealingScheduler.h"
+
+#include <algorithm>
+
+namespace Herd::Generic
+{
+
+/**
+ * @param i_ThreadCount Number of workers, including the calling thread. If 0, the number of hardware threads
+ */
+WorkStealingScheduler::WorkStealingScheduler( unsigned int i_ThreadCount )
+{
+  unsigned int threadCount = i_ThreadCount == 0 ? std::max( 1u, std::thread::hardware_concurrency() ) : i_ThreadCount;
+
+  m_Ranges.reserve( threadCount );
+  for( unsigned int index = 0; index < threadCount; ++index )
+  {
+    m_Ranges.push_back( std::make_unique< TaskRange >() );
+  }
+
+  // Worker 0 is the calling thread
+  m_Threads.reserve( threadCount - 1 );
+  for( unsigned int index = 1; index < threadCount; ++index )
+  {
+    m_Threads.emplace_back( &WorkStealingScheduler::Work, this, index );
+  }
+}
+
+/**
+ * @remarks Worker threads are joined by std::jthread
+ */
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+  {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    m_bTerminate = true;
+  }
+  m_Dispatched.notify_all();
+}
+
+/**
+ * @param i_TaskCount Number of tasks
+ * @param i_rTask Task. Must be safe to call concurrently with different task indices
+ * @throws Rethrows the first exception thrown by a task, after all workers stop
+ * @remarks Blocks until all tasks are executed
+ */
+void WorkStealingScheduler::Run( std::size_t i_TaskCount, const Task& i_rTask )
+{
+  if( i_TaskCount == 0 )
+  {
+    return;
+  }
+
+  // Initial distribution of the tasks in contiguous blocks
+  std::size_t workerCount = m_Ranges.size();
+  for( std::size_t index = 0; index < workerCount; ++index )
+  {
+    TaskRange& rRange = *m_Ranges[ index ];
+    std::lock_guard< std::mutex > lock( rRange.m_Mutex );
+    rRange.m_Begin = ( i_TaskCount * index ) / workerCount;
+    rRange.m_End = ( i_TaskCount * ( index + 1 ) ) / workerCount;
+  }
+
+  {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    m_pTask = &i_rTask;
+    m_pException = nullptr;
+    m_bAbort = false;
+    m_BusyCount = m_Threads.size();
+    ++m_Batch;
+  }
+  m_Dispatched.notify_all();
+
+  Drain( 0 );
+
+  {
+    std::unique_lock< std::mutex > lock( m_Mutex );
+    m_Finished.wait( lock, [ this ]()
+    { return m_BusyCount == 0;} );
+    m_pTask = nullptr;
+  }
+
+  if( m_pException )
+  {
+    std::rethrow_exception( m_pException );
+  }
+}
+
+/**
+ * @return Number of workers, including the calling thread
+ */
+unsigned int WorkStealingScheduler::ThreadCount() const
+{
+  return m_Ranges.size();
+}
+
+/**
+ * @param i_WorkerIndex Index of the worker
+ */
+void WorkStealingScheduler::Work( unsigned int i_WorkerIndex )
+{
+  std::uint64_t processedBatch = 0;
+  while( true )
+  {
+    {
+      std::unique_lock< std::mutex > lock( m_Mutex );
+      m_Dispatched.wait( lock, [ & ]()
+      { return m_bTerminate || m_Batch != processedBatch;} );
+
+      if( m_bTerminate )
+      {
+        return;
+      }
+
+      processedBatch = m_Batch;
+    }
+
+    Drain( i_WorkerIndex );
+
+    {
+      std::lock_guard< std::mutex > lock( m_Mutex );
+      --m_BusyCount;
+      if( m_BusyCount == 0 )
+      {
+        m_Finished.notify_one();
+      }
+    }
+  }
+}
+
+/**
+ * @param i_WorkerIndex Index of the worker
+ * @remarks Exceptions are stored, and stop the execution of the remaining tasks
+ */
+void WorkStealingScheduler::Drain( unsigned int i_WorkerIndex )
+{
+  while( !m_bAbort )
+  {
+    std::optional< std::size_t > task = Pop( i_WorkerIndex );
+    if( !task )
+    {
+      task = Steal( i_WorkerIndex );
+    }
+
+    if( !task )
+    {
+      break;
+    }
+
+    try
+    {
+      ( *m_pTask )( i_WorkerIndex, *task );
+    } catch( ... )
+    {
+      std::lock_guard< std::mutex > lock( m_Mutex );
+      if( !m_pException )
+      {
+        m_pException = std::current_exception();
+      }
+      m_bAbort = true;
+    }
+  }
+}
+
+/**
+ * @param i_WorkerIndex Index of the worker
+ * @return Index of the task. Invalid if the range of the worker is empty
+ */
+std::optional< std::size_t > WorkStealingScheduler::Pop( unsigned int i_WorkerIndex )
+{
+  TaskRange& rRange = *m_Ranges[ i_WorkerIndex ];
+  std::lock_guard< std::mutex > lock( rRange.m_Mutex );
+  if( rRange.m_Begin == rRange.m_End )
+  {
+    return std::nullopt;
+  }
+
+  return rRange.m_Begin++;
+}
+
+/**
+ * @param i_WorkerIndex Index of the thief
+ * @return Index of the task to be executed next. Invalid if all ranges are empty
+ * @remarks The remainder of the stolen block is moved to the range of the thief
+ */
+std::optional< std::size_t > WorkStealingScheduler::Steal( unsigned int i_WorkerIndex )
+{
+  std::size_t workerCount = m_Ranges.size();
+  for( std::size_t offset = 1; offset < workerCount; ++offset )
+  {
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    {
+      TaskRange& rVictim = *m_Ranges[ ( i_WorkerIndex + offset ) % workerCount ];
+      std::lock_guard< std::mutex > lock( rVictim.m_Mutex );
+      if( rVictim.m_Begin == rVictim.m_End )
+      {
+        continue;
+      }
+
+      // Upper half, as the victim is working from the lower end
+      begin = rVictim.m_Begin + ( rVictim.m_End - rVictim.m_Begin ) / 2;
+      end = rVictim.m_End;
+      rVictim.m_End = begin;
+    }
+
+    TaskRange& rOwn = *m_Ranges[ i_WorkerIndex ];
+    std::lock_guard< std::mutex > lock( rOwn.m_Mutex );
+    rOwn.m_Begin = begin + 1;
+    rOwn.m_End = end;
+
+    return begin;
+  }
+
+  return std::nullopt;
+}
+
+}
@@ -0,0 +1,88 @@
+/**
+ * @file WorkStealingScheduler.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H6288FAEE_3D26_429C_A66E_5A80B1F38E5E
+#define H6288FAEE_3D26_429C_A66E_5A80B1F38E5E
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace Herd::Generic
+{
+
+/**
+ * @brief A thread pool executing a set of independent tasks with work stealing
+ * @remarks Each worker starts with a contiguous block of tasks. A worker that runs out of tasks steals the upper half of the remaining block of another worker
+ * @remarks The calling thread participates as the first worker
+ */
+class WorkStealingScheduler
+{
+public:
+
+  using Task = std::function< void( std::size_t i_WorkerIndex, std::size_t i_TaskIndex ) >; ///< A task, identified by its index
+
+  explicit WorkStealingScheduler( unsigned int i_ThreadCount );  ///< Constructor
+  ~WorkStealingScheduler(); ///< Destructor
+
+  WorkStealingScheduler( const WorkStealingScheduler& ) = delete; ///< Deleted copy constructor
+  WorkStealingScheduler& operator=( const WorkStealingScheduler& ) = delete; ///< Deleted copy assignment
+
+  void Run( std::size_t i_TaskCount, const Task& i_rTask ); ///< Executes the tasks with indices in [0, i_TaskCount)
+
+  unsigned int ThreadCount() const; ///< Returns the number of workers
+
+private:
+
+  /**
+   * @brief Tasks waiting to be executed by a worker
+   */
+  struct TaskRange
+  {
+    std::mutex m_Mutex; ///< Guards the range
+    std::size_t m_Begin = 0; ///< First task
+    std::size_t m_End = 0; ///< One past the last task
+  };
+
+  void Work( unsigned int i_WorkerIndex ); ///< Main loop of a worker thread
+  void Drain( unsigned int i_WorkerIndex ); ///< Executes tasks until there are none left
+
+  std::optional< std::size_t > Pop( unsigned int i_WorkerIndex ); ///< Takes a task from the own range of a worker
+  std::optional< std::size_t > Steal( unsigned int i_WorkerIndex ); ///< Takes tasks from the range of another worker
+
+  std::vector< std::unique_ptr< TaskRange > > m_Ranges; ///< Task ranges, one per worker
+  std::vector< std::jthread > m_Threads; ///< Worker threads, excluding the calling thread
+
+  std::mutex m_Mutex; ///< Guards the dispatch state
+  std::condition_variable m_Dispatched; ///< Signals a new batch of tasks, or termination
+  std::condition_variable m_Finished; ///< Signals that all workers are idle
+
+  const Task* m_pTask = nullptr; ///< Current task
+  std::uint64_t m_Batch = 0; ///< Number of batches dispatched so far
+  unsigned int m_BusyCount = 0; ///< Number of worker threads still working on the current batch
+  bool m_bTerminate = false; ///< If \c true, worker threads exit
+
+  std::atomic< bool > m_bAbort = false; ///< Set when a task throws, so that the remaining tasks are skipped
+  std::exception_ptr m_pException; ///< First exception thrown by a task
+};
+
+}
+
+#endif /* H6288FAEE_3D26_429C_A66E_5A80B1F38E5E */
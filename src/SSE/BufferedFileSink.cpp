@@ -0,0 +1,358 @@
+/**
+ * @file BufferedFileSink.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "BufferedFileSink.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace
+{
+constexpr std::array< char, 8 > s_Magic { 'H', 'E', 'R', 'D', 'S', 'T', 'R', 'M' }; ///< Identifies a trajectory stream
+constexpr uint32_t s_Version = 1; ///< Format version. Increment when the layout changes
+constexpr uint32_t s_ByteOrderMark = 0x01020304; ///< Reads differently on a platform with a different byte order
+
+/**
+ * @brief Writes the object representation of a value
+ * @tparam T Trivially copyable type
+ * @param i_Value Value
+ * @param io_rStream Stream
+ */
+template< class T >
+  requires std::is_trivially_copyable_v< T >
+void WriteValue( T i_Value, std::ostream& io_rStream )
+{
+  io_rStream.write( reinterpret_cast< const char* >( &i_Value ), sizeof(T) );
+}
+
+/**
+ * @brief Reads the object representation of a value
+ * @tparam T Trivially copyable type
+ * @param io_rStream Stream
+ * @return Value
+ * @throws RuntimeError If the stream ends prematurely
+ */
+template< class T >
+  requires std::is_trivially_copyable_v< T >
+T ReadValue( std::istream& io_rStream )
+{
+  T value;
+  if( !io_rStream.read( reinterpret_cast< char* >( &value ), sizeof(T) ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Truncated trajectory stream" );
+  }
+
+  return value;
+}
+
+/**
+ * @brief Writes or reads the fields of a track point, in a fixed order
+ * @tparam TTrackPoint TrackPoint, \c const for writing
+ * @tparam TProcess Callable
+ * @param io_rTrackPoint Track point, \c const for writing
+ * @param i_Process Callable that processes a reference to a quantity
+ */
+template< class TTrackPoint, class TProcess >
+void VisitFields( TTrackPoint& io_rTrackPoint, TProcess i_Process )
+{
+  i_Process( io_rTrackPoint.m_Mass );
+  i_Process( io_rTrackPoint.m_InitialMetallicity );
+  i_Process( io_rTrackPoint.m_Radius );
+  i_Process( io_rTrackPoint.m_Luminosity );
+  i_Process( io_rTrackPoint.m_Temperature );
+  i_Process( io_rTrackPoint.m_Age );
+  i_Process( io_rTrackPoint.m_CoreMass );
+  i_Process( io_rTrackPoint.m_EnvelopeMass );
+  i_Process( io_rTrackPoint.m_AngularVelocity );
+}
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_rPath Path to the file. Overwritten if it exists
+ * @param i_QueueCapacity Maximum number of records waiting to be written. A record is a track point, or the start or the end of a track
+ * @pre \c i_QueueCapacity is positive
+ * @throws PreconditionError If the precondition is violated
+ * @throws RuntimeError If the file cannot be opened
+ * @remarks The writer takes the entire queue at once, so at most twice \c i_QueueCapacity records are held in memory
+ */
+BufferedFileSink::BufferedFileSink( const std::filesystem::path& i_rPath, std::size_t i_QueueCapacity ) :
+    m_File( i_rPath, std::ios::binary | std::ios::trunc ), m_Capacity( i_QueueCapacity )
+{
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_QueueCapacity, "i_QueueCapacity" );
+
+  if( !m_File )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Cannot open the trajectory stream" );
+  }
+
+  m_File.write( s_Magic.data(), s_Magic.size() );
+  WriteValue( s_Version, m_File );
+  WriteValue( s_ByteOrderMark, m_File );
+
+  m_Queue.reserve( m_Capacity );
+  m_Writer = std::jthread( [ this ]()
+  { Write();} );
+}
+
+/**
+ * @remarks Closes the file if Close is not called. Errors are only reported by Close
+ */
+BufferedFileSink::~BufferedFileSink()
+{
+  try
+  {
+    Close();
+  } catch( ... )
+  {
+  }
+}
+
+/**
+ * @param i_TrackIndex Index of the track, e.g. the index of the star in a population
+ * @throws PreconditionError If the sink is closed
+ * @throws RuntimeError If a previous write has failed
+ */
+void BufferedFileSink::Begin( std::size_t i_TrackIndex )
+{
+  Enqueue( Record { RecordType::e_Begin, i_TrackIndex, Herd::SSE::TrackPoint() } );
+}
+
+/**
+ * @param i_rTrackPoint Track point
+ * @throws PreconditionError If the sink is closed
+ * @throws RuntimeError If a previous write has failed
+ */
+void BufferedFileSink::Push( const Herd::SSE::TrackPoint& i_rTrackPoint )
+{
+  Enqueue( Record { RecordType::e_TrackPoint, 0, i_rTrackPoint } );
+}
+
+/**
+ * @throws PreconditionError If the sink is closed
+ * @throws RuntimeError If a previous write has failed
+ */
+void BufferedFileSink::End()
+{
+  Enqueue( Record { RecordType::e_End, 0, Herd::SSE::TrackPoint() } );
+}
+
+/**
+ * @throws RuntimeError If any writes have failed
+ * @remarks Blocks until the writer thread finishes. Subsequent calls have no effect
+ */
+void BufferedFileSink::Close()
+{
+  {
+    std::lock_guard< std::mutex > lock( m_Mutex );
+    if( m_bClosing )
+    {
+      return;
+    }
+
+    m_bClosing = true;
+  }
+
+  m_HasRecords.notify_one();
+  m_Writer.join();
+
+  m_File.close();
+  if( m_bFailed || !m_File )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Cannot write the trajectory stream" );
+  }
+}
+
+/**
+ * @param i_rRecord Record
+ * @throws PreconditionError If the sink is closed
+ * @throws RuntimeError If a previous write has failed
+ */
+void BufferedFileSink::Enqueue( const Record& i_rRecord )
+{
+  {
+    std::unique_lock< std::mutex > lock( m_Mutex );
+    if( m_bClosing )
+    {
+      [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "BufferedFileSink", "Open", "Closed" );
+    }
+
+    m_HasSpace.wait( lock, [ this ]()
+    { return m_Queue.size() < m_Capacity || m_bFailed;} );
+
+    if( m_bFailed )
+    {
+      [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Cannot write the trajectory stream" );
+    }
+
+    m_Queue.push_back( i_rRecord );
+  }
+
+  m_HasRecords.notify_one();
+}
+
+/**
+ * @remarks Takes all queued records at once, and writes them without holding the lock
+ */
+void BufferedFileSink::Write()
+{
+  std::vector< Record > batch;
+  batch.reserve( m_Capacity );
+
+  while( true )
+  {
+    {
+      std::unique_lock< std::mutex > lock( m_Mutex );
+      m_HasRecords.wait( lock, [ this ]()
+      { return !m_Queue.empty() || m_bClosing;} );
+
+      if( m_Queue.empty() )
+      {
+        break;  // Closing, and nothing left to write
+      }
+
+      batch.swap( m_Queue );
+    }
+
+    m_HasSpace.notify_all();
+
+    for( const auto& rRecord : batch )
+    {
+      WriteRecord( rRecord );
+    }
+    batch.clear();
+
+    if( !m_File )
+    {
+      std::lock_guard< std::mutex > lock( m_Mutex );
+      m_bFailed = true;
+      break;
+    }
+  }
+
+  m_File.flush();
+  std::lock_guard< std::mutex > lock( m_Mutex );
+  m_bFailed = m_bFailed || !m_File;
+  m_HasSpace.notify_all();
+}
+
+/**
+ * @param i_rRecord Record
+ */
+void BufferedFileSink::WriteRecord( const Record& i_rRecord )
+{
+  WriteValue( i_rRecord.m_Type, m_File );
+  switch( i_rRecord.m_Type )
+  {
+    case RecordType::e_Begin:
+      WriteValue( static_cast< uint64_t >( i_rRecord.m_TrackIndex ), m_File );
+      break;
+
+    case RecordType::e_TrackPoint:
+      VisitFields( i_rRecord.m_TrackPoint, [ this ]( const auto& i_rField )
+      {
+        WriteValue( i_rField.Value(), m_File );
+      } );
+      WriteValue( i_rRecord.m_TrackPoint.m_Stage, m_File );
+      break;
+
+    case RecordType::e_End:
+      break;
+  }
+}
+
+/**
+ * @param i_rPath Path to the file
+ * @param i_rCallback Called for each complete track, in the order of the file
+ * @throws RuntimeError If the file cannot be read, or is malformed
+ * @remarks Only one track is held in memory at a time
+ */
+void BufferedFileSink::Read( const std::filesystem::path& i_rPath,
+    const std::function< void( std::size_t i_TrackIndex, const Herd::SSE::ColumnarTrajectory& i_rTrajectory ) >& i_rCallback )
+{
+  std::ifstream file( i_rPath, std::ios::binary );
+
+  std::array< char, s_Magic.size() > magic;
+  if( !file.read( magic.data(), magic.size() ) || magic != s_Magic )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Not a trajectory stream" );
+  }
+
+  if( ReadValue< uint32_t >( file ) != s_Version || ReadValue< uint32_t >( file ) != s_ByteOrderMark )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Unsupported trajectory stream" );
+  }
+
+  Herd::SSE::ColumnarTrajectory trajectory;
+  std::size_t trackIndex = 0;
+  bool isInTrack = false;
+
+  char type;
+  while( file.get( type ) )
+  {
+    switch( static_cast< RecordType >( type ) )
+    {
+      case RecordType::e_Begin:
+        if( isInTrack )
+        {
+          [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Unterminated track in the trajectory stream" );
+        }
+
+        trackIndex = ReadValue< uint64_t >( file );
+        trajectory.clear();
+        isInTrack = true;
+        break;
+
+      case RecordType::e_TrackPoint:
+      {
+        if( !isInTrack )
+        {
+          [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Track point outside of a track in the trajectory stream" );
+        }
+
+        Herd::SSE::TrackPoint trackPoint;
+        VisitFields( trackPoint, [ &file ]( auto& o_rField )
+        {
+          o_rField.Set( ReadValue< double >( file ) );
+        } );
+        trackPoint.m_Stage = ReadValue< Herd::SSE::EvolutionStage >( file );
+        trajectory.push_back( trackPoint );
+        break;
+      }
+
+      case RecordType::e_End:
+        if( !isInTrack )
+        {
+          [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Unopened track in the trajectory stream" );
+        }
+
+        i_rCallback( trackIndex, trajectory );
+        isInTrack = false;
+        break;
+
+      default:
+        [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Malformed trajectory stream" );
+    }
+  }
+
+  if( isInTrack )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Truncated trajectory stream" );
+  }
+}
+
+}
@@ -0,0 +1,98 @@
+/**
+ * @file BufferedFileSink.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef HF23A35BD_EC27_460F_AA5A_C0EFDA6B788F
+#define HF23A35BD_EC27_460F_AA5A_C0EFDA6B788F
+
+#include "ColumnarTrajectory.h"
+#include "ITrajectorySink.h"
+#include "TrackPoint.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Writes trajectories to a file from a background thread
+ * @remarks Records wait in a bounded queue. When the queue is full, the evolving thread blocks until the writer catches up, so the memory use depends on the queue capacity only
+ * @remarks The file is a sequence of tracks, each a track index followed by its track points, in their native representation. BufferedFileSink::Read reads it one track at a time
+ */
+class BufferedFileSink : public Herd::SSE::ITrajectorySink
+{
+public:
+
+  explicit BufferedFileSink( const std::filesystem::path& i_rPath, std::size_t i_QueueCapacity = s_DefaultQueueCapacity ); ///< Constructor
+  ~BufferedFileSink(); ///< Destructor
+
+  BufferedFileSink( const BufferedFileSink& ) = delete; ///< Deleted copy constructor
+  BufferedFileSink& operator=( const BufferedFileSink& ) = delete; ///< Deleted copy assignment
+
+  void Begin( std::size_t i_TrackIndex ) override; ///< Starts the trajectory of a star
+  void Push( const Herd::SSE::TrackPoint& i_rTrackPoint ) override; ///< Receives a track point
+  void End() override; ///< Ends the trajectory of the current star
+
+  void Close(); ///< Writes the queued records, and closes the file
+
+  static void Read( const std::filesystem::path& i_rPath,
+      const std::function< void( std::size_t i_TrackIndex, const Herd::SSE::ColumnarTrajectory& i_rTrajectory ) >& i_rCallback ); ///< Reads a file written by a BufferedFileSink
+
+  inline static constexpr std::size_t s_DefaultQueueCapacity = 4096; ///< Default number of records in the queue
+
+private:
+
+  /**
+   * @brief Record types
+   */
+  enum class RecordType : char
+  {
+    e_Begin, // Start of a track
+    e_TrackPoint, // Track point
+    e_End  // End of a track
+  };
+
+  /**
+   * @brief A queued record
+   */
+  struct Record
+  {
+    RecordType m_Type = RecordType::e_End; ///< Type
+    std::size_t m_TrackIndex = 0; ///< Track index, for RecordType::e_Begin
+    Herd::SSE::TrackPoint m_TrackPoint; ///< Track point, for RecordType::e_TrackPoint
+  };
+
+  void Enqueue( const Record& i_rRecord ); ///< Adds a record to the queue, waiting for space if necessary
+  void Write(); ///< Main loop of the writer thread
+  void WriteRecord( const Record& i_rRecord ); ///< Writes a record to the file
+
+  std::ofstream m_File; ///< Output file. Accessed by the writer thread only, once the thread is running
+  std::size_t m_Capacity; ///< Maximum number of queued records
+
+  std::mutex m_Mutex; ///< Guards the queue and the flags
+  std::condition_variable m_HasRecords; ///< Signals new records, or closing
+  std::condition_variable m_HasSpace; ///< Signals that the writer has taken the queued records
+  std::vector< Record > m_Queue; ///< Records waiting to be written
+  bool m_bClosing = false; ///< Set when the file is being closed
+  bool m_bFailed = false; ///< Set when a write fails
+
+  std::jthread m_Writer; ///< Writer thread
+};
+}
+
+#endif /* HF23A35BD_EC27_460F_AA5A_C0EFDA6B788F */
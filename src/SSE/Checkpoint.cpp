@@ -0,0 +1,161 @@
+/**
+ * @file Checkpoint.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "Checkpoint.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <array>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+namespace
+{
+constexpr std::array< char, 8 > s_Magic { 'H', 'E', 'R', 'D', 'C', 'K', 'P', 'T' }; ///< Identifies a checkpoint stream
+constexpr uint32_t s_Version = 1; ///< Format version. Increment when the layout changes
+
+/**
+ * @brief Writes the object representation of a value
+ * @tparam T Trivially copyable type
+ * @param i_Value Value
+ * @param io_rStream Stream
+ */
+template< class T >
+  requires std::is_trivially_copyable_v< T >
+void Write( T i_Value, std::ostream& io_rStream )
+{
+  io_rStream.write( reinterpret_cast< const char* >( &i_Value ), sizeof( T ) );
+}
+
+/**
+ * @brief Reads the object representation of a value
+ * @tparam T Trivially copyable type
+ * @param io_rStream Stream
+ * @return Value
+ * @throws RuntimeError If the stream ends prematurely
+ */
+template< class T >
+  requires std::is_trivially_copyable_v< T >
+T Read( std::istream& io_rStream )
+{
+  T value;
+  if( !io_rStream.read( reinterpret_cast< char* >( &value ), sizeof( T ) ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Truncated checkpoint" );
+  }
+
+  return value;
+}
+
+/**
+ * @brief Writes or reads the numerical fields of a state, in a fixed order
+ * @tparam TState EvolutionState, \c const for writing
+ * @tparam TProcess Callable
+ * @param io_rState State
+ * @param i_Process Callable that processes a reference to a quantity or to a \c double
+ */
+template< class TState, class TProcess >
+void VisitFields( TState& io_rState, TProcess i_Process )
+{
+  auto& rTrackPoint = io_rState.m_TrackPoint;
+  i_Process( rTrackPoint.m_Mass );
+  i_Process( rTrackPoint.m_InitialMetallicity );
+  i_Process( rTrackPoint.m_Radius );
+  i_Process( rTrackPoint.m_Luminosity );
+  i_Process( rTrackPoint.m_Temperature );
+  i_Process( rTrackPoint.m_Age );
+  i_Process( rTrackPoint.m_CoreMass );
+  i_Process( rTrackPoint.m_EnvelopeMass );
+  i_Process( rTrackPoint.m_AngularVelocity );
+
+  i_Process( io_rState.m_EffectiveAge );
+  i_Process( io_rState.m_CoreRadius );
+  i_Process( io_rState.m_MassLossRate );
+  i_Process( io_rState.m_AngularMomentum );
+  i_Process( io_rState.m_K2 );
+  i_Process( io_rState.m_MZAMS );
+  i_Process( io_rState.m_MZHe );
+  i_Process( io_rState.m_MFGB );
+  i_Process( io_rState.m_MCHeI );
+  i_Process( io_rState.m_DeltaT );
+  i_Process( io_rState.m_THeMS );
+}
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_rCheckpoint Checkpoint
+ * @param io_rStream Output stream, opened in binary mode
+ * @remarks Values are written in their native representation. A checkpoint is read back exactly on the same platform
+ */
+void WriteCheckpoint( const Herd::SSE::Checkpoint& i_rCheckpoint, std::ostream& io_rStream )
+{
+  io_rStream.write( s_Magic.data(), s_Magic.size() );
+  Write( s_Version, io_rStream );
+
+  VisitFields( i_rCheckpoint.m_State, [ &io_rStream ]( const auto& i_rField )
+  {
+    Write( static_cast< double >( i_rField ), io_rStream );
+  } );
+  Write( i_rCheckpoint.m_State.m_TrackPoint.m_Stage, io_rStream );
+
+  Write( i_rCheckpoint.m_InitialMass.Value(), io_rStream );
+  Write( i_rCheckpoint.m_MainSequenceEvaluatedAt.Value(), io_rStream );
+  Write( static_cast< uint64_t >( i_rCheckpoint.m_Seed ), io_rStream );
+}
+
+/**
+ * @param io_rStream Input stream, opened in binary mode
+ * @return Checkpoint
+ * @throws RuntimeError If the stream does not hold a checkpoint of the current version, or ends prematurely
+ * @throws PreconditionError If the state in the checkpoint is invalid
+ */
+Herd::SSE::Checkpoint ReadCheckpoint( std::istream& io_rStream )
+{
+  std::array< char, s_Magic.size() > magic;
+  if( !io_rStream.read( magic.data(), magic.size() ) || magic != s_Magic )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Not a checkpoint" );
+  }
+
+  if( Read< uint32_t >( io_rStream ) != s_Version )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Unsupported checkpoint version" );
+  }
+
+  Herd::SSE::Checkpoint checkpoint;
+  VisitFields( checkpoint.m_State, [ &io_rStream ]< class TField >( TField& o_rField )
+  {
+    if constexpr( std::is_same_v< TField, double > )
+    {
+      o_rField = Read< double >( io_rStream );
+    } else
+    {
+      o_rField.Set( Read< double >( io_rStream ) );
+    }
+  } );
+  checkpoint.m_State.m_TrackPoint.m_Stage = Read< Herd::SSE::EvolutionStage >( io_rStream );
+
+  checkpoint.m_InitialMass.Set( Read< double >( io_rStream ) );
+  checkpoint.m_MainSequenceEvaluatedAt.Set( Read< double >( io_rStream ) );
+  checkpoint.m_Seed = Read< uint64_t >( io_rStream );
+
+  Herd::SSE::ValidateEvolutionState( checkpoint.m_State );
+
+  return checkpoint;
+}
+
+}
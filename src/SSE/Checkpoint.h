@@ -0,0 +1,42 @@
+/**
+ * @file Checkpoint.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef HBDC041C4_4C83_4E7C_915C_1A1E0A4EBEC9
+#define HBDC041C4_4C83_4E7C_915C_1A1E0A4EBEC9
+
+#include "EvolutionState.h"
+
+#include <Generic/Quantity.h>
+
+#include <cstdint>
+#include <iosfwd>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Everything needed to continue the evolution of a star from its last accepted step
+ * @remarks The metallicity-dependent computers are not included, as they are rebuilt from EvolutionState::m_TrackPoint
+ */
+struct Checkpoint
+{
+  Herd::SSE::EvolutionState m_State; ///< State at the last accepted step
+  Herd::Generic::Mass m_InitialMass; ///< Initial mass, for the convective envelope computer
+  Herd::Generic::Mass m_MainSequenceEvaluatedAt; ///< Mass at which the main sequence mass-dependent quantities are evaluated
+  uint_fast64_t m_Seed = 0; ///< Random number seed for the supernova kick
+};
+
+void WriteCheckpoint( const Herd::SSE::Checkpoint& i_rCheckpoint, std::ostream& io_rStream ); ///< Writes a checkpoint to a binary stream
+Herd::SSE::Checkpoint ReadCheckpoint( std::istream& io_rStream ); ///< Reads a checkpoint from a binary stream
+}
+
+#endif /* HBDC041C4_4C83_4E7C_915C_1A1E0A4EBEC9 */
@@ -0,0 +1,180 @@
+/**
+ * @file ColumnarTrajectory.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "ColumnarTrajectory.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+namespace
+{
+/**
+ * @param i_Field Field
+ * @return Index of the column for the field
+ */
+constexpr std::size_t ToIndex( Herd::SSE::TrackPointField i_Field )
+{
+  return static_cast< std::size_t >( i_Field );
+}
+}
+
+namespace Herd::SSE
+{
+
+using enum Herd::SSE::TrackPointField;
+
+/**
+ * @param i_TrackIndex Index of the track. Not stored
+ */
+void ColumnarTrajectory::Begin( [[maybe_unused]] std::size_t i_TrackIndex )
+{
+  clear();
+}
+
+/**
+ * @param i_rTrackPoint Track point
+ */
+void ColumnarTrajectory::Push( const Herd::SSE::TrackPoint& i_rTrackPoint )
+{
+  push_back( i_rTrackPoint );
+}
+
+void ColumnarTrajectory::End()
+{
+}
+
+void ColumnarTrajectory::clear()
+{
+  for( auto& rColumn : m_Columns )
+  {
+    rColumn.clear();
+  }
+
+  m_Stages.clear();
+}
+
+/**
+ * @param i_Capacity Number of track points
+ */
+void ColumnarTrajectory::reserve( std::size_t i_Capacity )
+{
+  for( auto& rColumn : m_Columns )
+  {
+    rColumn.reserve( i_Capacity );
+  }
+
+  m_Stages.reserve( i_Capacity );
+}
+
+/**
+ * @param i_rTrackPoint Track point
+ */
+void ColumnarTrajectory::push_back( const Herd::SSE::TrackPoint& i_rTrackPoint )
+{
+  m_Columns[ ToIndex( e_Mass ) ].push_back( i_rTrackPoint.m_Mass );
+  m_Columns[ ToIndex( e_InitialMetallicity ) ].push_back( i_rTrackPoint.m_InitialMetallicity );
+  m_Columns[ ToIndex( e_Radius ) ].push_back( i_rTrackPoint.m_Radius );
+  m_Columns[ ToIndex( e_Luminosity ) ].push_back( i_rTrackPoint.m_Luminosity );
+  m_Columns[ ToIndex( e_Temperature ) ].push_back( i_rTrackPoint.m_Temperature );
+  m_Columns[ ToIndex( e_Age ) ].push_back( i_rTrackPoint.m_Age );
+  m_Columns[ ToIndex( e_CoreMass ) ].push_back( i_rTrackPoint.m_CoreMass );
+  m_Columns[ ToIndex( e_EnvelopeMass ) ].push_back( i_rTrackPoint.m_EnvelopeMass );
+  m_Columns[ ToIndex( e_AngularVelocity ) ].push_back( i_rTrackPoint.m_AngularVelocity );
+
+  m_Stages.push_back( i_rTrackPoint.m_Stage );
+}
+
+/**
+ * @return Number of track points
+ */
+std::size_t ColumnarTrajectory::size() const
+{
+  return m_Stages.size();
+}
+
+/**
+ * @return \c true if the trajectory has no track points
+ */
+bool ColumnarTrajectory::empty() const
+{
+  return m_Stages.empty();
+}
+
+/**
+ * @param i_Index Index
+ * @return Track point at \c i_Index
+ * @pre \c i_Index is less than size()
+ * @throws PreconditionError If the precondition is violated
+ */
+Herd::SSE::TrackPoint ColumnarTrajectory::operator[]( std::size_t i_Index ) const
+{
+  if( i_Index >= size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Index", "<size()", i_Index );
+  }
+
+  Herd::SSE::TrackPoint trackPoint;
+  trackPoint.m_Mass.Set( m_Columns[ ToIndex( e_Mass ) ][ i_Index ] );
+  trackPoint.m_InitialMetallicity.Set( m_Columns[ ToIndex( e_InitialMetallicity ) ][ i_Index ] );
+  trackPoint.m_Radius.Set( m_Columns[ ToIndex( e_Radius ) ][ i_Index ] );
+  trackPoint.m_Luminosity.Set( m_Columns[ ToIndex( e_Luminosity ) ][ i_Index ] );
+  trackPoint.m_Temperature.Set( m_Columns[ ToIndex( e_Temperature ) ][ i_Index ] );
+  trackPoint.m_Age.Set( m_Columns[ ToIndex( e_Age ) ][ i_Index ] );
+  trackPoint.m_Stage = m_Stages[ i_Index ];
+  trackPoint.m_CoreMass.Set( m_Columns[ ToIndex( e_CoreMass ) ][ i_Index ] );
+  trackPoint.m_EnvelopeMass.Set( m_Columns[ ToIndex( e_EnvelopeMass ) ][ i_Index ] );
+  trackPoint.m_AngularVelocity.Set( m_Columns[ ToIndex( e_AngularVelocity ) ][ i_Index ] );
+
+  return trackPoint;
+}
+
+/**
+ * @return Last track point
+ * @pre The trajectory is not empty
+ * @throws PreconditionError If the precondition is violated
+ */
+Herd::SSE::TrackPoint ColumnarTrajectory::back() const
+{
+  if( empty() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "size()", ">0", "0" );
+  }
+
+  return ( *this )[ size() - 1 ];
+}
+
+/**
+ * @param i_Field Field
+ * @return Values of \c i_Field, in the order of the track points
+ * @pre \c i_Field is not \c e_Count
+ * @throws PreconditionError If the precondition is violated
+ * @remarks The span is invalidated by any modification to the trajectory
+ */
+std::span< const double > ColumnarTrajectory::Column( Herd::SSE::TrackPointField i_Field ) const
+{
+  if( i_Field == e_Count )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Field", "A track point field", "e_Count" );
+  }
+
+  return m_Columns[ ToIndex( i_Field ) ];
+}
+
+/**
+ * @return Evolution stages, in the order of the track points
+ * @remarks The span is invalidated by any modification to the trajectory
+ */
+std::span< const Herd::SSE::EvolutionStage > ColumnarTrajectory::Stages() const
+{
+  return m_Stages;
+}
+
+}
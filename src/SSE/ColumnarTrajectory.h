@@ -0,0 +1,79 @@
+/**
+ * @file ColumnarTrajectory.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H853801CD_6A49_40F8_A0F4_F7C776D53439
+#define H853801CD_6A49_40F8_A0F4_F7C776D53439
+
+#include "EvolutionStage.h"
+#include "ITrajectorySink.h"
+#include "TrackPoint.h"
+
+#include <array>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Numerical fields of a track point
+ */
+enum class TrackPointField
+{
+  e_Mass,  // TrackPoint::m_Mass
+  e_InitialMetallicity,  // TrackPoint::m_InitialMetallicity
+  e_Radius,  // TrackPoint::m_Radius
+  e_Luminosity,  // TrackPoint::m_Luminosity
+  e_Temperature,  // TrackPoint::m_Temperature
+  e_Age,  // TrackPoint::m_Age
+  e_CoreMass,  // TrackPoint::m_CoreMass
+  e_EnvelopeMass,  // TrackPoint::m_EnvelopeMass
+  e_AngularVelocity,  // TrackPoint::m_AngularVelocity
+  e_Count  // Number of fields
+};
+
+/**
+ * @brief Evolutionary track stored as one contiguous array per track point field
+ * @remarks Scanning a single field, e.g. luminosity against age, only touches the relevant columns
+ * @remarks Row access assembles a TrackPoint by value, so that the container can stand in for a \c std::vector<TrackPoint> in the existing callers
+ * @remarks As a sink, holds the most recent track
+ */
+class ColumnarTrajectory : public Herd::SSE::ITrajectorySink
+{
+public:
+
+  void Begin( std::size_t i_TrackIndex ) override; ///< Removes the previous track
+  void Push( const Herd::SSE::TrackPoint& i_rTrackPoint ) override; ///< Appends a track point
+  void End() override; ///< Ends the track
+
+  void clear(); ///< Removes all track points
+  void reserve( std::size_t i_Capacity ); ///< Reserves memory for track points
+  void push_back( const Herd::SSE::TrackPoint& i_rTrackPoint ); ///< Appends a track point
+
+  std::size_t size() const; ///< Number of track points
+  bool empty() const; ///< Whether there are no track points
+
+  Herd::SSE::TrackPoint operator[]( std::size_t i_Index ) const;  ///< Track point at an index
+  Herd::SSE::TrackPoint back() const; ///< Last track point
+
+  std::span< const double > Column( Herd::SSE::TrackPointField i_Field ) const; ///< Values of a field for all track points
+  std::span< const Herd::SSE::EvolutionStage > Stages() const; ///< Evolution stages for all track points
+
+private:
+
+  std::array< std::vector< double >, static_cast< std::size_t >( Herd::SSE::TrackPointField::e_Count ) > m_Columns; ///< Numerical fields, one column per field
+  std::vector< Herd::SSE::EvolutionStage > m_Stages;  ///< Evolution stages
+};
+}
+
+#endif /* H853801CD_6A49_40F8_A0F4_F7C776D53439 */
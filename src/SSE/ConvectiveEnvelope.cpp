@@ -19,6 +19,8 @@
 
 #include <Exceptions/ExceptionWrappers.h>
 #include <Generic/MathHelpers.h>
+#include <Generic/Profiling.h>
+#include <Generic/ValidationPolicy.h>
 #include <Physics/LuminosityRadiusTemperature.h>
 #include <SSE/Landmarks/BaseOfGiantBranch.h>
 #include <SSE/Landmarks/CriticalMassValues.h>
@@ -39,18 +41,19 @@ using Herd::Generic::ComputeBlendWeight;
 /**
  * @param i_MZAMS
  * @param i_Z Metallicity
+ * @param[in, out] io_pResource Memory resource for the landmark computers. Must outlive the object
  * @pre \c i_MZAMS>0
  */
-ConvectiveEnvelope::ConvectiveEnvelope( Herd::Generic::Mass i_MZAMS, Herd::Generic::Metallicity i_Z )
+ConvectiveEnvelope::ConvectiveEnvelope( Herd::Generic::Mass i_MZAMS, Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource )
 {
   Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_MZAMS, "MZAMS" );
 
-  m_ZDependents.m_pZAMSComputer = std::make_unique< Herd::SSE::ZeroAgeMainSequence >( i_Z );
-  m_ZDependents.m_pTMSComputer = std::make_unique< Herd::SSE::TerminalMainSequence >( i_Z );
-  m_ZDependents.m_pBGBComputer = std::make_unique< Herd::SSE::BaseOfGiantBranch >( i_Z );
-  m_ZDependents.m_pHeIComputer = std::make_unique< Herd::SSE::HeliumIgnition >( i_Z );
+  m_ZDependents.m_pZAMSComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::ZeroAgeMainSequence >( io_pResource, i_Z );
+  m_ZDependents.m_pTMSComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::TerminalMainSequence >( io_pResource, i_Z, io_pResource );
+  m_ZDependents.m_pBGBComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::BaseOfGiantBranch >( io_pResource, i_Z, io_pResource );
+  m_ZDependents.m_pHeIComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::HeliumIgnition >( io_pResource, i_Z );
 
-  m_ZDependents.m_pRgComputer = std::make_unique< Herd::SSE::RgComputer >( i_Z );
+  m_ZDependents.m_pRgComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::RgComputer >( io_pResource, i_Z, io_pResource );
 
   m_ZDependents.m_MFGB = Herd::SSE::ComputeMFGB( i_Z );
 
@@ -66,7 +69,12 @@ ConvectiveEnvelope::~ConvectiveEnvelope() = default;
  */
 ConvectiveEnvelope::Envelope ConvectiveEnvelope::Compute( const Herd::SSE::EvolutionState& i_rState )
 {
-  Herd::SSE::ValidateEvolutionState( i_rState );
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_ConvectiveEnvelope );
+
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    Herd::SSE::ValidateEvolutionState( i_rState );
+  }
 
   auto& rTrackPoint = i_rState.m_TrackPoint;
 
@@ -91,6 +99,30 @@ ConvectiveEnvelope::Envelope ConvectiveEnvelope::Compute( const Herd::SSE::Evolu
   return Output;
 }
 
+/**
+ * @param i_MZAMS Mass at ZAMS
+ * @pre \c i_MZAMS>0
+ * @remarks The metallicity-dependent computers are retained
+ */
+void ConvectiveEnvelope::Reset( Herd::Generic::Mass i_MZAMS )
+{
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_MZAMS, "MZAMS" );
+  m_MZAMS = i_MZAMS;
+}
+
+/**
+ * @return Total hit and miss counts of the mass caches of the ZAMS, TMS, BGB and HeI computers
+ * @remarks Accumulated over the lifetime of the object, across the stars
+ */
+Herd::SSE::MassCacheStatistics ConvectiveEnvelope::CacheStatistics() const
+{
+  Herd::SSE::MassCacheStatistics statistics = m_ZDependents.m_pZAMSComputer->CacheStatistics();
+  statistics += m_ZDependents.m_pTMSComputer->CacheStatistics();
+  statistics += m_ZDependents.m_pBGBComputer->CacheStatistics();
+  statistics += m_ZDependents.m_pHeIComputer->CacheStatistics();
+  return statistics;
+}
+
 /**
  * @param i_Mass Initial mass
  */
@@ -237,9 +269,8 @@ std::pair< double, double > ConvectiveEnvelope::ComputeMassAndRadius( const Herd
         //ComputeProximityToHayashi evaluated at teTMS
         Herd::Generic::Temperature teBGB = Herd::Physics::ComputeAbsoluteTemperature( lBGB, m_Rg );
 
-        Herd::Generic::Luminosity lTMS = m_ZDependents.m_pTMSComputer->Luminosity( rTrackPoint.m_Mass );
-        Herd::Generic::Radius rTMS = m_ZDependents.m_pTMSComputer->Radius( rTrackPoint.m_Mass );
-        Herd::Generic::Temperature teTMS = Herd::Physics::ComputeAbsoluteTemperature( lTMS, rTMS );
+        Herd::SSE::LandmarkValues tms = m_ZDependents.m_pTMSComputer->Evaluate( rTrackPoint.m_Mass );
+        Herd::Generic::Temperature teTMS = Herd::Physics::ComputeAbsoluteTemperature( tms.m_Luminosity, tms.m_Radius );
         double tauTMS = std::clamp( ComputeBlendWeight( teBGB / teTMS, m_M0Dependents.m_A, 1. ), 0., 1. );
 
         if( tauTMS > 0. )
@@ -248,7 +279,7 @@ std::pair< double, double > ConvectiveEnvelope::ComputeMassAndRadius( const Herd
           double mCEHG = MassRelation( tauTMS );
           double rCEHG = RadiusRelation( tauTMS );
 
-          double tau = i_rState.m_EffectiveAge / m_ZDependents.m_pTMSComputer->Age( rTrackPoint.m_Mass );
+          double tau = i_rState.m_EffectiveAge / tms.m_Age;
           double tauhy = std::pow( tau, m_M0Dependents.m_Y );
           mCE = m_M0Dependents.m_MCEZAMS + tauhy * mCE * ( 1. - m_M0Dependents.m_MCEZAMS / mCEHG );
           rCE = m_M0Dependents.m_RCEZAMS + tauhy * rCE * ( 1. - m_M0Dependents.m_RCEZAMS / rCEHG );
@@ -13,9 +13,13 @@
 #ifndef HAFD0B7BF_5E2F_47CD_A165_00F64B49B33F
 #define HAFD0B7BF_5E2F_47CD_A165_00F64B49B33F
 
+#include <SSE/Landmarks/MassCache.h>
+
+#include <Generic/Arena.h>
 #include <Generic/Quantity.h>
 
 #include <memory>
+#include <memory_resource>
 #include <utility>
 
 namespace Herd::SSE
@@ -40,7 +44,7 @@ class ConvectiveEnvelope
 {
 public:
 
-  ConvectiveEnvelope( Herd::Generic::Mass i_MZAMS, Herd::Generic::Metallicity i_Z );  ///< Constructor
+  ConvectiveEnvelope( Herd::Generic::Mass i_MZAMS, Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource = std::pmr::get_default_resource() );  ///< Constructor
   ~ConvectiveEnvelope();  ///< Destructor
 
   /**
@@ -55,18 +59,22 @@ public:
 
   Envelope Compute( const Herd::SSE::EvolutionState& i_rState );
 
+  void Reset( Herd::Generic::Mass i_MZAMS ); ///< Prepares the computer for a new star with the same metallicity
+
+  Herd::SSE::MassCacheStatistics CacheStatistics() const; ///< Returns the hit and miss counts of the mass caches of the landmark computers
+
 private:
   /**
    * @brief Components depending on the metallicity
    */
   struct MetallicityDependents
   {
-    std::unique_ptr< Herd::SSE::ZeroAgeMainSequence > m_pZAMSComputer;  ///< ZAMS computations
-    std::unique_ptr< Herd::SSE::TerminalMainSequence > m_pTMSComputer;  ///< TMS computations
-    std::unique_ptr< Herd::SSE::BaseOfGiantBranch > m_pBGBComputer; ///< BGB computations
-    std::unique_ptr< Herd::SSE::HeliumIgnition > m_pHeIComputer; ///< HeI computations
+    Herd::Generic::ArenaPtr< Herd::SSE::ZeroAgeMainSequence > m_pZAMSComputer;  ///< ZAMS computations
+    Herd::Generic::ArenaPtr< Herd::SSE::TerminalMainSequence > m_pTMSComputer;  ///< TMS computations
+    Herd::Generic::ArenaPtr< Herd::SSE::BaseOfGiantBranch > m_pBGBComputer; ///< BGB computations
+    Herd::Generic::ArenaPtr< Herd::SSE::HeliumIgnition > m_pHeIComputer; ///< HeI computations
 
-    std::unique_ptr< Herd::SSE::RgComputer > m_pRgComputer; ///< \fS R_g \fS computations
+    Herd::Generic::ArenaPtr< Herd::SSE::RgComputer > m_pRgComputer; ///< \fS R_g \fS computations
 
     Herd::Generic::Mass m_MFGB; ///< \f$ M_{FGB} \f$, maximum mass for a star to have a GB phase
   };
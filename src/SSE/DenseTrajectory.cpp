@@ -0,0 +1,162 @@
+/**
+ * @file DenseTrajectory.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "DenseTrajectory.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <range/v3/algorithm.hpp>
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_Trajectory Trajectory
+ * @pre \c i_Trajectory is not empty
+ * @pre The ages in \c i_Trajectory are non-decreasing
+ * @throws PreconditionError If any preconditions are violated
+ */
+DenseTrajectory::DenseTrajectory( Herd::SSE::ColumnarTrajectory i_Trajectory ) :
+    m_Trajectory( std::move( i_Trajectory ) )
+{
+  if( m_Trajectory.empty() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Trajectory.size()", ">0", "0" );
+  }
+
+  if( !ranges::cpp20::is_sorted( m_Trajectory.Column( Herd::SSE::TrackPointField::e_Age ) ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Trajectory", "Non-decreasing ages", "Decreasing ages" );
+  }
+}
+
+/**
+ * @param i_Age Age
+ * @return State at \c i_Age
+ * @pre \c i_Age is within [MinAge(), MaxAge()]
+ * @throws PreconditionError If the precondition is violated
+ * @remarks \f$ O(\log n) \f$ in the number of track points
+ */
+Herd::SSE::TrackPoint DenseTrajectory::At( Herd::Generic::Time i_Age ) const
+{
+  ValidateAge( i_Age );
+  return Evaluate( i_Age, FindTrackPoint( i_Age, 0 ) );
+}
+
+/**
+ * @param i_Ages Ages
+ * @return States at \c i_Ages, in the same order
+ * @pre Each element of \c i_Ages is within [MinAge(), MaxAge()]
+ * @throws PreconditionError If the precondition is violated
+ * @remarks When \c i_Ages is sorted, each search starts from the result of the previous one
+ */
+Herd::SSE::ColumnarTrajectory DenseTrajectory::At( std::span< const Herd::Generic::Time > i_Ages ) const
+{
+  for( auto age : i_Ages )
+  {
+    ValidateAge( age );
+  }
+
+  bool isSorted = ranges::cpp20::is_sorted( i_Ages );
+
+  Herd::SSE::ColumnarTrajectory states;
+  states.reserve( i_Ages.size() );
+
+  std::size_t index = 0;
+  for( auto age : i_Ages )
+  {
+    index = FindTrackPoint( age, isSorted ? index : 0 );
+    states.push_back( Evaluate( age, index ) );
+  }
+
+  return states;
+}
+
+/**
+ * @return Age of the first track point
+ */
+Herd::Generic::Time DenseTrajectory::MinAge() const
+{
+  return Herd::Generic::Time( m_Trajectory.Column( Herd::SSE::TrackPointField::e_Age ).front() );
+}
+
+/**
+ * @return Age of the last track point
+ */
+Herd::Generic::Time DenseTrajectory::MaxAge() const
+{
+  return Herd::Generic::Time( m_Trajectory.Column( Herd::SSE::TrackPointField::e_Age ).back() );
+}
+
+/**
+ * @return Stored trajectory
+ */
+const Herd::SSE::ColumnarTrajectory& DenseTrajectory::Trajectory() const
+{
+  return m_Trajectory;
+}
+
+/**
+ * @param i_Age Age
+ * @pre \c i_Age is within [MinAge(), MaxAge()]
+ * @throws PreconditionError If the precondition is violated
+ */
+void DenseTrajectory::ValidateAge( Herd::Generic::Time i_Age ) const
+{
+  if( !( i_Age >= MinAge() && i_Age <= MaxAge() ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Age", "Within [MinAge(), MaxAge()]", i_Age.Value() );
+  }
+}
+
+/**
+ * @param i_Age Age
+ * @param i_First Index of the first track point to search
+ * @return Index of the last track point whose age is not greater than \c i_Age
+ * @pre \c i_Age is not less than the age of the track point at \c i_First
+ */
+std::size_t DenseTrajectory::FindTrackPoint( Herd::Generic::Time i_Age, std::size_t i_First ) const
+{
+  auto ages = m_Trajectory.Column( Herd::SSE::TrackPointField::e_Age );
+  auto itUpper = std::upper_bound( std::next( ages.begin(), i_First ), ages.end(), i_Age.Value() );
+  return std::distance( ages.begin(), itUpper ) - 1;
+}
+
+/**
+ * @param i_Age Age
+ * @param i_Index Index of the last track point whose age is not greater than \c i_Age
+ * @return State at \c i_Age
+ */
+Herd::SSE::TrackPoint DenseTrajectory::Evaluate( Herd::Generic::Time i_Age, std::size_t i_Index ) const
+{
+  Herd::SSE::TrackPoint from = m_Trajectory[ i_Index ];
+  if( from.m_Age == i_Age )
+  {
+    return from;
+  }
+
+  // Not the last track point, as i_Age is greater than the age of the track point, and not greater than MaxAge()
+  auto stages = m_Trajectory.Stages();
+  if( stages[ i_Index + 1 ] != from.m_Stage )
+  {
+    from.m_Age = i_Age;
+    return from;
+  }
+
+  return Herd::SSE::InterpolateTrackPoints( from, m_Trajectory[ i_Index + 1 ], i_Age );
+}
+
+}
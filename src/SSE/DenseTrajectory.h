@@ -0,0 +1,56 @@
+/**
+ * @file DenseTrajectory.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H50A2AF01_5256_4F30_82E2_D0E60BD2F700
+#define H50A2AF01_5256_4F30_82E2_D0E60BD2F700
+
+#include "ColumnarTrajectory.h"
+#include "TrackPoint.h"
+
+#include <Generic/Quantity.h>
+
+#include <cstddef>
+#include <span>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Random-access queries of the state of a star at arbitrary ages, from a stored trajectory
+ * @remarks A query locates the enclosing pair of track points by binary search, and interpolates linearly in age
+ * @remarks Interpolation never crosses a stage change. Between the last track point of a stage and the first track point of the next, the former is held
+ * @remarks The accuracy is that of the stored track points. Trajectories thinned by an OutputPolicy other than OutputPolicy::e_EveryStep are interpolated over the dropped steps
+ */
+class DenseTrajectory
+{
+public:
+
+  explicit DenseTrajectory( Herd::SSE::ColumnarTrajectory i_Trajectory ); ///< Constructor
+
+  Herd::SSE::TrackPoint At( Herd::Generic::Time i_Age ) const; ///< State at an age
+  Herd::SSE::ColumnarTrajectory At( std::span< const Herd::Generic::Time > i_Ages ) const; ///< States at a number of ages
+
+  Herd::Generic::Time MinAge() const; ///< Age of the first track point
+  Herd::Generic::Time MaxAge() const; ///< Age of the last track point
+  const Herd::SSE::ColumnarTrajectory& Trajectory() const; ///< Accessor for DenseTrajectory::m_Trajectory
+
+private:
+
+  void ValidateAge( Herd::Generic::Time i_Age ) const; ///< Throws if an age is outside of the trajectory
+  std::size_t FindTrackPoint( Herd::Generic::Time i_Age, std::size_t i_First ) const; ///< Finds the last track point not later than an age
+  Herd::SSE::TrackPoint Evaluate( Herd::Generic::Time i_Age, std::size_t i_Index ) const; ///< Evaluates the state at an age, from the track point before it
+
+  Herd::SSE::ColumnarTrajectory m_Trajectory; ///< Stored trajectory
+};
+}
+
+#endif /* H50A2AF01_5256_4F30_82E2_D0E60BD2F700 */
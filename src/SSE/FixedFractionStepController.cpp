@@ -0,0 +1,46 @@
+/**
+ * @file FixedFractionStepController.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "FixedFractionStepController.h"
+
+namespace Herd::SSE
+{
+
+/**
+ * @remarks Stateless
+ */
+void FixedFractionStepController::Reset()
+{
+}
+
+/**
+ * @param i_rState State
+ * @param i_BaseTimestep Fixed fraction of the duration of the phase
+ * @return \c i_BaseTimestep
+ */
+Herd::Generic::Time FixedFractionStepController::Propose( [[maybe_unused]] const Herd::SSE::EvolutionState& i_rState, Herd::Generic::Time i_BaseTimestep )
+{
+  return i_BaseTimestep;
+}
+
+/**
+ * @param i_rPrevious Track point before the step
+ * @param i_rCurrent Track point after the step
+ * @param i_DeltaT Size of the step
+ * @remarks Stateless
+ */
+void FixedFractionStepController::Accept( [[maybe_unused]] const Herd::SSE::TrackPoint& i_rPrevious, [[maybe_unused]] const Herd::SSE::TrackPoint& i_rCurrent,
+    [[maybe_unused]] Herd::Generic::Time i_DeltaT )
+{
+}
+
+}
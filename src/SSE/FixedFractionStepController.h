@@ -0,0 +1,35 @@
+/**
+ * @file FixedFractionStepController.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H231DDD81_1F71_42D0_8072_F0974C15BC72
+#define H231DDD81_1F71_42D0_8072_F0974C15BC72
+
+#include "IStepController.h"
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Proposes a fixed fraction of the duration of the phase
+ * @remarks The fraction is set per stage by SingleStarEvolutuion::Parameters::m_RelativeTimeStepSizes
+ */
+class FixedFractionStepController : public Herd::SSE::IStepController
+{
+public:
+
+  void Reset() override; ///< Discards the history of the previous star
+  Herd::Generic::Time Propose( const Herd::SSE::EvolutionState& i_rState, Herd::Generic::Time i_BaseTimestep ) override; ///< Proposes the size of the next timestep
+  void Accept( const Herd::SSE::TrackPoint& i_rPrevious, const Herd::SSE::TrackPoint& i_rCurrent, Herd::Generic::Time i_DeltaT ) override; ///< Updates the controller with an accepted step
+};
+}
+
+#endif /* H231DDD81_1F71_42D0_8072_F0974C15BC72 */
@@ -16,12 +16,15 @@
 #include "EvolutionStage.h"
 #include <Generic/Quantity.h>
 
+#include <concepts>
+
 namespace Herd::SSE
 {
 struct EvolutionState;
 
 /**
  * @brief Interface class for updating the star state in an evolution phase
+ * @remarks The evolution loop dispatches statically on the concrete phases, which are \c final. The interface is an adapter for the callers that hold a phase of any type
  */
 class IPhase
 {
@@ -32,6 +35,17 @@ public:
   virtual Herd::Generic::Time EndsAt() const = 0;  ///< End of the phase
 
 };
+
+/**
+ * @brief An evolution phase, for static dispatch
+ * @remarks Satisfied by IPhase and by its implementations
+ */
+template< class T >
+concept Phase = requires( T& io_rPhase, const T& i_rPhase, EvolutionState& io_rState )
+{
+  { io_rPhase.Evolve( io_rState ) } -> std::same_as< Herd::SSE::EvolutionStage >;
+  { i_rPhase.EndsAt() } -> std::same_as< Herd::Generic::Time >;
+};
 }
 
 #endif /* H99A0DCEA_0F0C_4875_BF2A_E2F9CA5E4BAC */
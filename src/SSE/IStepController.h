@@ -0,0 +1,47 @@
+/**
+ * @file IStepController.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H47FD4A34_3985_41FB_8847_A90D477ECE8F
+#define H47FD4A34_3985_41FB_8847_A90D477ECE8F
+
+#include <Generic/Quantity.h>
+
+namespace Herd::SSE
+{
+struct EvolutionState;
+struct TrackPoint;
+
+/**
+ * @brief Timestep controllers
+ */
+enum class StepControl
+{
+  e_FixedFraction, // FixedFractionStepController
+  e_PI // PIStepController
+};
+
+/**
+ * @brief Interface class for proposing the timesteps
+ * @remarks The proposal is an upper bound. The radius and the mass change limits are enforced after the proposal
+ */
+class IStepController
+{
+public:
+  virtual ~IStepController() = default;
+
+  virtual void Reset() = 0; ///< Discards the history of the previous star
+  virtual Herd::Generic::Time Propose( const Herd::SSE::EvolutionState& i_rState, Herd::Generic::Time i_BaseTimestep ) = 0;  ///< Proposes the size of the next timestep
+  virtual void Accept( const Herd::SSE::TrackPoint& i_rPrevious, const Herd::SSE::TrackPoint& i_rCurrent, Herd::Generic::Time i_DeltaT ) = 0; ///< Updates the controller with an accepted step
+};
+}
+
+#endif /* H47FD4A34_3985_41FB_8847_A90D477ECE8F */
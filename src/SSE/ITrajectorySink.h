@@ -0,0 +1,39 @@
+/**
+ * @file ITrajectorySink.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef HCD15FB21_B637_4658_8719_7B6C713B9C20
+#define HCD15FB21_B637_4658_8719_7B6C713B9C20
+
+#include <cstddef>
+
+namespace Herd::SSE
+{
+struct TrackPoint;
+
+/**
+ * @brief Receives the stored track points of evolving stars
+ * @remarks SingleStarEvolutuion calls Push for each track point selected by the output policy. The caller of SingleStarEvolutuion::Evolve brackets each star with Begin and End, as only the caller knows the identity of the star
+ * @remarks A sink is used by one thread at a time
+ */
+class ITrajectorySink
+{
+public:
+
+  virtual void Begin( std::size_t i_TrackIndex ) = 0; ///< Starts the trajectory of a star
+  virtual void Push( const Herd::SSE::TrackPoint& i_rTrackPoint ) = 0; ///< Receives a track point
+  virtual void End() = 0; ///< Ends the trajectory of the current star
+
+  virtual ~ITrajectorySink() = default;
+};
+}
+
+#endif /* HCD15FB21_B637_4658_8719_7B6C713B9C20 */
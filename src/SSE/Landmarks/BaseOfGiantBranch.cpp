@@ -14,12 +14,17 @@
 
 #include "Constants.h"
 #include "GiantBranchRadius.h"
+#include "MetallicityCache.h"
 #include "Utilities.h"
 
+#include <Exceptions/ExceptionWrappers.h>
 #include <Exceptions/PreconditionError.h>
 #include <Generic/MathHelpers.h>
+#include <Generic/Profiling.h>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include <range/v3/algorithm.hpp>
 
@@ -27,7 +32,7 @@ namespace
 {
 // @formatter:off
 
-const std::array< double, 20 > s_ZTBGB { 1.593890e+03, 2.053038e+03, 1.231226e+03, 2.327785e+02,
+constexpr std::array< double, 20 > s_ZTBGB { 1.593890e+03, 2.053038e+03, 1.231226e+03, 2.327785e+02,
   2.706708e+03, 1.483131e+03, 5.772723e+02, 7.411230e+01,
   1.466143e+02, -1.048442e+02, -6.795374e+01, -1.391127e+01,
   4.141960e-02, 4.564888e-02, 2.958542e-02, 5.571483e-03,
@@ -35,7 +40,7 @@ const std::array< double, 20 > s_ZTBGB { 1.593890e+03, 2.053038e+03, 1.231226e+0
 };  ///< Coefficients for \f${ t_{BGB}(z) \f$ calculations
 
 
-const std::array< double, 24 > s_ZLBGB { 9.511033e+01, 6.819618e+01, -1.045625e+01, -1.474939e+01,
+constexpr std::array< double, 24 > s_ZLBGB { 9.511033e+01, 6.819618e+01, -1.045625e+01, -1.474939e+01,
   3.113458e+01, 1.012033e+01, -4.650511e+00, -2.463185e+00,
     1.413057e+00, 4.578814e-01, -6.850581e-02, -5.588658e-02,
     3.910862e+01, 5.196646e+01, 2.264970e+01, 2.873680e+00,
@@ -51,14 +56,16 @@ namespace Herd::SSE
 
 /**
  * @param i_Z Metallicity
+ * @param[in, out] io_pResource Memory resource for the landmark computers. Must outlive the object
  * @pre \c \c i_Z is positive
  * @throws PreconditionError If the precondition is violated
  */
-BaseOfGiantBranch::BaseOfGiantBranch( Herd::Generic::Metallicity i_Z )
+BaseOfGiantBranch::BaseOfGiantBranch( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource )
 {
   Herd::Generic::ThrowIfNotPositive( i_Z, "i_Z" );
 
-  ComputeMetallicityDependents( i_Z );
+  m_ZDependents.m_pCoefficients = Herd::SSE::MetallicityCache::Get< Coefficients >( i_Z, &BaseOfGiantBranch::ComputeCoefficients );
+  m_ZDependents.m_pRGBComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::GiantBranchRadius >( io_pResource, i_Z );
 }
 
 /**
@@ -74,10 +81,12 @@ BaseOfGiantBranch::~BaseOfGiantBranch() = default;
  */
 Herd::Generic::Time BaseOfGiantBranch::Age( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkAge );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Age, i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Age.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
     // @formatter:on
 }
 
@@ -89,10 +98,12 @@ Herd::Generic::Time BaseOfGiantBranch::Age( Herd::Generic::Mass i_Mass )
  */
 Herd::Generic::Luminosity BaseOfGiantBranch::Luminosity( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkLuminosity );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Luminosity, i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);} ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Luminosity.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);} ); // @suppress("Invalid arguments")
       // @formatter:on
 }
 
@@ -104,17 +115,102 @@ Herd::Generic::Luminosity BaseOfGiantBranch::Luminosity( Herd::Generic::Mass i_M
  */
 Herd::Generic::Radius BaseOfGiantBranch::Radius( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkRadius );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Radius, i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass); } ); // @suppress("Invalid arguments")
+  auto LuminosityComputer = [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);};
+  return m_MDependents.m_Radius.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass, m_MDependents.m_Luminosity.Get( i_Mass, LuminosityComputer ) ); } ); // @suppress("Invalid arguments")
       // @formatter:on
 }
 
+/**
+ * @param i_Mass Mass
+ * @returns \f$ t_{BGB}\f$, \f$ L_{BGB}\f$ and \f$ R_{BGB}\f$
+ * @pre \c i_Mass is positive
+ * @throws PreconditionError If the precondition is violated
+ * @remarks The quantities are cached separately, as \f$ t_{BGB} \f$ is often needed on its own. \f$ R_{BGB} \f$ is computed from the cached \f$ L_{BGB} \f$, which is the only shared intermediate
+ */
+Herd::SSE::LandmarkValues BaseOfGiantBranch::Evaluate( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkEvaluate );
+
+  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+
+  Herd::SSE::LandmarkValues values;
+
+  // @formatter:off
+  values.m_Age = m_MDependents.m_Age.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
+  values.m_Luminosity = m_MDependents.m_Luminosity.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);} ); // @suppress("Invalid arguments")
+  values.m_Radius = m_MDependents.m_Radius.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass, values.m_Luminosity ); } ); // @suppress("Invalid arguments")
+  // @formatter:on
+
+  return values;
+}
+
+/**
+ * @return Masses at which the landmark functions are not smooth. None for BGB
+ */
+std::vector< Herd::Generic::Mass > BaseOfGiantBranch::Breakpoints() const
+{
+  return {};
+}
+
+/**
+ * @return Total hit and miss counts of the mass caches
+ */
+Herd::SSE::MassCacheStatistics BaseOfGiantBranch::CacheStatistics() const
+{
+  Herd::SSE::MassCacheStatistics statistics;
+  statistics += m_MDependents.m_Age.Statistics();
+  statistics += m_MDependents.m_Luminosity.Statistics();
+  statistics += m_MDependents.m_Radius.Statistics();
+  return statistics;
+}
+
+/**
+ * @param i_Masses Masses
+ * @param[out] o_Ages \f$ t_{BGB} \f$ for each mass. Caller-allocated
+ * @pre Each element of \c i_Masses is positive
+ * @pre \c o_Ages has the same size as \c i_Masses
+ * @throws PreconditionError If any preconditions are violated
+ * @remarks Does not use or update the cache of the single-mass interface
+ */
+void BaseOfGiantBranch::Compute( std::span< const double > i_Masses, std::span< double > o_Ages ) const
+{
+  if( o_Ages.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_Ages", "Same size as i_Masses", o_Ages.size() );
+  }
+
+  Herd::SSE::ThrowIfAnyNotInRange( i_Masses, std::numeric_limits< double >::denorm_min(), std::numeric_limits< double >::infinity(), "i_Masses", ">0" );
+
+  const auto& rA = m_ZDependents.m_pCoefficients->m_TBGB;
+
+  using TBlock = Herd::SSE::TBatchBlock;
+  for( std::size_t offset = 0; offset < i_Masses.size(); offset += s_BatchBlockSize )
+  {
+    Eigen::Index blockSize = std::min< Eigen::Index >( s_BatchBlockSize, i_Masses.size() - offset );
+    Eigen::Map< const Eigen::ArrayXd > mass( i_Masses.data() + offset, blockSize );
+
+    TBlock m05 = mass.sqrt();
+    TBlock m20 = mass * mass;
+    TBlock m40 = m20 * m20;
+    TBlock m50 = m40 * mass;
+    TBlock m70 = m50 * m20;
+
+    // Eq. 4
+    Eigen::Map< Eigen::ArrayXd >( o_Ages.data() + offset, blockSize ) = ( rA[ 0 ] + rA[ 1 ] * m40 + rA[ 2 ] * ( m50 * m05 ) + m70 )
+        / ( rA[ 3 ] * m20 + rA[ 4 ] * m70 );
+  }
+}
+
 /**
  * @param i_Z Metallicity
+ * @return Coefficients
  */
-void BaseOfGiantBranch::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z )
+BaseOfGiantBranch::Coefficients BaseOfGiantBranch::ComputeCoefficients( Herd::Generic::Metallicity i_Z )
 {
   Herd::Generic::Metallicity relativeZ( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 ); // Metallicity relative to the Sun
 
@@ -122,21 +218,22 @@ void BaseOfGiantBranch::ComputeMetallicityDependents( Herd::Generic::Metallicity
   double zeta = std::log10( relativeZ );
   Herd::Generic::ComputePowers( zetaPowers3, zeta );
 
+  Coefficients coefficients;
+
   // TBGB
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_TBGB, s_ZTBGB, zetaPowers3 );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_TBGB, s_ZTBGB, zetaPowers3 );
 
   // LBGB
   std::array< double, 6 > tempLBGB;
   Herd::Generic::MultiplyMatrixVector( tempLBGB, s_ZLBGB, zetaPowers3 );
-  ranges::cpp20::copy( tempLBGB, m_ZDependents.m_LBGB.begin() );
+  ranges::cpp20::copy( tempLBGB, coefficients.m_LBGB.begin() );
 
-  auto& rB = m_ZDependents.m_LBGB;
+  auto& rB = coefficients.m_LBGB;
   rB[ 2 ] = std::pow( rB[ 2 ], rB[ 5 ] );
   rB[ 6 ] = 4.637345e+00;
   rB[ 7 ] = 9.301992e+00;
 
-  // RBGB
-  m_ZDependents.m_pRGBComputer = std::make_unique< Herd::SSE::GiantBranchRadius >( i_Z );
+  return coefficients;
 }
 
 /**
@@ -146,7 +243,7 @@ void BaseOfGiantBranch::ComputeMetallicityDependents( Herd::Generic::Metallicity
 Herd::Generic::Time BaseOfGiantBranch::ComputeAge( Herd::Generic::Mass i_Mass ) const
 {
   // Eq. 4
-  const auto& rA = m_ZDependents.m_TBGB;
+  const auto& rA = m_ZDependents.m_pCoefficients->m_TBGB;
 
   double m05 = std::sqrt( i_Mass );
   double m20 = i_Mass * i_Mass;
@@ -158,7 +255,7 @@ Herd::Generic::Time BaseOfGiantBranch::ComputeAge( Herd::Generic::Mass i_Mass )
   massPowersNum[ 2 ] = m50 * m05; // m^5.5
   massPowersNum[ 3 ] = m50 * m20;  // m^7
 
-  std::array< double, 4 > massPowersDen;
+  std::array< double, 4 > massPowersDen {}; // The last two elements are multiplied by 0 in the inner product, but must not be NaN
   massPowersDen[ 0 ] = m20;
   massPowersDen[ 1 ] = massPowersNum[ 3 ]; // m^7
 
@@ -174,7 +271,7 @@ Herd::Generic::Time BaseOfGiantBranch::ComputeAge( Herd::Generic::Mass i_Mass )
  */
 Herd::Generic::Luminosity BaseOfGiantBranch::ComputeLuminosity( Herd::Generic::Mass i_Mass ) const
 {
-  auto& rB = m_ZDependents.m_LBGB;
+  auto& rB = m_ZDependents.m_pCoefficients->m_LBGB;
 
   // Eq. 10
   double num = Herd::Generic::BXhC( i_Mass, rB[ 0 ], rB[ 4 ] ) + BXhC( i_Mass, rB[ 1 ], rB[ 7 ] );
@@ -184,11 +281,12 @@ Herd::Generic::Luminosity BaseOfGiantBranch::ComputeLuminosity( Herd::Generic::M
 
 /**
  * @param i_Mass Mass
+ * @param i_Luminosity \f$ L_{BGB}\f$ at \c i_Mass
  * @return \f$ R_{BGB}\f$
  */
-Herd::Generic::Radius BaseOfGiantBranch::ComputeRadius( Herd::Generic::Mass i_Mass ) const
+Herd::Generic::Radius BaseOfGiantBranch::ComputeRadius( Herd::Generic::Mass i_Mass, Herd::Generic::Luminosity i_Luminosity ) const
 {
-  return m_ZDependents.m_pRGBComputer->Compute( i_Mass, ComputeLuminosity( i_Mass ) );
+  return m_ZDependents.m_pRGBComputer->Compute( i_Mass, i_Luminosity );
 }
 
 }
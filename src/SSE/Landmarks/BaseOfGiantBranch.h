@@ -14,13 +14,16 @@
 #define H0A6D735C_7542_4D2B_9796_8E32EEB127F1
 
 #include "ILandmark.h"
+#include "MassCache.h"
 
+#include <Generic/Arena.h>
 #include <Generic/Quantity.h>
 
 #include <array>
 #include <memory>
-#include <optional>
-#include <utility>
+#include <memory_resource>
+#include <span>
+#include <vector>
 
 namespace Herd::SSE
 {
@@ -31,34 +34,49 @@ class GiantBranchRadius;
  * @brief Computations for characteristic properties at BGB
  * @cite Hurley00
  */
-class BaseOfGiantBranch : public Herd::SSE::ILandmark
+class BaseOfGiantBranch final : public Herd::SSE::ILandmark
 {
 public:
 
-  BaseOfGiantBranch( Herd::Generic::Metallicity i_Z ); ///< Constructor
+  BaseOfGiantBranch( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource = std::pmr::get_default_resource() ); ///< Constructor
   ~BaseOfGiantBranch(); ///< Destructor
 
   Herd::Generic::Time Age( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{BGB} \f$
   Herd::Generic::Luminosity Luminosity( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ L_{BGB} \f$
   Herd::Generic::Radius Radius( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ R_{BGB} \f$
+  Herd::SSE::LandmarkValues Evaluate( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{BGB} \f$, \f$ L_{BGB} \f$ and \f$ R_{BGB} \f$
+
+  std::vector< Herd::Generic::Mass > Breakpoints() const override; ///< Returns the masses at which the landmark functions are not smooth
+  Herd::SSE::MassCacheStatistics CacheStatistics() const override; ///< Returns the hit and miss counts of the mass caches
+
+  void Compute( std::span< const double > i_Masses, std::span< double > o_Ages ) const; ///< Computes \f$ t_{BGB} \f$ for a batch of masses
 
 private:
 
-  void ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z ); ///< Computes various metallicity-dependent quantities
+  /**
+   * @brief Equation coefficients that depend on the metallicity only
+   * @remarks Shared via MetallicityCache
+   */
+  struct Coefficients
+  {
+    std::array< double, 5 > m_TBGB; ///< \f$ t_{BGB} \f$ calculations
+    std::array< double, 8 > m_LBGB;  ///< \f$ L_{BGB} \f$ calculations
+  };
+
+  static Coefficients ComputeCoefficients( Herd::Generic::Metallicity i_Z ); ///< Computes the metallicity-dependent coefficients
 
   Herd::Generic::Time ComputeAge( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ t_{BGB}\f$
   Herd::Generic::Luminosity ComputeLuminosity( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ L_{BGB} \f$
-  Herd::Generic::Radius ComputeRadius( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ R_{BGB} \f$
+  Herd::Generic::Radius ComputeRadius( Herd::Generic::Mass i_Mass, Herd::Generic::Luminosity i_Luminosity ) const;  ///< Computes \f$ R_{BGB} \f$
 
   /**
    * @brief Various quantities and values that depend on metallicity only
    */
   struct MetallicityDependents
   {
-    std::array< double, 5 > m_TBGB; ///< \f$ t_{BGB} \f$ calculations
-    std::array< double, 8 > m_LBGB;  ///< \f$ L_{BGB} \f$ calculations
+    std::shared_ptr< const Coefficients > m_pCoefficients; ///< Equation coefficients
 
-    std::unique_ptr< Herd::SSE::GiantBranchRadius > m_pRGBComputer; ///< Computes the giant branch radius
+    Herd::Generic::ArenaPtr< Herd::SSE::GiantBranchRadius > m_pRGBComputer; ///< Computes the giant branch radius
   };
 
   MetallicityDependents m_ZDependents;  ///< Metallicity-dependent quantities
@@ -69,11 +87,9 @@ private:
    */
   struct MassDependents
   {
-    using TKey = std::optional< Herd::Generic::Mass >;
-
-    std::pair< TKey, Herd::Generic::Time > m_Age; ///< \f$ t_{BGB} \f$
-    std::pair< TKey, Herd::Generic::Luminosity > m_Luminosity; ///< \f$ L_{BGB}\f$
-    std::pair< TKey, Herd::Generic::Radius > m_Radius;  ///< \f$ R_{BGB} \f$
+    Herd::SSE::MassCache< Herd::Generic::Time > m_Age; ///< \f$ t_{BGB} \f$
+    Herd::SSE::MassCache< Herd::Generic::Luminosity > m_Luminosity; ///< \f$ L_{BGB}\f$
+    Herd::SSE::MassCache< Herd::Generic::Radius > m_Radius;  ///< \f$ R_{BGB} \f$
   };
 
   MassDependents m_MDependents; ///< Mass-dependent quantities
@@ -13,10 +13,14 @@
 #ifndef H4BB1EA9B_933C_43CA_A1BA_11FDF79810E0
 #define H4BB1EA9B_933C_43CA_A1BA_11FDF79810E0
 
+#include <array>
+
 namespace Herd::SSE::Constants
 {
 inline constexpr double s_SunSurfaceTemperatureSSE = 5797.885;  ///< Surface temperature of the sun in K in AMUSE.SSE (evolve.f, L266 1000*(1130)^0.25)
 inline constexpr double s_SolarMetallicityTout96 = 0.02;  ///< Z value for the Sun in Tout96
+inline constexpr std::array< double, 5 > s_CanonicalMetallicities { 0.02, 0.008, 0.004, 0.001, 0.0001 }; ///< Metallicities of the commonly used grids. Their coefficients are retained by MetallicityCache
+inline constexpr std::array< double, 3 > s_MetallicityBranchPoints { 0.0009, 0.004, 0.01 }; ///< Metallicities at which the fitting formulae switch branches
 }
 
 
@@ -14,6 +14,7 @@
 
 #include <Generic/MathHelpers.h>
 #include <SSE/Landmarks/Constants.h>
+#include <SSE/Landmarks/MetallicityCache.h>
 
 #include <algorithm>
 #include <cmath>
@@ -26,7 +27,7 @@ namespace
 
 // @formatter:off
 
-std::array< double, 24 > s_ZRGB { 9.960283e-01, 8.164393e-01, 2.383830e+00, 2.223436e+00, 8.638115e-01, 1.231572e-01,
+constexpr std::array< double, 24 > s_ZRGB { 9.960283e-01, 8.164393e-01, 2.383830e+00, 2.223436e+00, 8.638115e-01, 1.231572e-01,
   2.561062e-01, 7.072646e-02, -5.444596e-02, -5.798167e-02, -1.349129e-02, 0.,
   1.157338e+00, 1.467883e+00, 4.299661e+00, 3.130500e+00, 6.992080e-01, 1.640687e-02,
   4.022765e-01, 3.050010e-01, 9.962137e-01, 7.914079e-01, 1.728098e-01, 0.
@@ -52,6 +53,18 @@ GiantBranchRadius::GiantBranchRadius( Herd::Generic::Metallicity i_Z )
   m_A.first.Set( 0. );
   m_A.second = 0.;
 
+  m_pCoefficients = Herd::SSE::MetallicityCache::Get< Coefficients >( i_Z, &GiantBranchRadius::ComputeCoefficients );
+}
+
+/**
+ * @param i_Z Initial metallicity
+ * @return Coefficients
+ */
+GiantBranchRadius::Coefficients GiantBranchRadius::ComputeCoefficients( Herd::Generic::Metallicity i_Z )
+{
+  Coefficients coefficients;
+  auto& rB = coefficients.m_B;
+
   std::array< double, 6 > zetaPowers5;
   double zeta = std::log10( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 );
   Herd::Generic::ComputePowers( zetaPowers5, zeta );
@@ -60,22 +73,24 @@ GiantBranchRadius::GiantBranchRadius( Herd::Generic::Metallicity i_Z )
   ranges::cpp20::copy_n( zetaPowers5.begin(), 3, zetaPowers2.begin() );
 
   double logZ = std::log10( i_Z );
-  m_B[ 0 ] = std::max( std::pow( 10., -4.6739 - 0.9394 * logZ ), -0.04167 + 55.67 * i_Z );
-  m_B[ 0 ] = std::min( m_B[ 0 ], 0.4771 - BXhC( i_Z, 9329.21, 2.94 ) );
+  rB[ 0 ] = std::max( std::pow( 10., -4.6739 - 0.9394 * logZ ), -0.04167 + 55.67 * i_Z );
+  rB[ 0 ] = std::min( rB[ 0 ], 0.4771 - BXhC( i_Z, 9329.21, 2.94 ) );
 
-  m_B[ 1 ] = std::min( 0.54, Herd::Generic::ComputeInnerProduct( { 0.397, 0.28826, 0.5293 }, zetaPowers2 ) );
+  rB[ 1 ] = std::min( 0.54, Herd::Generic::ComputeInnerProduct( { 0.397, 0.28826, 0.5293 }, zetaPowers2 ) );
 
   {
-    m_B[ 2 ] = std::pow( 10., std::max( -0.1451, -2.2794 - 1.5175 * logZ - 0.254 * logZ * logZ ) );
+    rB[ 2 ] = std::pow( 10., std::max( -0.1451, -2.2794 - 1.5175 * logZ - 0.254 * logZ * logZ ) );
     if( i_Z > 0.004 )
     {
-      m_B[ 2 ] = std::max( m_B[ 2 ], ApBXhC( i_Z, 0.7307, 14265.1, 3.395 ) );
+      rB[ 2 ] = std::max( rB[ 2 ], ApBXhC( i_Z, 0.7307, 14265.1, 3.395 ) );
     }
   }
 
   std::array< double, 4 > tempB;
   Herd::Generic::MultiplyMatrixVector( tempB, s_ZRGB, zetaPowers5 );
-  ranges::cpp20::copy( tempB, std::next( m_B.begin(), 3 ) ); // @suppress("Invalid arguments")
+  ranges::cpp20::copy( tempB, std::next( rB.begin(), 3 ) ); // @suppress("Invalid arguments")
+
+  return coefficients;
 }
 
 /**
@@ -91,13 +106,14 @@ Herd::Generic::Radius GiantBranchRadius::Compute( Herd::Generic::Mass i_Mass, He
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
   Herd::Generic::ThrowIfNotPositive( i_Luminosity, "i_Luminosity" );
 
+  const auto& rB = m_pCoefficients->m_B;
   if( i_Mass != m_A.first )
   {
     m_A.first = i_Mass;
-    m_A.second = std::min( BXhC( i_Mass, m_B[ 3 ], -m_B[ 4 ] ), BXhC( i_Mass, m_B[ 5 ], -m_B[ 6 ] ) );  // Eq. 46
+    m_A.second = std::min( BXhC( i_Mass, rB[ 3 ], -rB[ 4 ] ), BXhC( i_Mass, rB[ 5 ], -rB[ 6 ] ) );  // Eq. 46
   }
 
-  return Herd::Generic::Radius( m_A.second * ( std::pow( i_Luminosity, m_B[ 1 ] ) + BXhC( i_Luminosity, m_B[ 0 ], m_B[ 2 ] ) ) ); // Eq. 46
+  return Herd::Generic::Radius( m_A.second * ( std::pow( i_Luminosity, rB[ 1 ] ) + BXhC( i_Luminosity, rB[ 0 ], rB[ 2 ] ) ) ); // Eq. 46
 }
 
 }
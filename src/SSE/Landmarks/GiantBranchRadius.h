@@ -16,6 +16,7 @@
 #include <Generic/Quantity.h>
 
 #include <array>
+#include <memory>
 #include <utility>
 
 namespace Herd::SSE
@@ -32,7 +33,18 @@ public:
 
 private:
 
-  std::array< double, 7 > m_B;  ///< Coefficients depending on Z
+  /**
+   * @brief Equation coefficients that depend on the metallicity only
+   * @remarks Shared via MetallicityCache
+   */
+  struct Coefficients
+  {
+    std::array< double, 7 > m_B;  ///< Coefficients depending on Z
+  };
+
+  static Coefficients ComputeCoefficients( Herd::Generic::Metallicity i_Z ); ///< Computes the metallicity-dependent coefficients
+
+  std::shared_ptr< const Coefficients > m_pCoefficients;  ///< Coefficients depending on Z
   std::pair< Herd::Generic::Mass, double > m_A; ///< \f$ A \f$ in Eq. 46
 };
 }
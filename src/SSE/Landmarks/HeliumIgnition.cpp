@@ -14,10 +14,11 @@
 
 #include "Constants.h"
 #include "CriticalMassValues.h"
-#include "Utilities.h"
+#include "MetallicityCache.h"
 
 #include <Exceptions/PreconditionError.h>
 #include <Generic/MathHelpers.h>
+#include <Generic/Profiling.h>
 
 #include <cmath>
 
@@ -25,7 +26,7 @@ namespace
 {
 
 // @formatter:off
-const std::array< double, 15 > s_ZLHeI { 2.751631e+03, 3.557098e+02, 0.,
+constexpr std::array< double, 15 > s_ZLHeI { 2.751631e+03, 3.557098e+02, 0.,
   -3.820831e-02, 5.872664e-02, 0.,
   1.071738e+02, -8.970339e+01, -3.949739e+01,
   7.348793e+02, -1.531020e+02, -3.793700e+01,
@@ -47,7 +48,7 @@ HeliumIgnition::HeliumIgnition( Herd::Generic::Metallicity i_Z )
 {
   Herd::Generic::ThrowIfNotPositive( i_Z, "i_Z" );
 
-  ComputeMetallicityDependents( i_Z );
+  m_pCoefficients = Herd::SSE::MetallicityCache::Get< Coefficients >( i_Z, &HeliumIgnition::ComputeCoefficients );
 }
 
 /**
@@ -58,10 +59,12 @@ HeliumIgnition::HeliumIgnition( Herd::Generic::Metallicity i_Z )
  */
 Herd::Generic::Time HeliumIgnition::Age( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkAge );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Age, i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Age.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
     // @formatter:on
 }
 
@@ -73,10 +76,12 @@ Herd::Generic::Time HeliumIgnition::Age( Herd::Generic::Mass i_Mass )
  */
 Herd::Generic::Luminosity HeliumIgnition::Luminosity( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkLuminosity );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Luminosity, i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);} ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Luminosity.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity( *m_pCoefficients, i_Mass );} ); // @suppress("Invalid arguments")
           // @formatter:on
 }
 
@@ -88,17 +93,64 @@ Herd::Generic::Luminosity HeliumIgnition::Luminosity( Herd::Generic::Mass i_Mass
    */
 Herd::Generic::Radius HeliumIgnition::Radius( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkRadius );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Radius, i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass); } ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Radius.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass); } ); // @suppress("Invalid arguments")
         // @formatter:on
 }
 
 /**
-   * @param i_Z Metallicity
-   */
-void HeliumIgnition::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z )
+ * @param i_Mass Mass
+ * @returns \f$ t_{HeI}\f$, \f$ L_{HeI}\f$ and \f$ R_{HeI}\f$
+ * @pre \c i_Mass is positive
+ * @throws PreconditionError If the precondition is violated
+ * @remarks Validates the mass once. The quantities share no intermediates, and are read from their own caches
+ */
+Herd::SSE::LandmarkValues HeliumIgnition::Evaluate( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkEvaluate );
+
+  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+
+  Herd::SSE::LandmarkValues values;
+
+  // @formatter:off
+  values.m_Age = m_MDependents.m_Age.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
+  values.m_Luminosity = m_MDependents.m_Luminosity.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity( *m_pCoefficients, i_Mass );} ); // @suppress("Invalid arguments")
+  values.m_Radius = m_MDependents.m_Radius.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass); } ); // @suppress("Invalid arguments")
+  // @formatter:on
+
+  return values;
+}
+
+/**
+ * @return Masses at which the landmark functions are not smooth: \f$ M_{HeF} \f$
+ */
+std::vector< Herd::Generic::Mass > HeliumIgnition::Breakpoints() const
+{
+  return { m_pCoefficients->m_MHeF };
+}
+
+/**
+ * @return Total hit and miss counts of the mass caches
+ */
+Herd::SSE::MassCacheStatistics HeliumIgnition::CacheStatistics() const
+{
+  Herd::SSE::MassCacheStatistics statistics;
+  statistics += m_MDependents.m_Age.Statistics();
+  statistics += m_MDependents.m_Luminosity.Statistics();
+  statistics += m_MDependents.m_Radius.Statistics();
+  return statistics;
+}
+
+/**
+ * @param i_Z Metallicity
+ * @return Coefficients
+ */
+HeliumIgnition::Coefficients HeliumIgnition::ComputeCoefficients( Herd::Generic::Metallicity i_Z )
 {
   Herd::Generic::Metallicity relativeZ( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 ); // Metallicity relative to the Sun
 
@@ -106,15 +158,17 @@ void HeliumIgnition::ComputeMetallicityDependents( Herd::Generic::Metallicity i_
   double zeta = std::log10( relativeZ );
   Herd::Generic::ComputePowers( zetaPowers2, zeta );
 
+  Coefficients coefficients;
+
   // MHeF
-  m_ZDependents.m_MHeF = Herd::SSE::ComputeMHeF( i_Z );
+  coefficients.m_MHeF = Herd::SSE::ComputeMHeF( i_Z );
 
   // LHeI
   std::array< double, 5 > tempLHeI;
   Herd::Generic::MultiplyMatrixVector( tempLHeI, s_ZLHeI, zetaPowers2 );
 
   {
-    auto& rB = m_ZDependents.m_LHeI;
+    auto& rB = coefficients.m_LHeI;
     rB[ 0 ] = tempLHeI[ 0 ];
     rB[ 1 ] = tempLHeI[ 1 ];
     rB[ 2 ] = 15.;
@@ -124,9 +178,11 @@ void HeliumIgnition::ComputeMetallicityDependents( Herd::Generic::Metallicity i_
     rB[ 6 ] = tempLHeI[ 4 ] * tempLHeI[ 4 ];
 
     rB[ 3 ] = 0.; // This value is just an initialiser. The next call goes down a branch that does not use rB[3]
-    Herd::Generic::Luminosity lHeI = ComputeLuminosity( m_ZDependents.m_MHeF );  // L_HeI at M_HeF
-    rB[ 3 ] = ( Herd::Generic::BXhC( m_ZDependents.m_MHeF, rB[ 0 ], rB[ 1 ] ) - lHeI ) / ( lHeI * std::exp( m_ZDependents.m_MHeF * rB[ 2 ] ) ); // AMASS.SSE implements this differently from the paper
+    Herd::Generic::Luminosity lHeI = ComputeLuminosity( coefficients, coefficients.m_MHeF );  // L_HeI at M_HeF
+    rB[ 3 ] = ( Herd::Generic::BXhC( coefficients.m_MHeF, rB[ 0 ], rB[ 1 ] ) - lHeI ) / ( lHeI * std::exp( coefficients.m_MHeF * rB[ 2 ] ) ); // AMASS.SSE implements this differently from the paper
   }
+
+  return coefficients;
 }
 
 /**
@@ -139,15 +195,16 @@ Herd::Generic::Time HeliumIgnition::ComputeAge( Herd::Generic::Mass i_Mass ) con
 }
 
 /**
+ * @param i_rCoefficients Equation coefficients
  * @param i_Mass Mass
  * @return \f$ L_{HeI}\f$
  */
-Herd::Generic::Luminosity HeliumIgnition::ComputeLuminosity( Herd::Generic::Mass i_Mass ) const
+Herd::Generic::Luminosity HeliumIgnition::ComputeLuminosity( const Coefficients& i_rCoefficients, Herd::Generic::Mass i_Mass )
 {
-  auto& rB = m_ZDependents.m_LHeI;
+  auto& rB = i_rCoefficients.m_LHeI;
 
   // Eq. 49
-  if( i_Mass < m_ZDependents.m_MHeF )
+  if( i_Mass < i_rCoefficients.m_MHeF )
   {
     double num = BXhC( i_Mass, rB[ 0 ], rB[ 1 ] );
     double den = 1. + rB[ 3 ] * std::exp( i_Mass * rB[ 2 ] ); // AMASS.SSE implementation: MHeF is not subtracted
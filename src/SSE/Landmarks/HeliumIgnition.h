@@ -14,12 +14,13 @@
 #define HC7481676_A169_40BF_94F2_FB5F9ED028D3
 
 #include "ILandmark.h"
+#include "MassCache.h"
 
 #include <Generic/Quantity.h>
 
 #include <array>
-#include <optional>
-#include <utility>
+#include <memory>
+#include <vector>
 
 namespace Herd::SSE
 {
@@ -28,7 +29,7 @@ namespace Herd::SSE
  * @brief Computations for characteristic properties at HeI
  * @cite Hurley00
  */
-class HeliumIgnition : public ILandmark
+class HeliumIgnition final : public ILandmark
 {
 public:
 
@@ -37,19 +38,18 @@ public:
   Herd::Generic::Time Age( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{HeI} \f$
   Herd::Generic::Luminosity Luminosity( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ L_{HeI} \f$
   Herd::Generic::Radius Radius( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ R_{HeI} \f$
+  Herd::SSE::LandmarkValues Evaluate( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{HeI} \f$, \f$ L_{HeI} \f$ and \f$ R_{HeI} \f$
 
-private:
-
-  void ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z ); ///< Computes various metallicity-dependent quantities
+  std::vector< Herd::Generic::Mass > Breakpoints() const override; ///< Returns the masses at which the landmark functions are not smooth
+  Herd::SSE::MassCacheStatistics CacheStatistics() const override; ///< Returns the hit and miss counts of the mass caches
 
-  Herd::Generic::Time ComputeAge( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ t_{HeI}\f$
-  Herd::Generic::Luminosity ComputeLuminosity( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ L_{HeI} \f$
-  Herd::Generic::Radius ComputeRadius( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ R_{HeI} \f$
+private:
 
   /**
-   * @brief Various quantities and values that depend on metallicity only
+   * @brief Equation coefficients that depend on the metallicity only
+   * @remarks Shared via MetallicityCache
    */
-  struct MetallicityDependents
+  struct Coefficients
   {
     std::array< double, 7 > m_THeI; ///< \f$ t_{HeI} \f$ calculations
     std::array< double, 7 > m_LHeI; ///< \f$ L_{HeI} \f$ calculations
@@ -58,7 +58,13 @@ private:
     Herd::Generic::Mass m_MHeF;  ///< \f$ M_{HeF} \f$
   };
 
-  MetallicityDependents m_ZDependents;  ///< Metallicity-dependent quantities
+  static Coefficients ComputeCoefficients( Herd::Generic::Metallicity i_Z ); ///< Computes the metallicity-dependent coefficients
+
+  Herd::Generic::Time ComputeAge( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ t_{HeI}\f$
+  static Herd::Generic::Luminosity ComputeLuminosity( const Coefficients& i_rCoefficients, Herd::Generic::Mass i_Mass );  ///< Computes \f$ L_{HeI} \f$
+  Herd::Generic::Radius ComputeRadius( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ R_{HeI} \f$
+
+  std::shared_ptr< const Coefficients > m_pCoefficients;  ///< Metallicity-dependent coefficients
 
   /**
    * @brief Various quantities and values that depend on mass
@@ -66,11 +72,9 @@ private:
    */
   struct MassDependents
   {
-    using TKey = std::optional< Herd::Generic::Mass >;
-
-    std::pair< TKey, Herd::Generic::Time > m_Age; ///< \f$ t_{HeI} \f$
-    std::pair< TKey, Herd::Generic::Luminosity > m_Luminosity; ///< \f$ L_{HeI}\f$
-    std::pair< TKey, Herd::Generic::Radius > m_Radius;  ///< \f$ R_{HeI} \f$
+    Herd::SSE::MassCache< Herd::Generic::Time > m_Age; ///< \f$ t_{HeI} \f$
+    Herd::SSE::MassCache< Herd::Generic::Luminosity > m_Luminosity; ///< \f$ L_{HeI}\f$
+    Herd::SSE::MassCache< Herd::Generic::Radius > m_Radius;  ///< \f$ R_{HeI} \f$
   };
 
   MassDependents m_MDependents; ///< Mass-dependent quantities
@@ -13,12 +13,28 @@
 #ifndef H9B462095_0DAF_47FC_BF8C_B6CFC2594BDC
 #define H9B462095_0DAF_47FC_BF8C_B6CFC2594BDC
 
+#include "MassCache.h"
+
 #include <Generic/Quantity.h>
 
+#include <vector>
+
 namespace Herd::SSE
 {
+
+/**
+ * @brief Characteristic values of a landmark
+ */
+struct LandmarkValues
+{
+  Herd::Generic::Time m_Age; ///< Age at which the landmark occurs
+  Herd::Generic::Luminosity m_Luminosity; ///< Luminosity at the landmark
+  Herd::Generic::Radius m_Radius; ///< Radius at the landmark
+};
+
 /**
  * @brief Interface class for landmarks
+ * @remarks The implementations are \c final, so that the calls through a pointer to the concrete type are resolved at compile time
  */
 class ILandmark
 {
@@ -26,6 +42,18 @@ public:
   virtual Herd::Generic::Time Age( Herd::Generic::Mass i_Mass ) = 0;  ///< Returns the age at which the landmark occurs
   virtual Herd::Generic::Luminosity Luminosity( Herd::Generic::Mass i_Mass ) = 0;  ///< Returns the luminosity at the landmark
   virtual Herd::Generic::Radius Radius( Herd::Generic::Mass i_Mass ) = 0;  ///< Returns the radius at the landmark
+  virtual Herd::SSE::LandmarkValues Evaluate( Herd::Generic::Mass i_Mass ) = 0; ///< Returns the age, the luminosity and the radius in one call
+
+  virtual std::vector< Herd::Generic::Mass > Breakpoints() const = 0; ///< Returns the masses at which the landmark functions are not smooth
+
+  /**
+   * @brief Returns the hit and miss counts of the mass caches
+   * @return Counts. Zero if the implementation does not cache
+   */
+  virtual Herd::SSE::MassCacheStatistics CacheStatistics() const
+  {
+    return {};
+  }
 
   virtual ~ILandmark() = default;
 };
@@ -0,0 +1,29 @@
+/**
+ * @file MassCache.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "MassCache.h"
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_rOther Counts to be added
+ * @return A reference to this object
+ */
+MassCacheStatistics& MassCacheStatistics::operator+=( const MassCacheStatistics& i_rOther )
+{
+  m_Hits += i_rOther.m_Hits;
+  m_Misses += i_rOther.m_Misses;
+  return *this;
+}
+
+}
@@ -0,0 +1,75 @@
+/**
+ * @file MassCache.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H5D1E7C02_94A8_4F3B_8B6E_2A0C7F41D9E5
+#define H5D1E7C02_94A8_4F3B_8B6E_2A0C7F41D9E5
+
+#include <Generic/Quantity.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Herd::SSE
+{
+
+inline constexpr std::size_t s_MassCacheCapacity = 2; ///< Default number of entries in a MassCache. Enough for a query alternating between the trial and the accepted masses of a step
+
+/**
+ * @brief Hit and miss counts of mass caches
+ */
+struct MassCacheStatistics
+{
+  uint64_t m_Hits = 0; ///< Number of lookups served from the cache
+  uint64_t m_Misses = 0; ///< Number of lookups that computed the value
+
+  MassCacheStatistics& operator+=( const MassCacheStatistics& i_rOther ); ///< Accumulates the counts of another cache
+};
+
+/**
+ * @brief Fixed-capacity cache for a quantity that depends on mass
+ * @tparam TValue Type of the cached quantity
+ * @tparam Capacity Number of entries
+ * @remarks Evicts the least recently used entry. The entries are stored inline, so the cache does not allocate
+ * @remarks Lookups are a linear scan, which is the fastest option for a handful of entries
+ */
+template< class TValue, std::size_t Capacity = s_MassCacheCapacity >
+class MassCache
+{
+public:
+
+  static_assert( Capacity > 0 );
+
+  template< class TCallable >
+  TValue Get( Herd::Generic::Mass i_Mass, const TCallable& i_Computer ); ///< Returns the value for a mass
+
+  void Clear(); ///< Removes all entries. The counts are retained
+
+  const Herd::SSE::MassCacheStatistics& Statistics() const; ///< Accessor for MassCache::m_Statistics
+
+private:
+
+  std::array< Herd::Generic::Mass, Capacity > m_Masses; ///< Keys
+  std::array< TValue, Capacity > m_Values; ///< Values
+  std::array< uint64_t, Capacity > m_LastUse {}; ///< Time of the last lookup of each entry, for eviction
+
+  std::size_t m_Size = 0; ///< Number of occupied entries
+  uint64_t m_Clock = 0; ///< Incremented at each lookup
+
+  Herd::SSE::MassCacheStatistics m_Statistics; ///< Hit and miss counts
+};
+
+}
+
+#include "MassCache.hpp"
+
+#endif /* H5D1E7C02_94A8_4F3B_8B6E_2A0C7F41D9E5 */
@@ -0,0 +1,93 @@
+/**
+ * @file MassCache.hpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H0B6F3A94_7E21_4C85_9D3A_E84C1F5B2A76
+#define H0B6F3A94_7E21_4C85_9D3A_E84C1F5B2A76
+
+#include <type_traits>
+
+namespace Herd::SSE
+{
+
+/**
+ * @tparam TValue Type of the cached quantity
+ * @tparam Capacity Number of entries
+ * @tparam TCallable Computing function
+ * @param i_Mass Mass
+ * @param i_Computer Computing function. Only called on a miss. Passed by reference as it carries captured data
+ * @return Value for \c i_Mass
+ * @pre \c TCallable can be called with an argument of type \c Mass and returns \c TValue
+ * @remarks If \c i_Computer throws, the cache is unchanged
+ */
+template< class TValue, std::size_t Capacity >
+template< class TCallable >
+TValue MassCache< TValue, Capacity >::Get( Herd::Generic::Mass i_Mass, const TCallable& i_Computer )
+{
+  static_assert( std::is_invocable_r_v< TValue, TCallable, Herd::Generic::Mass > );
+
+  ++m_Clock;
+
+  std::size_t victim = 0;
+  for( std::size_t index = 0; index < m_Size; ++index )
+  {
+    if( m_Masses[ index ] == i_Mass )
+    {
+      ++m_Statistics.m_Hits;
+      m_LastUse[ index ] = m_Clock;
+      return m_Values[ index ];
+    }
+
+    if( m_LastUse[ index ] < m_LastUse[ victim ] )
+    {
+      victim = index;
+    }
+  }
+
+  ++m_Statistics.m_Misses;
+  TValue value = i_Computer( i_Mass );
+
+  if( m_Size < Capacity )
+  {
+    victim = m_Size++;
+  }
+
+  m_Masses[ victim ] = i_Mass;
+  m_Values[ victim ] = value;
+  m_LastUse[ victim ] = m_Clock;
+
+  return value;
+}
+
+/**
+ * @tparam TValue Type of the cached quantity
+ * @tparam Capacity Number of entries
+ */
+template< class TValue, std::size_t Capacity >
+void MassCache< TValue, Capacity >::Clear()
+{
+  m_Size = 0;
+}
+
+/**
+ * @tparam TValue Type of the cached quantity
+ * @tparam Capacity Number of entries
+ * @return A constant reference to MassCache::m_Statistics
+ */
+template< class TValue, std::size_t Capacity >
+const Herd::SSE::MassCacheStatistics& MassCache< TValue, Capacity >::Statistics() const
+{
+  return m_Statistics;
+}
+
+}
+
+#endif /* H0B6F3A94_7E21_4C85_9D3A_E84C1F5B2A76 */
@@ -0,0 +1,125 @@
+/**
+ * @file MetallicityCache.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "MetallicityCache.h"
+
+#include "Constants.h"
+
+#include <range/v3/algorithm.hpp>
+
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+namespace
+{
+
+/**
+ * @brief MetallicityCache entry
+ */
+struct Entry
+{
+  std::weak_ptr< const void > m_pValue; ///< Coefficients
+  std::shared_ptr< const void > m_pRetained;  ///< Strong reference, for Constants::s_CanonicalMetallicities. Otherwise \c nullptr
+};
+
+std::shared_mutex s_Mutex; ///< Guards MetallicityCache entries
+std::map< std::pair< std::type_index, double >, Entry > s_Entries; ///< MetallicityCache entries
+
+/**
+ * @remarks Not thread-safe. The caller holds the lock
+ */
+void RemoveReleased()
+{
+  std::erase_if( s_Entries, []( const auto& i_rEntry )
+  { return i_rEntry.second.m_pValue.expired();} );
+}
+
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @return Number of entries, including the released entries that are not removed yet
+ */
+std::size_t MetallicityCache::Size()
+{
+  std::shared_lock< std::shared_mutex > lock( s_Mutex );
+  return s_Entries.size();
+}
+
+/**
+ * @param i_Z Metallicity
+ * @return References to the live entries for \c i_Z, of all coefficient types
+ * @remarks The entries are retained as long as the references are held
+ */
+MetallicityCache::Handles MetallicityCache::Entries( Herd::Generic::Metallicity i_Z )
+{
+  std::shared_lock< std::shared_mutex > lock( s_Mutex );
+
+  Handles output;
+  for( const auto& [ rKey, rEntry ] : s_Entries )
+  {
+    if( auto pValue = rEntry.m_pValue.lock(); pValue && rKey.second == i_Z.Value() )
+    {
+      output.push_back( std::move( pValue ) );
+    }
+  }
+
+  return output;
+}
+
+/**
+ * @remarks The released entries are also removed at each insertion, so that the cache does not grow with the number of metallicities evaluated
+ */
+void MetallicityCache::Prune()
+{
+  std::unique_lock< std::shared_mutex > lock( s_Mutex );
+  RemoveReleased();
+}
+
+/**
+ * @param i_rKey Key
+ * @return Entry. \c nullptr if the key does not exist, or if the entry is released
+ */
+std::shared_ptr< const void > MetallicityCache::Find( const TKey& i_rKey )
+{
+  std::shared_lock< std::shared_mutex > lock( s_Mutex );
+  auto itEntry = s_Entries.find( i_rKey );
+  return itEntry == s_Entries.end() ? nullptr : itEntry->second.m_pValue.lock();
+}
+
+/**
+ * @param i_rKey Key
+ * @param i_pValue Value
+ * @return Entry for the key. If a live entry already exists, the existing entry
+ * @remarks The entries for Constants::s_CanonicalMetallicities are retained by the cache
+ */
+std::shared_ptr< const void > MetallicityCache::Insert( const TKey& i_rKey, std::shared_ptr< const void > i_pValue )
+{
+  std::unique_lock< std::shared_mutex > lock( s_Mutex );
+  RemoveReleased();
+
+  Entry& rEntry = s_Entries[ i_rKey ];
+  if( auto pExisting = rEntry.m_pValue.lock() )
+  {
+    return pExisting;
+  }
+
+  const auto& rCanonical = Herd::SSE::Constants::s_CanonicalMetallicities;
+  rEntry.m_pValue = i_pValue;
+  rEntry.m_pRetained = ranges::cpp20::find( rCanonical, i_rKey.second ) == rCanonical.end() ? nullptr : i_pValue;
+  return i_pValue;
+}
+
+}
@@ -0,0 +1,58 @@
+/**
+ * @file MetallicityCache.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H2328CF66_7FFD_491D_9395_74588AEADB4B
+#define H2328CF66_7FFD_491D_9395_74588AEADB4B
+
+#include <Generic/Quantity.h>
+
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Process-wide cache for the metallicity-dependent coefficients
+ * @remarks Entries are keyed by the coefficient type and the metallicity, and are immutable once inserted, so they can be shared across objects and threads
+ * @remarks Entries are reference counted. The cache holds weak references, so an entry is released when the last object holding it is destroyed. Entries for Constants::s_CanonicalMetallicities are held strongly, and are never released
+ * @remarks Coefficients are computed outside the lock, so that a computation can query the cache for other coefficient types. Concurrent misses for the same key may compute the same value more than once, but only the first insertion is retained
+ */
+class MetallicityCache
+{
+public:
+
+  using Handles = std::vector< std::shared_ptr< const void > >; ///< References that keep entries alive
+
+  template< class TCoefficients, class TCallable >
+  static std::shared_ptr< const TCoefficients > Get( Herd::Generic::Metallicity i_Z, const TCallable& i_Computer ); ///< Returns the coefficients for a metallicity
+
+  static Handles Entries( Herd::Generic::Metallicity i_Z ); ///< Returns the live entries for a metallicity
+  static std::size_t Size(); ///< Number of entries in the cache
+  static void Prune();  ///< Removes the released entries
+
+private:
+
+  using TKey = std::pair< std::type_index, double >; ///< Coefficient type and metallicity
+
+  static std::shared_ptr< const void > Find( const TKey& i_rKey );  ///< Finds an entry
+  static std::shared_ptr< const void > Insert( const TKey& i_rKey, std::shared_ptr< const void > i_pValue );  ///< Inserts an entry, unless a live one already exists
+};
+
+}
+
+#include "MetallicityCache.hpp"
+
+#endif /* H2328CF66_7FFD_491D_9395_74588AEADB4B */
@@ -0,0 +1,48 @@
+/**
+ * @file MetallicityCache.hpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H429AB789_6C58_45BC_BA03_CE89DB7FE68F
+#define H429AB789_6C58_45BC_BA03_CE89DB7FE68F
+
+#include <type_traits>
+#include <typeinfo>
+
+namespace Herd::SSE
+{
+
+/**
+ * @tparam TCoefficients Type of the coefficient block
+ * @tparam TCallable Computing function
+ * @param i_Z Metallicity
+ * @param i_Computer Computes the coefficients for a metallicity. Only called on a cache miss
+ * @return Shared, immutable coefficients
+ * @pre \c TCallable can be called with an argument of type \c Metallicity, and returns \c TCoefficients
+ */
+template< class TCoefficients, class TCallable >
+std::shared_ptr< const TCoefficients > MetallicityCache::Get( Herd::Generic::Metallicity i_Z, const TCallable& i_Computer )
+{
+  static_assert( std::is_same_v< std::invoke_result_t< TCallable, Herd::Generic::Metallicity >, TCoefficients > );
+
+  TKey key( typeid(TCoefficients), i_Z.Value() );
+
+  std::shared_ptr< const void > pEntry = Find( key );
+  if( !pEntry )
+  {
+    pEntry = Insert( key, std::make_shared< const TCoefficients >( i_Computer( i_Z ) ) );
+  }
+
+  return std::static_pointer_cast< const TCoefficients >( pEntry );
+}
+
+}
+
+#endif /* H429AB789_6C58_45BC_BA03_CE89DB7FE68F */
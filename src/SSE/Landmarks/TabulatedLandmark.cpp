@@ -0,0 +1,350 @@
+/**
+ * @file TabulatedLandmark.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "TabulatedLandmark.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+#include <Generic/Profiling.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <utility>
+
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+/**
+ * @param i_Value Value
+ * @param i_IsLogarithmic If \c true, \c i_Value is in \f$ \log_{10} \f$
+ * @return \c i_Value in linear scale
+ */
+double ToLinear( double i_Value, bool i_IsLogarithmic )
+{
+  return i_IsLogarithmic ? std::pow( 10., i_Value ) : i_Value;
+}
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_pLandmark Landmark to tabulate
+ * @param i_rMassRange Tabulated mass range
+ * @param i_Tolerance Maximum relative error against the analytic path
+ * @pre \c i_pLandmark is not \c nullptr
+ * @pre \c i_rMassRange has a positive lower bound and a nonzero width
+ * @pre \c i_Tolerance is positive
+ * @throws PreconditionError If any preconditions are violated
+ * @remarks The landmark functions must be valid over \c i_rMassRange
+ */
+TabulatedLandmark::TabulatedLandmark( std::unique_ptr< Herd::SSE::ILandmark > i_pLandmark, const Herd::Generic::ClosedRange& i_rMassRange,
+    double i_Tolerance ) :
+    m_pLandmark( std::move( i_pLandmark ) ), m_MassRange( i_rMassRange )
+{
+  if( !m_pLandmark )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_pLandmark", "Not nullptr", "nullptr" );
+  }
+
+  if( !( m_MassRange.Lower() > 0. ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_rMassRange.Lower()", ">0", m_MassRange.Lower() );
+  }
+
+  if( !( m_MassRange.Upper() > m_MassRange.Lower() ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_rMassRange", "Nonzero width", m_MassRange.GetRangeString().c_str() );
+  }
+
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_Tolerance, "i_Tolerance" );
+
+  // Segment limits: The range limits, and the breakpoints strictly inside the range
+  m_SegmentLimits.push_back( std::log10( m_MassRange.Lower() ) );
+  for( auto breakpoint : m_pLandmark->Breakpoints() )
+  {
+    if( breakpoint > m_MassRange.Lower() && breakpoint < m_MassRange.Upper() )
+    {
+      m_SegmentLimits.push_back( std::log10( breakpoint ) );
+    }
+  }
+  m_SegmentLimits.push_back( std::log10( m_MassRange.Upper() ) );
+
+  ranges::cpp20::sort( m_SegmentLimits );
+  m_SegmentLimits.erase( ranges::cpp20::unique( m_SegmentLimits ), m_SegmentLimits.end() );
+
+  // @formatter:off
+  m_Age = Tabulate( m_SegmentLimits, i_Tolerance, [ & ]( Herd::Generic::Mass i_Mass ){ return m_pLandmark->Age( i_Mass ).Value(); } );
+  m_Luminosity = Tabulate( m_SegmentLimits, i_Tolerance, [ & ]( Herd::Generic::Mass i_Mass ){ return m_pLandmark->Luminosity( i_Mass ).Value(); } );
+  m_Radius = Tabulate( m_SegmentLimits, i_Tolerance, [ & ]( Herd::Generic::Mass i_Mass ){ return m_pLandmark->Radius( i_Mass ).Value(); } );
+  // @formatter:on
+}
+
+/**
+ * @param i_Mass Mass
+ * @return Age at which the landmark occurs
+ */
+Herd::Generic::Time TabulatedLandmark::Age( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkAge );
+
+  return m_MassRange.Contains( i_Mass ) ? Herd::Generic::Time( Interpolate( m_Age, i_Mass ) ) : m_pLandmark->Age( i_Mass );
+}
+
+/**
+ * @param i_Mass Mass
+ * @return Luminosity at the landmark
+ */
+Herd::Generic::Luminosity TabulatedLandmark::Luminosity( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkLuminosity );
+
+  return m_MassRange.Contains( i_Mass ) ? Herd::Generic::Luminosity( Interpolate( m_Luminosity, i_Mass ) ) : m_pLandmark->Luminosity( i_Mass );
+}
+
+/**
+ * @param i_Mass Mass
+ * @return Radius at the landmark
+ */
+Herd::Generic::Radius TabulatedLandmark::Radius( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkRadius );
+
+  return m_MassRange.Contains( i_Mass ) ? Herd::Generic::Radius( Interpolate( m_Radius, i_Mass ) ) : m_pLandmark->Radius( i_Mass );
+}
+
+/**
+ * @param i_Mass Mass
+ * @return Age, luminosity and radius at the landmark
+ * @remarks The segment is located once for all three tables
+ */
+Herd::SSE::LandmarkValues TabulatedLandmark::Evaluate( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkEvaluate );
+
+  if( !m_MassRange.Contains( i_Mass ) )
+  {
+    return m_pLandmark->Evaluate( i_Mass );
+  }
+
+  auto [ segment, logMass ] = Locate( i_Mass );
+
+  Herd::SSE::LandmarkValues values;
+  values.m_Age.Set( Interpolate( m_Age, segment, logMass ) );
+  values.m_Luminosity.Set( Interpolate( m_Luminosity, segment, logMass ) );
+  values.m_Radius.Set( Interpolate( m_Radius, segment, logMass ) );
+  return values;
+}
+
+/**
+ * @return Breakpoints of the wrapped landmark
+ */
+std::vector< Herd::Generic::Mass > TabulatedLandmark::Breakpoints() const
+{
+  return m_pLandmark->Breakpoints();
+}
+
+/**
+ * @return Hit and miss counts of the mass caches of the wrapped landmark. Only the queries outside of the tabulated range and the sampling reach it
+ */
+Herd::SSE::MassCacheStatistics TabulatedLandmark::CacheStatistics() const
+{
+  return m_pLandmark->CacheStatistics();
+}
+
+/**
+ * @return Total number of knots in the age, luminosity and radius tables
+ */
+std::size_t TabulatedLandmark::KnotCount() const
+{
+  std::size_t knotCount = 0;
+  for( const auto* pTable : { &m_Age, &m_Luminosity, &m_Radius } )
+  {
+    for( const auto& rSegment : pTable->m_Segments )
+    {
+      knotCount += rSegment.KnotCount();
+    }
+  }
+
+  return knotCount;
+}
+
+/**
+ * @param i_rSegmentLimits Limits of the smooth segments, in \f$ \log_{10} M \f$
+ * @param i_Tolerance Maximum relative error
+ * @param i_rFunction Landmark function
+ * @param i_IsLogarithmic If \c true, tabulate \f$ \log_{10} \f$ of the function
+ * @return Table. \c std::nullopt if \c i_IsLogarithmic is \c true, and the function is not positive at a sample
+ * @remarks An interval is split at its midpoint until the error at the check points is within the tolerance, or the interval is narrower than \c s_MinimumSpacing.
+ * Since a new knot changes the slopes at its neighbours, all intervals are checked again after each pass
+ */
+std::optional< TabulatedLandmark::Table > TabulatedLandmark::Tabulate( const std::vector< double >& i_rSegmentLimits, double i_Tolerance, const TFunction& i_rFunction,
+    bool i_IsLogarithmic )
+{
+  // Returns std::nullopt if the sample cannot be represented in the table
+  auto Sample = [ & ]( double i_LogMass ) -> std::optional< double >
+  {
+    double value = i_rFunction( Herd::Generic::Mass( std::pow( 10., i_LogMass ) ) );
+
+    if( !i_IsLogarithmic )
+    {
+      return value;
+    }
+
+    if( !( value > 0. ) )
+    {
+      return std::nullopt;
+    }
+
+    return std::log10( value );
+  };
+
+  constexpr std::array< double, 3 > checkPoints { 0.25, 0.5, 0.75 }; // Relative to the interval
+
+  Table table;
+  table.m_IsLogarithmic = i_IsLogarithmic;
+
+  for( auto itLower = i_rSegmentLimits.begin(); std::next( itLower ) != i_rSegmentLimits.end(); ++itLower )
+  {
+    double lower = *itLower;
+    double upper = *std::next( itLower );
+
+    // Uniform initial grid. At least 3 knots, for a cubic interpolant
+    std::size_t intervalCount = std::max< std::size_t >( 2, static_cast< std::size_t >( std::ceil( ( upper - lower ) / s_InitialSpacing ) ) );
+    std::vector< double > x( intervalCount + 1 );
+    for( std::size_t index = 0; index < intervalCount; ++index )
+    {
+      x[ index ] = lower + ( upper - lower ) * index / intervalCount;
+    }
+    x.back() = upper;
+
+    std::vector< double > y;
+    y.reserve( x.size() );
+    for( double logMass : x )
+    {
+      auto value = Sample( logMass );
+      if( !value )
+      {
+        return std::nullopt;
+      }
+
+      y.push_back( *value );
+    }
+
+    bool isRefined = true;
+    while( isRefined )
+    {
+      isRefined = false;
+      Herd::Generic::MonotoneCubicInterpolator interpolator( x, y );
+
+      std::vector< double > refinedX { x.front() };
+      std::vector< double > refinedY { y.front() };
+      for( std::size_t index = 0; index + 1 < x.size(); ++index )
+      {
+        double width = x[ index + 1 ] - x[ index ];
+
+        bool isSplit = false;
+        for( auto itCheckPoint = checkPoints.begin(); width >= s_MinimumSpacing && !isSplit && itCheckPoint != checkPoints.end(); ++itCheckPoint )
+        {
+          double logMass = x[ index ] + *itCheckPoint * width;
+          auto value = Sample( logMass );
+          if( !value )
+          {
+            return std::nullopt;
+          }
+
+          double expected = ToLinear( *value, i_IsLogarithmic );
+          double actual = ToLinear( interpolator( logMass ), i_IsLogarithmic );
+          isSplit = !( std::abs( actual - expected ) <= i_Tolerance * std::abs( expected ) );
+        }
+
+        if( isSplit )
+        {
+          double logMass = x[ index ] + 0.5 * width;
+          auto value = Sample( logMass );
+          if( !value )
+          {
+            return std::nullopt;
+          }
+
+          refinedX.push_back( logMass );
+          refinedY.push_back( *value );
+          isRefined = true;
+        }
+
+        refinedX.push_back( x[ index + 1 ] );
+        refinedY.push_back( y[ index + 1 ] );
+      }
+
+      x = std::move( refinedX );
+      y = std::move( refinedY );
+    }
+
+    table.m_Segments.emplace_back( std::move( x ), std::move( y ) );
+  }
+
+  return table;
+}
+
+/**
+ * @param i_rSegmentLimits Limits of the smooth segments, in \f$ \log_{10} M \f$
+ * @param i_Tolerance Maximum relative error
+ * @param i_rFunction Landmark function
+ * @return Table. Over \f$ \log_{10} \f$ of the function if the function is positive at all samples
+ */
+TabulatedLandmark::Table TabulatedLandmark::Tabulate( const std::vector< double >& i_rSegmentLimits, double i_Tolerance, const TFunction& i_rFunction )
+{
+  auto table = Tabulate( i_rSegmentLimits, i_Tolerance, i_rFunction, true );
+  return table ? *table : *Tabulate( i_rSegmentLimits, i_Tolerance, i_rFunction, false );
+}
+
+/**
+ * @param i_Mass Mass
+ * @return Index of the segment containing \c i_Mass, and \f$ \log_{10} M \f$ clamped to the tabulated range
+ * @pre \c i_Mass is within the tabulated range
+ */
+std::pair< std::size_t, double > TabulatedLandmark::Locate( Herd::Generic::Mass i_Mass ) const
+{
+  double logMass = std::clamp( std::log10( i_Mass.Value() ), m_SegmentLimits.front(), m_SegmentLimits.back() );
+
+  // Segment containing the mass. The last limit belongs to the last segment
+  std::size_t index = std::distance( m_SegmentLimits.begin(), std::upper_bound( m_SegmentLimits.begin(), std::prev( m_SegmentLimits.end() ), logMass ) ) - 1;
+
+  return { index, logMass };
+}
+
+/**
+ * @param i_rTable Table
+ * @param i_Segment Segment, as returned by \c Locate
+ * @param i_LogMass \f$ \log_{10} M \f$, as returned by \c Locate
+ * @return Interpolated value
+ */
+double TabulatedLandmark::Interpolate( const Table& i_rTable, std::size_t i_Segment, double i_LogMass )
+{
+  return ToLinear( i_rTable.m_Segments[ i_Segment ]( i_LogMass ), i_rTable.m_IsLogarithmic );
+}
+
+/**
+ * @param i_rTable Table
+ * @param i_Mass Mass
+ * @return Interpolated value
+ * @pre \c i_Mass is within the tabulated range
+ */
+double TabulatedLandmark::Interpolate( const Table& i_rTable, Herd::Generic::Mass i_Mass ) const
+{
+  auto [ segment, logMass ] = Locate( i_Mass );
+  return Interpolate( i_rTable, segment, logMass );
+}
+
+}
@@ -0,0 +1,91 @@
+/**
+ * @file TabulatedLandmark.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H6D9660FC_D0CF_4B5C_AC4F_08BB2E25E268
+#define H6D9660FC_D0CF_4B5C_AC4F_08BB2E25E268
+
+#include "ILandmark.h"
+
+#include <Generic/MonotoneCubicInterpolator.h>
+#include <Generic/Quantity.h>
+#include <Generic/QuantityRange.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Answers landmark queries from interpolation tables over mass
+ * @remarks Each landmark function is sampled on an adaptive grid in \f$ \log_{10} M \f$, which has a knot at every breakpoint of the wrapped landmark.
+ * The grid is refined until the relative error of the monotone cubic interpolant against the analytic path is within the tolerance at the check points of every interval
+ * @remarks Queries outside of the tabulated mass range are forwarded to the wrapped landmark
+ * @remarks A standalone utility, e.g. for precomputing landmarks over a grid. The evolution does not use it: the phase computers hold the analytic landmarks, and \f$ t_{hook} \f$ is not tabulated
+ * @remarks The tables trade a one-off sampling cost for lookups without the landmark formulae. A lookup still costs a \f$ \log_{10} \f$ of the mass, and a power of 10 for each logarithmic table.
+ * The results are not bit-for-bit identical to the analytic path
+ */
+class TabulatedLandmark final : public Herd::SSE::ILandmark
+{
+public:
+
+  TabulatedLandmark( std::unique_ptr< Herd::SSE::ILandmark > i_pLandmark, const Herd::Generic::ClosedRange& i_rMassRange, double i_Tolerance ); ///< Constructor
+
+  Herd::Generic::Time Age( Herd::Generic::Mass i_Mass ) override;  ///< Returns the age at which the landmark occurs
+  Herd::Generic::Luminosity Luminosity( Herd::Generic::Mass i_Mass ) override;  ///< Returns the luminosity at the landmark
+  Herd::Generic::Radius Radius( Herd::Generic::Mass i_Mass ) override;  ///< Returns the radius at the landmark
+  Herd::SSE::LandmarkValues Evaluate( Herd::Generic::Mass i_Mass ) override; ///< Returns the age, the luminosity and the radius in one call
+
+  std::vector< Herd::Generic::Mass > Breakpoints() const override; ///< Returns the masses at which the landmark functions are not smooth
+  Herd::SSE::MassCacheStatistics CacheStatistics() const override; ///< Returns the hit and miss counts of the mass caches of the wrapped landmark
+
+  std::size_t KnotCount() const;  ///< Total number of knots in the tables
+
+  inline static constexpr double s_InitialSpacing = 0.05; ///< Spacing of the initial grid, in dex
+  inline static constexpr double s_MinimumSpacing = 1e-6;  ///< Intervals narrower than this are not refined further, in dex
+
+private:
+
+  /**
+   * @brief Interpolation table for a landmark function
+   */
+  struct Table
+  {
+    std::vector< Herd::Generic::MonotoneCubicInterpolator > m_Segments; ///< Interpolants for the smooth segments, in increasing mass
+    bool m_IsLogarithmic = false; ///< If \c true, the interpolants are over \f$ \log_{10} \f$ of the values
+  };
+
+  using TFunction = std::function< double( Herd::Generic::Mass ) >;  ///< A landmark function
+
+  static std::optional< Table > Tabulate( const std::vector< double >& i_rSegmentLimits, double i_Tolerance, const TFunction& i_rFunction,
+      bool i_IsLogarithmic ); ///< Builds the table for a landmark function
+  static Table Tabulate( const std::vector< double >& i_rSegmentLimits, double i_Tolerance, const TFunction& i_rFunction ); ///< Builds the table for a landmark function
+
+  std::pair< std::size_t, double > Locate( Herd::Generic::Mass i_Mass ) const; ///< Returns the segment containing a mass, and the log mass
+  static double Interpolate( const Table& i_rTable, std::size_t i_Segment, double i_LogMass );  ///< Interpolates a table at a located mass
+  double Interpolate( const Table& i_rTable, Herd::Generic::Mass i_Mass ) const;  ///< Interpolates a table
+
+  std::unique_ptr< Herd::SSE::ILandmark > m_pLandmark; ///< Wrapped landmark
+  Herd::Generic::ClosedRange m_MassRange; ///< Tabulated mass range
+  std::vector< double > m_SegmentLimits;  ///< Limits of the smooth segments, in \f$ \log_{10} M \f$
+
+  Table m_Age;  ///< Age table
+  Table m_Luminosity; ///< Luminosity table
+  Table m_Radius; ///< Radius table
+};
+}
+
+#endif /* H6D9660FC_D0CF_4B5C_AC4F_08BB2E25E268 */
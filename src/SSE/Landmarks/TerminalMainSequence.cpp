@@ -14,14 +14,18 @@
 
 #include "BaseOfGiantBranch.h"
 #include "Constants.h"
+#include "MetallicityCache.h"
 #include "Utilities.h"
 #include "ZeroAgeMainSequence.h"
 
+#include <Exceptions/ExceptionWrappers.h>
 #include <Exceptions/PreconditionError.h>
 #include <Generic/MathHelpers.h>
+#include <Generic/Profiling.h>
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 
 #include <range/v3/algorithm.hpp>
 
@@ -30,7 +34,7 @@ namespace
 
 // @formatter:off
 
-const std::array< double, 30 > s_ZLTMS { 1.031538e+00, -2.434480e-01, 7.732821e+00, 6.460705e+00, 1.374484e+00,
+constexpr std::array< double, 30 > s_ZLTMS { 1.031538e+00, -2.434480e-01, 7.732821e+00, 6.460705e+00, 1.374484e+00,
   1.043715e+00, -1.577474e+00, -5.168234e+00, -5.596506e+00, -1.299394e+00,
   7.859573e+02, -8.542048e+00, -2.642511e+01, -9.585707e+00, 0.,
   3.858911e+03, 2.459681e+03, -7.630093e+01, -3.486057e+02, -4.861703e+01,
@@ -39,7 +43,7 @@ const std::array< double, 30 > s_ZLTMS { 1.031538e+00, -2.434480e-01, 7.732821e+
 };  ///< Coefficients for \f$ L_{TMS}(z) \f$ calculations
 
 
-const std::array< double, 50 > s_ZRTMS { 2.187715e-01, -2.154437e+00, -3.768678e+00, -1.975518e+00, -3.021475e-01,
+constexpr std::array< double, 50 > s_ZRTMS { 2.187715e-01, -2.154437e+00, -3.768678e+00, -1.975518e+00, -3.021475e-01,
   1.466440e+00, 1.839725e+00, 6.442199e+00, 4.023635e+00, 6.957529e-01,
   2.652091e+01, 8.178458e+01, 1.156058e+02, 7.633811e+01, 1.950698e+01,
   1.472103e+00, -2.947609e+00, -3.312828e+00, -9.945065e-01, 0.,
@@ -51,7 +55,7 @@ const std::array< double, 50 > s_ZRTMS { 2.187715e-01, -2.154437e+00, -3.768678e
   5.502535e+00, -6.601663e-02, 9.968707e-02, 3.599801e-02, 0.
 };  ///< Coefficients for \f$ R_{TMS}(z) \f$ calculations
 
-const std::array< double, 20 > s_ZThook { 1.949814e+01, 1.758178e+00, -6.008212e+00, -4.470533e+00,
+constexpr std::array< double, 20 > s_ZThook { 1.949814e+01, 1.758178e+00, -6.008212e+00, -4.470533e+00,
   4.903830e+00, 0., 0., 0.,
   5.212154e-02, 3.166411e-02, -2.750074e-03, -2.271549e-03,
   1.312179e+00, -3.294936e-01, 9.231860e-02, 2.610989e-02,
@@ -66,14 +70,17 @@ namespace Herd::SSE
 
 /**
  * @param i_Z Metallicity
+ * @param[in, out] io_pResource Memory resource for the landmark computers. Must outlive the object
  * @pre \c \c i_Z is positive
  * @throws PreconditionError If the precondition is violated
  */
-TerminalMainSequence::TerminalMainSequence( Herd::Generic::Metallicity i_Z )
+TerminalMainSequence::TerminalMainSequence( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource )
 {
   Herd::Generic::ThrowIfNotPositive( i_Z, "i_Z" );
 
-  ComputeMetallicityDependents( i_Z );
+  m_ZDependents.m_pCoefficients = Herd::SSE::MetallicityCache::Get< Coefficients >( i_Z, &TerminalMainSequence::ComputeCoefficients );
+  m_ZDependents.m_pZAMSComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::ZeroAgeMainSequence >( io_pResource, i_Z );
+  m_ZDependents.m_pBGBComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::BaseOfGiantBranch >( io_pResource, i_Z, io_pResource );
 }
 
 /**
@@ -89,11 +96,10 @@ TerminalMainSequence::~TerminalMainSequence() = default;
  */
 Herd::Generic::Time TerminalMainSequence::Age( Herd::Generic::Mass i_Mass )
 {
-  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkAge );
 
-  // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Age, i_Mass, [ & ]( auto i_Mass ){ return ComputeAge(i_Mass);} ); // @suppress("Invalid arguments")
-      // @formatter:on
+  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  return GetAgeValues( i_Mass ).m_Age;
 }
 
 /**
@@ -104,11 +110,10 @@ Herd::Generic::Time TerminalMainSequence::Age( Herd::Generic::Mass i_Mass )
  */
 Herd::Generic::Luminosity TerminalMainSequence::Luminosity( Herd::Generic::Mass i_Mass )
 {
-  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkLuminosity );
 
-  // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Luminosity, i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);} ); // @suppress("Invalid arguments")
-        // @formatter:on
+  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  return GetAgeValues( i_Mass ).m_Luminosity;
 }
 
 /**
@@ -119,11 +124,30 @@ Herd::Generic::Luminosity TerminalMainSequence::Luminosity( Herd::Generic::Mass
  */
 Herd::Generic::Radius TerminalMainSequence::Radius( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkRadius );
+
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  return GetRadius( i_Mass );
+}
 
-  // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Radius, i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass); } ); // @suppress("Invalid arguments")
-        // @formatter:on
+/**
+ * @return Masses at which the landmark functions are not smooth: The limits of the \f$ R_{TMS} \f$ blending region
+ * @remarks \f$ t_{MS} \f$ and \f$ R_{TMS} \f$ also have kinks where the arguments of the \f$ \max \f$ operators cross. These have no closed form, and are left to the adaptive sampling
+ */
+std::vector< Herd::Generic::Mass > TerminalMainSequence::Breakpoints() const
+{
+  const auto& rA = m_ZDependents.m_pCoefficients->m_RTMS;
+  return { Herd::Generic::Mass( rA[ 10 ] ), Herd::Generic::Mass( rA[ 10 ] + 0.1 ) };
+}
+
+/**
+ * @return Total hit and miss counts of the mass caches
+ */
+Herd::SSE::MassCacheStatistics TerminalMainSequence::CacheStatistics() const
+{
+  Herd::SSE::MassCacheStatistics output = m_MDependents.m_AgeValues.Statistics();
+  output += m_MDependents.m_Radius.Statistics();
+  return output;
 }
 
 /**
@@ -135,16 +159,175 @@ Herd::Generic::Radius TerminalMainSequence::Radius( Herd::Generic::Mass i_Mass )
 Herd::Generic::Time TerminalMainSequence::THook( Herd::Generic::Mass i_Mass )
 {
   Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  return GetAgeValues( i_Mass ).m_THook;
+}
+
+/**
+ * @param i_Mass Mass
+ * @returns \f$ t_{MS}\f$, \f$ L_{TMS}\f$ and \f$ R_{TMS}\f$
+ * @pre \c i_Mass is positive
+ * @throws PreconditionError If the precondition is violated
+ * @remarks Profiled in EvaluateWithTHook
+ */
+Herd::SSE::LandmarkValues TerminalMainSequence::Evaluate( Herd::Generic::Mass i_Mass )
+{
+  return EvaluateWithTHook( i_Mass );
+}
 
+/**
+ * @param i_Mass Mass
+ * @returns \f$ t_{MS}\f$, \f$ L_{TMS}\f$, \f$ R_{TMS}\f$ and \f$ t_{hook}\f$
+ * @pre \c i_Mass is positive
+ * @throws PreconditionError If the precondition is violated
+ * @remarks The single-value accessors read from the same caches
+ */
+TerminalMainSequence::Values TerminalMainSequence::EvaluateWithTHook( Herd::Generic::Mass i_Mass )
+{
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkEvaluate );
+
+  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+
+  AgeValues ageValues = GetAgeValues( i_Mass );
+
+  Values values;
+  values.m_Age = ageValues.m_Age;
+  values.m_Luminosity = ageValues.m_Luminosity;
+  values.m_Radius = GetRadius( i_Mass );
+  values.m_THook = ageValues.m_THook;
+  return values;
+}
+
+/**
+ * @param i_Mass Mass
+ * @return \f$ t_{MS}\f$, \f$ t_{hook}\f$ and \f$ L_{TMS}\f$
+ * @pre \c i_Mass is validated by the caller
+ */
+TerminalMainSequence::AgeValues TerminalMainSequence::GetAgeValues( Herd::Generic::Mass i_Mass )
+{
+  // @formatter:off
+  return m_MDependents.m_AgeValues.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeAgeValues( i_Mass ); } ); // @suppress("Invalid arguments")
+    // @formatter:on
+}
+
+/**
+ * @param i_Mass Mass
+ * @return \f$ R_{TMS}\f$
+ * @pre \c i_Mass is validated by the caller
+ * @throws PreconditionError If \c i_Mass is below the \f$ R_{TMS} \f$ transition mass, and violates the preconditions of ZeroAgeMainSequence::Radius
+ */
+Herd::Generic::Radius TerminalMainSequence::GetRadius( Herd::Generic::Mass i_Mass )
+{
   // @formatter:off
-  return UpdateCache( m_MDependents.m_THook, i_Mass, [ & ]( auto i_Mass ){ return ComputeTHook( i_Mass); } ); // @suppress("Invalid arguments")
-        // @formatter:on
+  return m_MDependents.m_Radius.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( *m_ZDependents.m_pCoefficients, *m_ZDependents.m_pZAMSComputer, i_Mass ); } ); // @suppress("Invalid arguments")
+    // @formatter:on
+}
+
+/**
+ * @param i_Masses Masses
+ * @param[out] o_Ages \f$ t_{MS} \f$ for each mass. Caller-allocated
+ * @param[out] o_THooks \f$ t_{hook} \f$ for each mass. Caller-allocated
+ * @param[out] o_Luminosities \f$ L_{TMS} \f$ for each mass. Caller-allocated
+ * @param[out] o_Radii \f$ R_{TMS} \f$ for each mass. Caller-allocated
+ * @pre Each element of \c i_Masses is positive
+ * @pre Each element of \c i_Masses below the \f$ R_{TMS} \f$ transition mass satisfies the preconditions of ZeroAgeMainSequence::Compute
+ * @pre All output spans have the same size as \c i_Masses
+ * @throws PreconditionError If any preconditions are violated
+ * @remarks The four quantities are computed in one pass over the masses, with shared mass powers, \f$ t_{BGB} \f$ and \f$ R_{ZAMS} \f$
+ * @remarks Does not use or update the caches of the single-mass interface
+ */
+void TerminalMainSequence::Compute( std::span< const double > i_Masses, std::span< double > o_Ages, std::span< double > o_THooks,
+    std::span< double > o_Luminosities, std::span< double > o_Radii ) const
+{
+  if( o_Ages.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_Ages", "Same size as i_Masses", o_Ages.size() );
+  }
+
+  if( o_THooks.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_THooks", "Same size as i_Masses", o_THooks.size() );
+  }
+
+  if( o_Luminosities.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_Luminosities", "Same size as i_Masses", o_Luminosities.size() );
+  }
+
+  if( o_Radii.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_Radii", "Same size as i_Masses", o_Radii.size() );
+  }
+
+  Herd::SSE::ThrowIfAnyNotInRange( i_Masses, std::numeric_limits< double >::denorm_min(), std::numeric_limits< double >::infinity(), "i_Masses", ">0" );
+
+  const Coefficients& rCoefficients = *m_ZDependents.m_pCoefficients;
+  const auto& rT = rCoefficients.m_Thook;
+  const auto& rL = rCoefficients.m_LTMS;
+  const auto& rR = rCoefficients.m_RTMS;
+
+  using TBlock = Herd::SSE::TBatchBlock;
+  using TMap = Eigen::Map< Eigen::ArrayXd >;
+
+  std::array< double, s_BatchBlockSize > tBGBBuffer;
+  std::array< double, s_BatchBlockSize > zamsMassBuffer;
+  std::array< double, s_BatchBlockSize > lZAMSBuffer;
+  std::array< double, s_BatchBlockSize > rZAMSBuffer;
+
+  for( std::size_t offset = 0; offset < i_Masses.size(); offset += s_BatchBlockSize )
+  {
+    Eigen::Index blockSize = std::min< Eigen::Index >( s_BatchBlockSize, i_Masses.size() - offset );
+    std::span< const double > masses = i_Masses.subspan( offset, blockSize );
+    Eigen::Map< const Eigen::ArrayXd > mass( masses.data(), blockSize );
+
+    // Landmarks
+    std::span< double > tBGBSpan( tBGBBuffer.data(), blockSize );
+    m_ZDependents.m_pBGBComputer->Compute( masses, tBGBSpan );
+    TMap tBGB( tBGBSpan.data(), blockSize );
+
+    // R_ZAMS is only used below rR[10]. Clamped, so that the masses above are not subject to the preconditions of ZAMS
+    TMap zamsMass( zamsMassBuffer.data(), blockSize );
+    zamsMass = mass.min( rR[ 10 ] );
+    m_ZDependents.m_pZAMSComputer->Compute( std::span< const double >( zamsMassBuffer.data(), blockSize ), std::span< double >( lZAMSBuffer.data(), blockSize ),
+        std::span< double >( rZAMSBuffer.data(), blockSize ) );
+    TMap rZAMS( rZAMSBuffer.data(), blockSize );
+
+    // Powers of mass
+    TBlock m05 = mass.sqrt();
+    TBlock m15 = mass * m05;
+    TBlock m20 = mass * mass;
+    TBlock m30 = m20 * mass;
+    TBlock m40 = m20 * m20;
+    TBlock m50 = m40 * mass;
+
+    // Eq. 7
+    TBlock mu = ( 1. - 0.01 * ( rT[ 0 ] * mass.pow( -rT[ 1 ] ) ).max( rT[ 2 ] + rT[ 3 ] * mass.pow( -rT[ 4 ] ) ) ).max( 0.5 );
+    TBlock tHook = mu * tBGB;
+    TMap( o_THooks.data() + offset, blockSize ) = tHook;
+
+    // Eq. 5
+    TMap( o_Ages.data() + offset, blockSize ) = ( rCoefficients.m_X * tBGB ).max( tHook );
+
+    // Eq. 8
+    TMap( o_Luminosities.data() + offset, blockSize ) = ( rL[ 0 ] * m30 + rL[ 1 ] * m40 + rL[ 2 ] * mass.pow( rL[ 5 ] + 1.8 ) )
+        / ( rL[ 3 ] + rL[ 4 ] * m50 + mass.pow( rL[ 5 ] ) );
+
+    // Eq. 9, with the linear interpolation between the two branches
+    {
+      double upper = rR[ 10 ] + 0.1;
+      TBlock low = ( ( rR[ 0 ] + rR[ 1 ] * mass.pow( rR[ 3 ] ) ) / ( rR[ 2 ] + mass.pow( rR[ 4 ] ) ) ).max( 1.5 * rZAMS );
+      TBlock high = ( rR[ 5 ] * m30 + mass.pow( rR[ 9 ] ) * ( rR[ 6 ] + rR[ 7 ] * m15 ) ) / ( rR[ 8 ] + m50 );
+      TBlock middle = rR[ 11 ] + ( rR[ 12 ] - rR[ 11 ] ) * ( ( mass - rR[ 10 ] ) / ( upper - rR[ 10 ] ) );
+
+      TMap( o_Radii.data() + offset, blockSize ) = ( mass <= rR[ 10 ] ).select( low, ( mass >= upper ).select( high, middle ) );
+    }
+  }
 }
 
 /**
  * @param i_Z Metallicity
+ * @return Coefficients
  */
-void TerminalMainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z )
+TerminalMainSequence::Coefficients TerminalMainSequence::ComputeCoefficients( Herd::Generic::Metallicity i_Z )
 {
   Herd::Generic::Metallicity relativeZ( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 ); // Metallicity relative to the Sun
 
@@ -155,86 +338,98 @@ void TerminalMainSequence::ComputeMetallicityDependents( Herd::Generic::Metallic
   std::array< double, 4 > zetaPowers3;
   ranges::cpp20::copy_n( zetaPowers4.begin(), 4, zetaPowers3.begin() );
 
-  // Landmarks
-  m_ZDependents.m_pZAMSComputer = std::make_unique< Herd::SSE::ZeroAgeMainSequence >( i_Z );
-  m_ZDependents.m_pBGBComputer = std::make_unique< Herd::SSE::BaseOfGiantBranch >( i_Z );
+  Coefficients coefficients;
 
   // LTMS
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_LTMS, s_ZLTMS, zetaPowers4 );
-  m_ZDependents.m_LTMS[ 0 ] *= m_ZDependents.m_LTMS[ 3 ];
-  m_ZDependents.m_LTMS[ 1 ] *= m_ZDependents.m_LTMS[ 3 ];
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_LTMS, s_ZLTMS, zetaPowers4 );
+  coefficients.m_LTMS[ 0 ] *= coefficients.m_LTMS[ 3 ];
+  coefficients.m_LTMS[ 1 ] *= coefficients.m_LTMS[ 3 ];
 
   // RTMS
   std::array< double, 10 > tempRTMS;
   Herd::Generic::MultiplyMatrixVector( tempRTMS, s_ZRTMS, zetaPowers4 );
-  ranges::cpp20::copy( tempRTMS, m_ZDependents.m_RTMS.begin() );
-  m_ZDependents.m_RTMS[ 0 ] *= m_ZDependents.m_RTMS[ 2 ];
-  m_ZDependents.m_RTMS[ 1 ] *= m_ZDependents.m_RTMS[ 2 ];
+  ranges::cpp20::copy( tempRTMS, coefficients.m_RTMS.begin() );
+  coefficients.m_RTMS[ 0 ] *= coefficients.m_RTMS[ 2 ];
+  coefficients.m_RTMS[ 1 ] *= coefficients.m_RTMS[ 2 ];
 
   double sigma = log10( i_Z );
-  m_ZDependents.m_RTMS[ 10 ] = std::pow( 10., std::max( { 0.097 - 0.1072 * ( sigma + 3. ), 0.097, std::min( 0.1461, 0.1461 + 0.1237 * ( sigma + 2 ) ) } ) );
+  coefficients.m_RTMS[ 10 ] = std::pow( 10., std::max( { 0.097 - 0.1072 * ( sigma + 3. ), 0.097, std::min( 0.1461, 0.1461 + 0.1237 * ( sigma + 2 ) ) } ) );
 
-  auto& rA = m_ZDependents.m_RTMS;
+  auto& rA = coefficients.m_RTMS;
   // Evaluated at RZAMS = 0. At this point we do not know RZAMS, but it is only used if the mass < rA[10]
-  rA[ 11 ] = ComputeRadius( Herd::Generic::Mass( rA[ 10 ] ) ); // Eq. 9a, evaluated at a17
-  rA[ 12 ] = ComputeRadius( Herd::Generic::Mass( rA[ 10 ] + 0.1 ) );  //Eq. 9b, evaluated at Mstar
+  Herd::SSE::ZeroAgeMainSequence zamsComputer( i_Z );
+  rA[ 11 ] = ComputeRadius( coefficients, zamsComputer, Herd::Generic::Mass( rA[ 10 ] ) ); // Eq. 9a, evaluated at a17
+  rA[ 12 ] = ComputeRadius( coefficients, zamsComputer, Herd::Generic::Mass( rA[ 10 ] + 0.1 ) );  //Eq. 9b, evaluated at Mstar
 
   // Eq. 6, but AMUSE.SSE adds an extra term
   {
     double extra = std::min( 0.99, 0.98 - ( 100. / 7. ) * ( i_Z - 0.001 ) );
     double left = 0.95 - ( 10. / 3. ) * ( i_Z - 0.01 );
-    m_ZDependents.m_X = std::max( { 0.95, left, extra } );
+    coefficients.m_X = std::max( { 0.95, left, extra } );
 
   }
 
   // ThookCoefficients
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_Thook, s_ZThook, zetaPowers3 );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_Thook, s_ZThook, zetaPowers3 );
+
+  return coefficients;
 }
+
 /**
  * @param i_Mass Mass
- * @return \f$ t_{MS} \f$
+ * @return \f$ t_{MS} \f$, \f$ t_{hook}\f$ and \f$ L_{TMS}\f$
  */
-Herd::Generic::Time TerminalMainSequence::ComputeAge( Herd::Generic::Mass i_Mass ) const
+TerminalMainSequence::AgeValues TerminalMainSequence::ComputeAgeValues( Herd::Generic::Mass i_Mass ) const
 {
-  Herd::Generic::Time tHook = ComputeTHook( i_Mass );
+  AgeValues values;
+
+  // Eq. 7
   Herd::Generic::Time tBGB = m_ZDependents.m_pBGBComputer->Age( i_Mass );
-  return std::max( Herd::Generic::Time( m_ZDependents.m_X * tBGB ), tHook );
-}
+  {
+    const auto& rA = m_ZDependents.m_pCoefficients->m_Thook;
+    double left = Herd::Generic::BXhC( i_Mass, rA[ 0 ], -rA[ 1 ] );
+    double right = Herd::Generic::ApBXhC( i_Mass, rA[ 2 ], rA[ 3 ], -rA[ 4 ] );
+    double mu = std::max( 0.5, 1. - 0.01 * std::max( left, right ) );
+    values.m_THook.Set( mu * tBGB );
+  }
+
+  // Eq. 5
+  values.m_Age = std::max( Herd::Generic::Time( m_ZDependents.m_pCoefficients->m_X * tBGB ), values.m_THook );
 
-/**
- * @param i_Mass Mass
- * @return \f L_{TMS}\f$
- */
-Herd::Generic::Luminosity TerminalMainSequence::ComputeLuminosity( Herd::Generic::Mass i_Mass ) const
-{
   // Eq. 8
-  auto& rA = m_ZDependents.m_LTMS;
+  {
+    auto& rA = m_ZDependents.m_pCoefficients->m_LTMS;
 
-  double m20 = i_Mass * i_Mass;
-  double m30 = m20 * i_Mass;
-  double m40 = m20 * m20;
-  double m50 = m40 * i_Mass;
+    double m20 = i_Mass * i_Mass;
+    double m30 = m20 * i_Mass;
+    double m40 = m20 * m20;
+    double m50 = m40 * i_Mass;
 
-  double num = Herd::Generic::ComputeInnerProduct( { rA[ 0 ], rA[ 1 ] }, std::array< double, 2 > { m30, m40 } ) + rA[ 2 ] * std::pow( i_Mass, rA[ 5 ] + 1.8 );
-  double den = Herd::Generic::ComputeInnerProduct( { rA[ 3 ], rA[ 4 ] }, std::array< double, 2 > { 1., m50 } ) + std::pow( i_Mass, rA[ 5 ] ); // @suppress("Invalid arguments")
+    double num = Herd::Generic::ComputeInnerProduct( { rA[ 0 ], rA[ 1 ] }, std::array< double, 2 > { m30, m40 } ) + rA[ 2 ] * std::pow( i_Mass, rA[ 5 ] + 1.8 );
+    double den = Herd::Generic::ComputeInnerProduct( { rA[ 3 ], rA[ 4 ] }, std::array< double, 2 > { 1., m50 } ) + std::pow( i_Mass, rA[ 5 ] ); // @suppress("Invalid arguments")
+    values.m_Luminosity.Set( num / den );
+  }
 
-  return Herd::Generic::Luminosity( num / den );
+  return values;
 }
 
 /**
+ * @param i_rCoefficients Equation coefficients
+ * @param io_rZAMSComputer ZAMS computations
  * @param i_Mass Mass
  * @return \f R_{TMS}\f$
  */
-Herd::Generic::Radius TerminalMainSequence::ComputeRadius( Herd::Generic::Mass i_Mass ) const
+Herd::Generic::Radius TerminalMainSequence::ComputeRadius( const Coefficients& i_rCoefficients, Herd::SSE::ZeroAgeMainSequence& io_rZAMSComputer,
+    Herd::Generic::Mass i_Mass )
 {
-  auto& rA = m_ZDependents.m_RTMS;
+  auto& rA = i_rCoefficients.m_RTMS;
 
   if( i_Mass <= rA[ 10 ] )
   {
     // Eq. 9a
     double num = Herd::Generic::ApBXhC( i_Mass, rA[ 0 ], rA[ 1 ], rA[ 3 ] );
     double den = Herd::Generic::ApBXhC( i_Mass, rA[ 2 ], 1., rA[ 4 ] );
-    Herd::Generic::Radius rZAMS = m_ZDependents.m_pZAMSComputer->Radius( i_Mass );
+    Herd::Generic::Radius rZAMS = io_rZAMSComputer.Radius( i_Mass );
     return Herd::Generic::Radius( std::max( 1.5 * rZAMS, num / den ) ); // AMUSE.SSE added a check to ensure that RTMS > RZAMS
   }
 
@@ -253,25 +448,4 @@ Herd::Generic::Radius TerminalMainSequence::ComputeRadius( Herd::Generic::Mass i
   return Herd::Generic::Radius( std::lerp( rA[ 11 ], rA[ 12 ], Herd::Generic::ComputeBlendWeight( i_Mass, rA[ 10 ], rA[ 10 ] + 0.1 ) ) );
 }
 
-/**
- * @param i_Mass Mass
- * @return \f$ t_{hook}\f$
- */
-Herd::Generic::Time TerminalMainSequence::ComputeTHook( Herd::Generic::Mass i_Mass ) const
-{
-  // Eq. 7
-  double mu = 0;
-  const auto& rA = m_ZDependents.m_Thook;
-  double left = Herd::Generic::BXhC( i_Mass, rA[ 0 ], -rA[ 1 ] );
-  double right = Herd::Generic::ApBXhC( i_Mass, rA[ 2 ], rA[ 3 ], -rA[ 4 ] );
-  mu = std::max( 0.5, 1. - 0.01 * std::max( left, right ) );
-
-  Herd::Generic::Time tBGB = m_ZDependents.m_pBGBComputer->Age( i_Mass );
-
-  return Herd::Generic::Time( mu * tBGB );
-}
-
 }
-
-
-
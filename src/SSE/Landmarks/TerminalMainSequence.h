@@ -14,13 +14,16 @@
 #define H003D4153_CA63_4833_B8C8_CD0D78C0D419
 
 #include "ILandmark.h"
+#include "MassCache.h"
 
+#include <Generic/Arena.h>
 #include <Generic/Quantity.h>
 
 #include <array>
 #include <memory>
-#include <optional>
-#include <utility>
+#include <memory_resource>
+#include <span>
+#include <vector>
 
 namespace Herd::SSE
 {
@@ -33,40 +36,77 @@ class ZeroAgeMainSequence;
  * @remarks \f$ t_{hook} \f$ is not a characteristic value of TMS, but needed for \f$ t_{MS}\f$ calculations in Hertzsprung gap
  * @cite Hurley00
  */
-class TerminalMainSequence : public Herd::SSE::ILandmark
+class TerminalMainSequence final : public Herd::SSE::ILandmark
 {
 public:
+
+  /**
+   * @brief Characteristic values at TMS, and \f$ t_{hook} \f$
+   */
+  struct Values : public Herd::SSE::LandmarkValues
+  {
+    Herd::Generic::Time m_THook;  ///< \f$ t_{hook} \f$
+  };
   
-  TerminalMainSequence( Herd::Generic::Metallicity i_Z ); ///< Constructor
+  TerminalMainSequence( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource = std::pmr::get_default_resource() ); ///< Constructor
   ~TerminalMainSequence();
 
   Herd::Generic::Time Age( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{TMS} \f$
   Herd::Generic::Luminosity Luminosity( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ L_{TMS} \f$
   Herd::Generic::Radius Radius( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ R_{TMS} \f$
+  Herd::SSE::LandmarkValues Evaluate( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{MS} \f$, \f$ L_{TMS} \f$ and \f$ R_{TMS} \f$
 
-  Herd::Generic::Time THook( Herd::Generic::Mass i_Mass );  ///< Returns \f$ t_{hook] \f$
+  std::vector< Herd::Generic::Mass > Breakpoints() const override; ///< Returns the masses at which the landmark functions are not smooth
+  Herd::SSE::MassCacheStatistics CacheStatistics() const override; ///< Returns the hit and miss counts of the mass caches
 
-private:
+  Herd::Generic::Time THook( Herd::Generic::Mass i_Mass );  ///< Returns \f$ t_{hook] \f$
+  Values EvaluateWithTHook( Herd::Generic::Mass i_Mass );  ///< Returns \f$ t_{MS} \f$, \f$ L_{TMS} \f$, \f$ R_{TMS} \f$ and \f$ t_{hook} \f$
 
-  void ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z ); ///< Computes various metallicity-dependent quantities
+  void Compute( std::span< const double > i_Masses, std::span< double > o_Ages, std::span< double > o_THooks, std::span< double > o_Luminosities,
+      std::span< double > o_Radii ) const; ///< Computes \f$ t_{MS} \f$, \f$ t_{hook} \f$, \f$ L_{TMS} \f$ and \f$ R_{TMS} \f$ for a batch of masses
 
-  Herd::Generic::Time ComputeAge( Herd::Generic::Mass i_Mass ) const; ///< Computes \f$ t_{MS} \f$
-  Herd::Generic::Luminosity ComputeLuminosity( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ L_{TMS} \f$
-  Herd::Generic::Radius ComputeRadius( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ R_{TMS} \f$
-  Herd::Generic::Time ComputeTHook( Herd::Generic::Mass i_Mass ) const; ///< Computes \f$ t_{Hhok} \f$
+private:
 
   /**
-   * @brief Various quantities and values that depend on metallicity only
+   * @brief Equation coefficients that depend on the metallicity only
+   * @remarks Shared via MetallicityCache
    */
-  struct MetallicityDependents
+  struct Coefficients
   {
     std::array< double, 13 > m_RTMS; ///< \f$ R_{TMS} \f$ calculations
     std::array< double, 6 > m_LTMS; ///< \f$ L_{TMS} \f$ calculations
     double m_X = 0;  ///< \f$ x \f$ in Eq. 6
     std::array< double, 5 > m_Thook;  ///< \f$ t_{hook} \f$ calculations
+  };
+
+  /**
+   * @brief The characteristic values that do not depend on \f$ R_{ZAMS} \f$
+   */
+  struct AgeValues
+  {
+    Herd::Generic::Time m_Age;  ///< \f$ t_{MS} \f$
+    Herd::Generic::Time m_THook;  ///< \f$ t_{hook} \f$
+    Herd::Generic::Luminosity m_Luminosity; ///< \f$ L_{TMS} \f$
+  };
+
+  static Coefficients ComputeCoefficients( Herd::Generic::Metallicity i_Z ); ///< Computes the metallicity-dependent coefficients
+
+  AgeValues GetAgeValues( Herd::Generic::Mass i_Mass ); ///< Returns \f$ t_{MS} \f$, \f$ t_{hook} \f$ and \f$ L_{TMS} \f$ from the cache
+  Herd::Generic::Radius GetRadius( Herd::Generic::Mass i_Mass ); ///< Returns \f$ R_{TMS} \f$ from the cache
+
+  AgeValues ComputeAgeValues( Herd::Generic::Mass i_Mass ) const; ///< Computes \f$ t_{MS} \f$, \f$ t_{hook} \f$ and \f$ L_{TMS} \f$
+  static Herd::Generic::Radius ComputeRadius( const Coefficients& i_rCoefficients, Herd::SSE::ZeroAgeMainSequence& io_rZAMSComputer,
+      Herd::Generic::Mass i_Mass );  ///< Computes \f$ R_{TMS} \f$
+
+  /**
+   * @brief Various quantities and values that depend on metallicity only
+   */
+  struct MetallicityDependents
+  {
+    std::shared_ptr< const Coefficients > m_pCoefficients; ///< Equation coefficients
 
-    std::unique_ptr< Herd::SSE::ZeroAgeMainSequence > m_pZAMSComputer; ///< ZAMS computations
-    std::unique_ptr< Herd::SSE::BaseOfGiantBranch > m_pBGBComputer; ///< BGB computations
+    Herd::Generic::ArenaPtr< Herd::SSE::ZeroAgeMainSequence > m_pZAMSComputer; ///< ZAMS computations
+    Herd::Generic::ArenaPtr< Herd::SSE::BaseOfGiantBranch > m_pBGBComputer; ///< BGB computations
   };
 
   MetallicityDependents m_ZDependents;  ///< Metallicity-dependent quantities
@@ -77,13 +117,8 @@ private:
    */
   struct MassDependents
   {
-    using TKey = std::optional< Herd::Generic::Mass >;
-
-    std::pair< TKey, Herd::Generic::Time > m_Age; ///< \f$ t_{MS} \f$
-    std::pair< TKey, Herd::Generic::Luminosity > m_Luminosity; ///< \f$ L_{TMS}\f$
-    std::pair< TKey, Herd::Generic::Radius > m_Radius;  ///< \f$ R_{TMS} \f$
-
-    std::pair< TKey, Herd::Generic::Time > m_THook;  ///< \f$ t_{hook} \f$
+    Herd::SSE::MassCache< AgeValues > m_AgeValues; ///< \f$ t_{MS} \f$, \f$ t_{hook} \f$ and \f$ L_{TMS}\f$. Computed together, as they share \f$ t_{BGB} \f$
+    Herd::SSE::MassCache< Herd::Generic::Radius > m_Radius; ///< \f$ R_{TMS} \f$. Separate, as it requires \f$ R_{ZAMS} \f$, which has a narrower mass range
   };
 
   MassDependents m_MDependents; ///< Mass-dependent quantities
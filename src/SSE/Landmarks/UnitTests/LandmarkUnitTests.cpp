@@ -79,11 +79,13 @@ BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
     BOOST_CHECK_NO_THROW( pLandmark->Age( validMass ) );
     BOOST_CHECK_NO_THROW( pLandmark->Luminosity( validMass ) );
     BOOST_CHECK_NO_THROW( pLandmark->Radius( validMass ) );
+    BOOST_CHECK_NO_THROW( pLandmark->Evaluate( validMass ) );
 
     // Invalid input
     BOOST_CHECK_THROW( pLandmark->Age( invalidMass ), Herd::Exceptions::PreconditionError );
     BOOST_CHECK_THROW( pLandmark->Luminosity( invalidMass ), Herd::Exceptions::PreconditionError );
     BOOST_CHECK_THROW( pLandmark->Radius( invalidMass ), Herd::Exceptions::PreconditionError );
+    BOOST_CHECK_THROW( pLandmark->Evaluate( invalidMass ), Herd::Exceptions::PreconditionError );
   }
 
   // Type-specific
@@ -92,6 +94,103 @@ BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
   BOOST_CHECK_NO_THROW( dynamic_cast< Herd::SSE::TerminalMainSequence* >( Landmarks[ ELandmarkType::e_TMS ].get() )->THook( validMass ) );
   BOOST_CHECK_THROW( dynamic_cast< Herd::SSE::TerminalMainSequence* >( Landmarks[ ELandmarkType::e_TMS ].get() )->THook( invalidMass ),
       Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( dynamic_cast< Herd::SSE::TerminalMainSequence* >( Landmarks[ ELandmarkType::e_TMS ].get() )->EvaluateWithTHook( invalidMass ),
+      Herd::Exceptions::PreconditionError );
+}
+
+// Evaluate should return exactly the values of the single-value accessors, whether it is called before or after them
+BOOST_AUTO_TEST_CASE( EvaluateTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateNumber( 1e-4, 3e-2 ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass mass( GenerateNumber( 0.5, 50. ) );  // @suppress("Invalid arguments")
+
+  auto MakeLandmarks = [ & ]()
+  {
+    std::map< ELandmarkType, std::unique_ptr< Herd::SSE::ILandmark > > landmarks;
+    landmarks.emplace( ELandmarkType::e_ZAMS, std::make_unique< Herd::SSE::ZeroAgeMainSequence >( z ) );
+    landmarks.emplace( ELandmarkType::e_TMS, std::make_unique< Herd::SSE::TerminalMainSequence >( z ) );
+    landmarks.emplace( ELandmarkType::e_BGB, std::make_unique< Herd::SSE::BaseOfGiantBranch >( z ) );
+    landmarks.emplace( ELandmarkType::e_HeI, std::make_unique< Herd::SSE::HeliumIgnition >( z ) );
+    return landmarks;
+  };
+
+  auto evaluatedFirst = MakeLandmarks();
+  auto evaluatedLast = MakeLandmarks();
+
+  for( auto& [ rKey, pLandmark ] : evaluatedFirst )
+  {
+    BOOST_TEST_CONTEXT( "Landmark " << static_cast< int >( rKey ) )
+    {
+      Herd::SSE::LandmarkValues fused = pLandmark->Evaluate( mass );
+      BOOST_TEST( fused.m_Age == pLandmark->Age( mass ) ); // @suppress("Invalid arguments")
+      BOOST_TEST( fused.m_Luminosity == pLandmark->Luminosity( mass ) ); // @suppress("Invalid arguments")
+      BOOST_TEST( fused.m_Radius == pLandmark->Radius( mass ) ); // @suppress("Invalid arguments")
+
+      auto& rOther = evaluatedLast[ rKey ];
+      Herd::Generic::Time age = rOther->Age( mass );
+      Herd::Generic::Luminosity luminosity = rOther->Luminosity( mass );
+      Herd::Generic::Radius radius = rOther->Radius( mass );
+      Herd::SSE::LandmarkValues later = rOther->Evaluate( mass );
+      BOOST_TEST( later.m_Age == age ); // @suppress("Invalid arguments")
+      BOOST_TEST( later.m_Luminosity == luminosity ); // @suppress("Invalid arguments")
+      BOOST_TEST( later.m_Radius == radius ); // @suppress("Invalid arguments")
+      BOOST_TEST( fused.m_Luminosity == later.m_Luminosity ); // @suppress("Invalid arguments")
+      BOOST_TEST( fused.m_Radius == later.m_Radius ); // @suppress("Invalid arguments")
+    }
+  }
+
+  // TMS also returns t_hook
+  auto& rTMS = dynamic_cast< Herd::SSE::TerminalMainSequence& >( *evaluatedFirst[ ELandmarkType::e_TMS ] );
+  BOOST_TEST( rTMS.EvaluateWithTHook( mass ).m_THook == rTMS.THook( mass ) ); // @suppress("Invalid arguments")
+}
+
+// t_MS, L_TMS and t_hook do not depend on R_ZAMS, so they are valid below its mass range
+BOOST_AUTO_TEST_CASE( TMSLowMassTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateNumber( 1e-4, 3e-2 ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass mass( GenerateNumber( 0.01, 0.2 ) );  // @suppress("Invalid arguments")
+
+  Herd::SSE::TerminalMainSequence tms( z );
+  Herd::Generic::Time age = tms.Age( mass );
+  Herd::Generic::Luminosity luminosity = tms.Luminosity( mass );
+  Herd::Generic::Time tHook = tms.THook( mass );
+
+  BOOST_TEST( age > 0 ); // @suppress("Invalid arguments")
+  BOOST_TEST( luminosity > 0 ); // @suppress("Invalid arguments")
+  BOOST_TEST( tHook > 0 ); // @suppress("Invalid arguments")
+  BOOST_TEST( tHook <= age ); // @suppress("Invalid arguments")
+}
+
+// Repeated queries at the trial and the accepted masses should be served from the mass caches, with the same values
+BOOST_AUTO_TEST_CASE( MassCacheTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateNumber( 1e-4, 3e-2 ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass trialMass( GenerateNumber( 0.5, 50. ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass acceptedMass( trialMass * GenerateNumber( 0.9, 0.99 ) );  // @suppress("Invalid arguments")
+
+  std::map< ELandmarkType, std::unique_ptr< Herd::SSE::ILandmark > > Landmarks;
+  Landmarks.emplace( ELandmarkType::e_ZAMS, std::make_unique< Herd::SSE::ZeroAgeMainSequence >( z ) );
+  Landmarks.emplace( ELandmarkType::e_TMS, std::make_unique< Herd::SSE::TerminalMainSequence >( z ) );
+  Landmarks.emplace( ELandmarkType::e_BGB, std::make_unique< Herd::SSE::BaseOfGiantBranch >( z ) );
+  Landmarks.emplace( ELandmarkType::e_HeI, std::make_unique< Herd::SSE::HeliumIgnition >( z ) );
+
+  for( auto& [ rKey, pLandmark ] : Landmarks )
+  {
+    BOOST_TEST_CONTEXT( "Landmark " << static_cast< int >( rKey ) )
+    {
+      Herd::Generic::Luminosity trialLuminosity = pLandmark->Luminosity( trialMass );
+      Herd::Generic::Luminosity acceptedLuminosity = pLandmark->Luminosity( acceptedMass );
+      Herd::SSE::MassCacheStatistics before = pLandmark->CacheStatistics();
+      BOOST_TEST( before.m_Misses == 2 ); // @suppress("Invalid arguments")
+
+      BOOST_TEST( pLandmark->Luminosity( trialMass ) == trialLuminosity ); // @suppress("Invalid arguments")
+      BOOST_TEST( pLandmark->Luminosity( acceptedMass ) == acceptedLuminosity ); // @suppress("Invalid arguments")
+
+      Herd::SSE::MassCacheStatistics after = pLandmark->CacheStatistics();
+      BOOST_TEST( after.m_Misses == before.m_Misses ); // @suppress("Invalid arguments")
+      BOOST_TEST( after.m_Hits == before.m_Hits + 2 ); // @suppress("Invalid arguments")
+    }
+  }
 }
 
 BOOST_AUTO_TEST_SUITE_END( )
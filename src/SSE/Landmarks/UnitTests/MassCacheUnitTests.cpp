@@ -0,0 +1,94 @@
+/**
+ * @file MassCacheUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/Landmarks/MassCache.h>
+
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <stdexcept>
+
+BOOST_FIXTURE_TEST_SUITE( MassCacheTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( OperationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  std::size_t callCount = 0;
+  auto computer = [ & ]( Herd::Generic::Mass i_Mass )
+  {
+    ++callCount;
+    return Herd::Generic::Radius( 2. * i_Mass );
+  };
+
+  Herd::SSE::MassCache< Herd::Generic::Radius, 3 > cache;
+  Herd::Generic::Mass m1( GenerateNumber( 0.1, 1. ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass m2( GenerateNumber( 2., 3. ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass m3( GenerateNumber( 4., 5. ) );  // @suppress("Invalid arguments")
+  Herd::Generic::Mass m4( GenerateNumber( 6., 7. ) );  // @suppress("Invalid arguments")
+
+  BOOST_TEST( cache.Get( m1, computer ).Value() == 2. * m1 ); // @suppress("Invalid arguments")
+  BOOST_TEST( cache.Get( m2, computer ).Value() == 2. * m2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( cache.Get( m3, computer ).Value() == 2. * m3 ); // @suppress("Invalid arguments")
+  BOOST_TEST( callCount == 3 ); // @suppress("Invalid arguments")
+
+  // All in the cache
+  BOOST_TEST( cache.Get( m2, computer ).Value() == 2. * m2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( cache.Get( m1, computer ).Value() == 2. * m1 ); // @suppress("Invalid arguments")
+  BOOST_TEST( callCount == 3 ); // @suppress("Invalid arguments")
+
+  // m3 is the least recently used, and is evicted
+  BOOST_TEST( cache.Get( m4, computer ).Value() == 2. * m4 ); // @suppress("Invalid arguments")
+  BOOST_TEST( callCount == 4 ); // @suppress("Invalid arguments")
+  cache.Get( m1, computer );
+  cache.Get( m2, computer );
+  BOOST_TEST( callCount == 4 ); // @suppress("Invalid arguments")
+  cache.Get( m3, computer );
+  BOOST_TEST( callCount == 5 ); // @suppress("Invalid arguments")
+
+  BOOST_TEST( cache.Statistics().m_Hits == 4 ); // @suppress("Invalid arguments")
+  BOOST_TEST( cache.Statistics().m_Misses == 5 ); // @suppress("Invalid arguments")
+
+  // Clear retains the counts
+  cache.Clear();
+  cache.Get( m1, computer );
+  BOOST_TEST( callCount == 6 ); // @suppress("Invalid arguments")
+  BOOST_TEST( cache.Statistics().m_Misses == 6 ); // @suppress("Invalid arguments")
+}
+
+// A failed computation should not leave an entry behind
+BOOST_AUTO_TEST_CASE( ExceptionTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::MassCache< Herd::Generic::Radius > cache;
+  Herd::Generic::Mass mass( GenerateNumber( 0.1, 100. ) );  // @suppress("Invalid arguments")
+
+  auto thrower = []( Herd::Generic::Mass ) -> Herd::Generic::Radius
+  {
+    throw std::runtime_error( "Failed" );
+  };
+  BOOST_CHECK_THROW( cache.Get( mass, thrower ), std::runtime_error );
+
+  std::size_t callCount = 0;
+  auto computer = [ & ]( Herd::Generic::Mass i_Mass )
+  {
+    ++callCount;
+    return Herd::Generic::Radius( i_Mass );
+  };
+  BOOST_TEST( cache.Get( mass, computer ).Value() == mass.Value() ); // @suppress("Invalid arguments")
+  BOOST_TEST( callCount == 1 ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_SUITE_END()
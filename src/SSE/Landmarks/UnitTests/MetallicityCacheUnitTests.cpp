@@ -0,0 +1,181 @@
+/**
+ * @file MetallicityCacheUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/Landmarks/Constants.h>
+#include <SSE/Landmarks/MetallicityCache.h>
+
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Dummy coefficient block
+ */
+struct TestCoefficients
+{
+  double m_Z = 0; ///< Metallicity
+};
+
+/**
+ * @brief Another dummy coefficient block, to test the separation by type
+ */
+struct OtherTestCoefficients
+{
+  double m_Z = 0; ///< Metallicity
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE( MetallicityCacheTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( OperationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::MetallicityCache::Prune(); // Removes the entries left by the other tests, as the fixture may generate the same metallicity
+
+  Herd::Generic::Metallicity z( GenerateMetallicity() );  // @suppress("Invalid arguments")
+
+  std::size_t callCount = 0;
+  auto computer = [ & ]( Herd::Generic::Metallicity i_Z )
+  {
+    ++callCount;
+    return TestCoefficients { i_Z.Value() };
+  };
+
+  // Computed once, then shared
+  auto pFirst = Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  auto pSecond = Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  BOOST_CHECK_EQUAL( callCount, 1 );
+  BOOST_CHECK_EQUAL( pFirst, pSecond );
+  BOOST_CHECK_EQUAL( pFirst->m_Z, z.Value() );
+
+  // Different metallicity
+  Herd::Generic::Metallicity otherZ( z * 0.5 );
+  auto pThird = Herd::SSE::MetallicityCache::Get< TestCoefficients >( otherZ, computer );
+  BOOST_CHECK_EQUAL( callCount, 2 );
+  BOOST_CHECK_NE( pFirst, pThird );
+
+  // Same metallicity, different type
+  auto pOther = Herd::SSE::MetallicityCache::Get< OtherTestCoefficients >( z, [ & ]( Herd::Generic::Metallicity i_Z )
+  { return OtherTestCoefficients { 2 * i_Z.Value() };} );
+  BOOST_CHECK_EQUAL( pOther->m_Z, 2 * z.Value() );
+  BOOST_CHECK_EQUAL( pFirst->m_Z, z.Value() );
+
+  // Pruning retains the referenced entries only
+  std::size_t sizeBefore = Herd::SSE::MetallicityCache::Size();
+  pThird.reset();
+  Herd::SSE::MetallicityCache::Prune();
+  BOOST_CHECK_LT( Herd::SSE::MetallicityCache::Size(), sizeBefore );
+  BOOST_CHECK_EQUAL( Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer ), pFirst );
+  BOOST_CHECK_EQUAL( callCount, 2 );
+
+  Herd::SSE::MetallicityCache::Get< TestCoefficients >( otherZ, computer );
+  BOOST_CHECK_EQUAL( callCount, 3 );
+}
+
+// An entry is released with its last reference, without pruning
+BOOST_AUTO_TEST_CASE( ReleaseTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateMetallicity() );  // @suppress("Invalid arguments")
+
+  std::size_t callCount = 0;
+  auto computer = [ & ]( Herd::Generic::Metallicity i_Z )
+  {
+    ++callCount;
+    return TestCoefficients { i_Z.Value() };
+  };
+
+  // Not referenced, so released immediately
+  Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  BOOST_CHECK_EQUAL( callCount, 2 );
+
+  // Kept alive by the handles
+  auto pEntry = Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  Herd::SSE::MetallicityCache::Handles handles = Herd::SSE::MetallicityCache::Entries( z );
+  BOOST_CHECK_EQUAL( callCount, 3 );
+  BOOST_REQUIRE_EQUAL( handles.size(), 1 );
+  BOOST_CHECK_EQUAL( handles.front(), pEntry );
+
+  pEntry.reset();
+  Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  BOOST_CHECK_EQUAL( callCount, 3 );
+
+  // Released with the handles
+  handles.clear();
+  Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, computer );
+  BOOST_CHECK_EQUAL( callCount, 4 );
+}
+
+BOOST_AUTO_TEST_CASE( CanonicalMetallicityTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( Herd::SSE::Constants::s_CanonicalMetallicities[ GenerateNumber( 0u, 4u ) ] ); // @suppress("Invalid arguments")
+
+  std::size_t callCount = 0;
+  auto computer = [ & ]( Herd::Generic::Metallicity i_Z )
+  {
+    ++callCount;
+    return OtherTestCoefficients { i_Z.Value() };
+  };
+
+  // Retained after pruning, even if not referenced
+  Herd::SSE::MetallicityCache::Get< OtherTestCoefficients >( z, computer );
+  Herd::SSE::MetallicityCache::Prune();
+  Herd::SSE::MetallicityCache::Get< OtherTestCoefficients >( z, computer );
+  BOOST_CHECK_EQUAL( callCount, 1 );
+}
+
+BOOST_AUTO_TEST_CASE( ConcurrencyTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateMetallicity() );  // @suppress("Invalid arguments")
+
+  constexpr std::size_t threadCount = 8;
+  std::vector< std::shared_ptr< const TestCoefficients > > results( threadCount );
+  std::atomic< bool > bStart = false;
+  {
+    std::vector< std::jthread > threads;
+    for( std::size_t index = 0; index < threadCount; ++index )
+    {
+      threads.emplace_back( [ &, index ]()
+      {
+        while( !bStart )
+        {
+          std::this_thread::yield();
+        }
+
+        results[ index ] = Herd::SSE::MetallicityCache::Get< TestCoefficients >( z, []( Herd::Generic::Metallicity i_Z )
+        { return TestCoefficients { i_Z.Value() };} );
+      } );
+    }
+
+    bStart = true;
+  }
+
+  // Every thread sees the same entry, even if more than one computed it
+  for( const auto& pResult : results )
+  {
+    BOOST_CHECK_EQUAL( pResult, results.front() );
+  }
+  BOOST_CHECK_EQUAL( results.front()->m_Z, z.Value() );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
@@ -0,0 +1,132 @@
+/**
+ * @file TabulatedLandmarkUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/Landmarks/BaseOfGiantBranch.h>
+#include <SSE/Landmarks/HeliumIgnition.h>
+#include <SSE/Landmarks/TabulatedLandmark.h>
+#include <SSE/Landmarks/TerminalMainSequence.h>
+#include <SSE/Landmarks/ZeroAgeMainSequence.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/Quantity.h>
+#include <Generic/QuantityRange.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cmath>
+#include <memory>
+
+namespace
+{
+/**
+ * @brief Verifies that a tabulated landmark is within the tolerance of the analytic one
+ * @param io_rFixture Random number generator
+ * @param i_Z Metallicity
+ * @param i_rMassRange Tabulated mass range
+ * @param i_Tolerance Tolerance
+ */
+template< class TLandmark >
+void VerifyTable( Herd::UnitTestUtils::RandomTestFixture& io_rFixture, Herd::Generic::Metallicity i_Z, const Herd::Generic::ClosedRange& i_rMassRange,
+    double i_Tolerance )
+{
+  Herd::SSE::TabulatedLandmark tabulated( std::make_unique< TLandmark >( i_Z ), i_rMassRange, i_Tolerance );
+  TLandmark analytic( i_Z );
+
+  BOOST_TEST( tabulated.Breakpoints() == analytic.Breakpoints() ); // @suppress("Invalid arguments")
+
+  auto IsWithinTolerance = [ & ]( double i_Actual, double i_Expected )
+  {
+    return std::abs( i_Actual - i_Expected ) <= 2 * i_Tolerance * std::abs( i_Expected );  // Check points bound the error between them, with a margin
+  };
+
+  // Random masses
+  for( std::size_t index = 0; index < 1000; ++index )
+  {
+    Herd::Generic::Mass mass( io_rFixture.GenerateNumber( i_rMassRange.Lower(), i_rMassRange.Upper() ) ); // @suppress("Invalid arguments")
+    BOOST_TEST( IsWithinTolerance( tabulated.Age( mass ), analytic.Age( mass ) ) ); // @suppress("Invalid arguments")
+    BOOST_TEST( IsWithinTolerance( tabulated.Luminosity( mass ), analytic.Luminosity( mass ) ) ); // @suppress("Invalid arguments")
+    BOOST_TEST( IsWithinTolerance( tabulated.Radius( mass ), analytic.Radius( mass ) ) ); // @suppress("Invalid arguments")
+
+    Herd::SSE::LandmarkValues values = tabulated.Evaluate( mass );
+    BOOST_TEST( values.m_Age == tabulated.Age( mass ) ); // @suppress("Invalid arguments")
+    BOOST_TEST( values.m_Luminosity == tabulated.Luminosity( mass ) ); // @suppress("Invalid arguments")
+    BOOST_TEST( values.m_Radius == tabulated.Radius( mass ) ); // @suppress("Invalid arguments")
+  }
+
+  // Breakpoints, and their immediate neighbourhood
+  for( auto breakpoint : analytic.Breakpoints() )
+  {
+    for( double offset : { -1e-9, 0., 1e-9 } )
+    {
+      Herd::Generic::Mass mass( breakpoint + offset );
+      if( i_rMassRange.Contains( mass ) )
+      {
+        BOOST_TEST( IsWithinTolerance( tabulated.Luminosity( mass ), analytic.Luminosity( mass ) ) ); // @suppress("Invalid arguments")
+        BOOST_TEST( IsWithinTolerance( tabulated.Radius( mass ), analytic.Radius( mass ) ) ); // @suppress("Invalid arguments")
+      }
+    }
+  }
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE( TabulatedLandmarkTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateMetallicity() );
+  Herd::Generic::ClosedRange massRange( 0.5, 50. );
+
+  BOOST_CHECK_THROW( Herd::SSE::TabulatedLandmark( nullptr, massRange, 1e-4 ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::SSE::TabulatedLandmark( std::make_unique< Herd::SSE::BaseOfGiantBranch >( z ), Herd::Generic::ClosedRange( 0., 50. ), 1e-4 ),
+      Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::SSE::TabulatedLandmark( std::make_unique< Herd::SSE::BaseOfGiantBranch >( z ), Herd::Generic::ClosedRange( 1., 1. ), 1e-4 ),
+      Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::SSE::TabulatedLandmark( std::make_unique< Herd::SSE::BaseOfGiantBranch >( z ), massRange, 0. ), Herd::Exceptions::PreconditionError );
+
+  // Outside of the tabulated range, the analytic path is used
+  Herd::SSE::TabulatedLandmark tabulated( std::make_unique< Herd::SSE::BaseOfGiantBranch >( z ), massRange, 1e-4 );
+  Herd::SSE::BaseOfGiantBranch analytic( z );
+  Herd::Generic::Mass mass( GenerateNumber( massRange.Upper() + 1., 100. ) ); // @suppress("Invalid arguments")
+  BOOST_TEST( tabulated.Age( mass ) == analytic.Age( mass ) ); // @suppress("Invalid arguments")
+  BOOST_CHECK_THROW( tabulated.Age( Herd::Generic::Mass( 0. ) ), Herd::Exceptions::PreconditionError );
+
+  BOOST_TEST( tabulated.KnotCount() > 0 ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( AccuracyTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateMetallicity() );
+  double tolerance = GenerateNumber( 1e-7, 1e-4 ); // @suppress("Invalid arguments")
+  Herd::Generic::ClosedRange massRange( 0.2, 100. );
+
+  VerifyTable< Herd::SSE::ZeroAgeMainSequence >( *this, z, massRange, tolerance );
+  VerifyTable< Herd::SSE::TerminalMainSequence >( *this, z, massRange, tolerance );
+  VerifyTable< Herd::SSE::BaseOfGiantBranch >( *this, z, massRange, tolerance );
+  VerifyTable< Herd::SSE::HeliumIgnition >( *this, z, massRange, tolerance );
+}
+
+BOOST_AUTO_TEST_CASE( ToleranceTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Metallicity z( GenerateMetallicity() );
+  Herd::Generic::ClosedRange massRange( 0.2, 100. );
+
+  // A tighter tolerance needs more knots
+  Herd::SSE::TabulatedLandmark coarse( std::make_unique< Herd::SSE::TerminalMainSequence >( z ), massRange, 1e-3 );
+  Herd::SSE::TabulatedLandmark fine( std::make_unique< Herd::SSE::TerminalMainSequence >( z ), massRange, 1e-7 );
+  BOOST_TEST( coarse.KnotCount() < fine.KnotCount() ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+/**
+ * @file ZeroAgeMainSequenceUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/Landmarks/Utilities.h>
+#include <SSE/Landmarks/ZeroAgeMainSequence.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+BOOST_FIXTURE_TEST_SUITE( ZeroAgeMainSequenceTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( BatchValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::ZeroAgeMainSequence computer( Herd::Generic::Metallicity( GenerateNumber( 1e-4, 3e-2 ) ) ); // @suppress("Invalid arguments")
+
+  std::vector< double > masses( 10, GenerateNumber( 0.5, 50. ) );  // @suppress("Invalid arguments")
+  std::vector< double > luminosities( masses.size() );
+  std::vector< double > radii( masses.size() );
+
+  BOOST_CHECK_NO_THROW( computer.Compute( masses, luminosities, radii ) );
+  BOOST_CHECK_NO_THROW( computer.Compute( {}, {}, {} ) );
+
+  std::vector< double > tooShort( masses.size() - 1 );
+  BOOST_CHECK_THROW( computer.Compute( masses, tooShort, radii ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( computer.Compute( masses, luminosities, tooShort ), Herd::Exceptions::PreconditionError );
+
+  masses.back() = -masses.back();
+  BOOST_CHECK_THROW( computer.Compute( masses, luminosities, radii ), Herd::Exceptions::PreconditionError );
+
+  masses.back() = std::numeric_limits< double >::quiet_NaN();
+  BOOST_CHECK_THROW( computer.Compute( masses, luminosities, radii ), Herd::Exceptions::PreconditionError );
+}
+
+BOOST_AUTO_TEST_CASE( BatchConsistencyTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::ZeroAgeMainSequence computer( Herd::Generic::Metallicity( GenerateNumber( 1e-4, 3e-2 ) ) ); // @suppress("Invalid arguments")
+
+  // Not a multiple of the block size, to exercise the partial block
+  std::size_t batchSize = GenerateNumber( 0, 3 ) * Herd::SSE::s_BatchBlockSize + GenerateNumber( 1, Herd::SSE::s_BatchBlockSize - 1 );  // @suppress("Invalid arguments")
+  std::vector< double > masses( batchSize );
+  for( auto& rMass : masses )
+  {
+    rMass = GenerateNumber( 0.2, 100. );  // @suppress("Invalid arguments")
+  }
+
+  std::vector< double > luminosities( batchSize );
+  std::vector< double > radii( batchSize );
+  computer.Compute( masses, luminosities, radii );
+
+  // The batch may sum the terms in a different order than the single-mass interface
+  for( std::size_t index = 0; index < batchSize; ++index )
+  {
+    Herd::Generic::Mass mass( masses[ index ] );
+    BOOST_TEST( luminosities[ index ] == computer.Luminosity( mass ).Value(), boost::test_tools::tolerance( 1e-12 ) );
+    BOOST_TEST( radii[ index ] == computer.Radius( mass ).Value(), boost::test_tools::tolerance( 1e-12 ) );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
@@ -0,0 +1,42 @@
+/**
+ * @file Utilities.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "Utilities.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <range/v3/algorithm.hpp>
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_Values Values
+ * @param i_Lower Lower bound, inclusive
+ * @param i_Upper Upper bound, inclusive
+ * @param i_pName Name of the batch, for the error message
+ * @param i_pExpected Expected range, for the error message
+ * @throws PreconditionError If any value is outside of the range, or is NaN
+ * @remarks Validates the entire batch in a single pass, before any computations
+ */
+void ThrowIfAnyNotInRange( std::span< const double > i_Values, double i_Lower, double i_Upper, const char* i_pName, const char* i_pExpected )
+{
+  auto itInvalid = ranges::cpp20::find_if( i_Values, [ = ]( double i_Value )
+  { return !( i_Value >= i_Lower && i_Value <= i_Upper );} );  // Negated, so that NaN is caught as well
+
+  if( itInvalid != i_Values.end() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( i_pName, i_pExpected, *itInvalid );
+  }
+}
+
+}
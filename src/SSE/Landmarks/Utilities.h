@@ -15,15 +15,18 @@
 
 #include <Generic/Quantity.h>
 
-#include <optional>
+#include <span>
+
+#include "Eigen/Core"
 
 namespace Herd::SSE
 {
-template< class TValue, class TCallable >
-auto UpdateCache( std::pair< std::optional< Herd::Generic::Mass >, TValue >& io_rCache, Herd::Generic::Mass i_Mass, const TCallable& i_Computer ); ///< Updates a cache entry
-}
+// Batch computations
+inline constexpr int s_BatchBlockSize = 256;  ///< Number of masses processed together in the batch computations
+using TBatchBlock = Eigen::Array< double, Eigen::Dynamic, 1, Eigen::ColMajor, s_BatchBlockSize, 1 >; ///< Block of values in a batch computation. Fixed capacity, so that it lives on the stack
 
+void ThrowIfAnyNotInRange( std::span< const double > i_Values, double i_Lower, double i_Upper, const char* i_pName, const char* i_pExpected ); ///< Validates a batch of values against a closed range
+}
 
-#include "Utilities.hpp"
 
 #endif /* HCF240618_F624_4732_A909_FD02EDD0311C */
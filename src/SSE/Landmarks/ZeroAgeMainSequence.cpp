@@ -13,19 +13,23 @@
 #include "ZeroAgeMainSequence.h"
 
 #include "Constants.h"
+#include "MetallicityCache.h"
 #include "Utilities.h"
 
+#include <Exceptions/ExceptionWrappers.h>
 #include <Generic/MathHelpers.h>
+#include <Generic/Profiling.h>
 #include <Generic/Quantity.h>
 #include <Generic/QuantityRange.h>
 #include <Physics/LuminosityRadiusTemperature.h>
 
+#include <algorithm>
 #include <cmath>
 
 namespace
 {
 // @formatter:off
-const std::array<double, 35 > s_ZL { 3.970417e-01, -3.2913574e-01, 3.4776688e-01, 3.7470851e-01, 9.011915e-02,
+constexpr std::array< double, 35 > s_ZL { 3.970417e-01, -3.2913574e-01, 3.4776688e-01, 3.7470851e-01, 9.011915e-02,
     8.527626e+00, -2.441225973e+01, 5.643597107e+01, 3.706152575e+01, 5.4562406e+00,
     2.5546e-04, -1.23461e-03, -2.3246e-04, 4.5519e-04, 1.6176e-04,
     5.432889e+00, -8.62157806e+00, 1.344202049e+01, 1.451584135e+01, 3.39793084e+00,
@@ -34,7 +38,7 @@ const std::array<double, 35 > s_ZL { 3.970417e-01, -3.2913574e-01, 3.4776688e-01
     5.86685e-03, -1.704237e-02, 3.872348e-02, 2.570041e-02, 3.83376e-03
 };  ///< Coefficients for \f$ L_{ZAMS}(z) \f$
 
-const std::array< double, 45 > s_ZR { 1.715359e+00, 6.2246212e-01, -9.2557761e-01, -1.16996966e+00, -3.0631491e-01,
+constexpr std::array< double, 45 > s_ZR { 1.715359e+00, 6.2246212e-01, -9.2557761e-01, -1.16996966e+00, -3.0631491e-01,
     6.597788e+00, -4.2450044e-01, -1.213339427e+01, -1.073509484e+01, -2.51487077e+00,
     1.008855000e+01, -7.11727086e+00, -3.167119479e+01, -2.424848322e+01, -5.33608972e+00,
     1.012495e+00, 3.2699690e-01, -9.23418e-03, -3.876858e-02, -4.12750e-03,
@@ -60,7 +64,7 @@ struct ZeroAgeMainSequenceAlgorithmSpecs;
 ZeroAgeMainSequence::ZeroAgeMainSequence( Herd::Generic::Metallicity i_Z )
 {
   ZeroAgeMainSequenceSpecs::s_ZRange.ThrowIfNotInRange( i_Z, "i_Z" );  // Metallicity is within the allowed range
-  ComputeMetallicityDependents( i_Z );
+  m_pCoefficients = Herd::SSE::MetallicityCache::Get< Coefficients >( i_Z, &ZeroAgeMainSequence::ComputeCoefficients );
 }
 
 /**
@@ -71,6 +75,8 @@ ZeroAgeMainSequence::ZeroAgeMainSequence( Herd::Generic::Metallicity i_Z )
  */
 Herd::Generic::Time ZeroAgeMainSequence::Age( [[maybe_unused]] Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkAge );
+
   // This is only needed to simplify the unit test code, which expects all derived classes of ILandmark to throw at an invalid mass value
   ZeroAgeMainSequenceSpecs::s_MassRange.ThrowIfNotInRange( i_Mass, "i_Mass" );  // Mass is within the allowed range
 
@@ -85,10 +91,12 @@ Herd::Generic::Time ZeroAgeMainSequence::Age( [[maybe_unused]] Herd::Generic::Ma
  */
 Herd::Generic::Luminosity ZeroAgeMainSequence::Luminosity( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkLuminosity );
+
   ZeroAgeMainSequenceSpecs::s_MassRange.ThrowIfNotInRange( i_Mass, "i_Mass" );  // Mass is within the allowed range
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Luminosity, i_Mass, [ & ]( auto i_Mass ){ return ComputeLuminosity(i_Mass);} ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Values.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeValues(i_Mass);} ).m_Luminosity; // @suppress("Invalid arguments")
     // @formatter:on
 }
   /**
@@ -99,89 +107,194 @@ Herd::Generic::Luminosity ZeroAgeMainSequence::Luminosity( Herd::Generic::Mass i
    */
 Herd::Generic::Radius ZeroAgeMainSequence::Radius( Herd::Generic::Mass i_Mass )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkRadius );
+
   ZeroAgeMainSequenceSpecs::s_MassRange.ThrowIfNotInRange( i_Mass, "i_Mass" );  // Mass is within the allowed range
 
   // @formatter:off
-  return Herd::SSE::UpdateCache( m_MDependents.m_Radius, i_Mass, [ & ]( auto i_Mass ){ return ComputeRadius( i_Mass); } ); // @suppress("Invalid arguments")
+  return m_MDependents.m_Values.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeValues( i_Mass); } ).m_Radius; // @suppress("Invalid arguments")
     // @formatter:on
 }
 
 /**
- * @param i_Z Metallicity
+ * @param i_Mass Mass
+ * @returns \f$ t_{ZAMS} \f$, \f$ L_{ZAMS}\f$ and \f$ R_{ZAMS}\f$
+ * @pre \c i_Mass is within the range specified in \c ZeroAgeMainSequenceSpecs
+ * @throws PreconditionError If the precondition is violated
+ * @remarks Cheaper than separate calls to \c Luminosity and \c Radius: The mass is validated once, and the cache is queried once
  */
-void ZeroAgeMainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z )
+Herd::SSE::LandmarkValues ZeroAgeMainSequence::Evaluate( Herd::Generic::Mass i_Mass )
 {
-  std::array< double, 5 > zetaPowers;
-  double logZeta = log10( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 );
-  Herd::Generic::ComputePowers( zetaPowers, logZeta );
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_LandmarkEvaluate );
 
-  // Eq. 3
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_LZAMS, s_ZL, zetaPowers );
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_RZAMS, s_ZR, zetaPowers );
+  ZeroAgeMainSequenceSpecs::s_MassRange.ThrowIfNotInRange( i_Mass, "i_Mass" );  // Mass is within the allowed range
+
+  // @formatter:off
+  return m_MDependents.m_Values.Get( i_Mass, [ & ]( auto i_Mass ){ return ComputeValues( i_Mass); } ); // @suppress("Invalid arguments")
+    // @formatter:on
 }
 
 /**
- * @param i_Mass Mass
- * @return \f$ L_{ZAMS} \f$
+ * @return Masses at which the landmark functions are not smooth. None for ZAMS
+ */
+std::vector< Herd::Generic::Mass > ZeroAgeMainSequence::Breakpoints() const
+{
+  return {};
+}
+
+/**
+ * @return Total hit and miss counts of the mass caches
  */
-Herd::Generic::Luminosity ZeroAgeMainSequence::ComputeLuminosity( Herd::Generic::Mass i_Mass ) const
+Herd::SSE::MassCacheStatistics ZeroAgeMainSequence::CacheStatistics() const
 {
-  auto& rA = m_ZDependents.m_LZAMS;
+  return m_MDependents.m_Values.Statistics();
+}
 
-  // Powers of mass
-  std::array< double, 6 > massPowers;
+/**
+ * @param i_Masses Masses
+ * @param[out] o_Luminosities \f$ L_{ZAMS} \f$ for each mass. Caller-allocated
+ * @param[out] o_Radii \f$ R_{ZAMS} \f$ for each mass. Caller-allocated
+ * @pre Each element of \c i_Masses is within the range specified in \c ZeroAgeMainSequenceSpecs
+ * @pre \c o_Luminosities and \c o_Radii have the same size as \c i_Masses
+ * @throws PreconditionError If any preconditions are violated
+ * @remarks The masses are validated once, before any computation. Then the equations are evaluated over blocks of masses with Eigen arrays, which vectorise for the instruction set the library is compiled for
+ * @remarks Does not use or update the cache of the single-mass interface
+ */
+void ZeroAgeMainSequence::Compute( std::span< const double > i_Masses, std::span< double > o_Luminosities, std::span< double > o_Radii ) const
+{
+  if( o_Luminosities.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_Luminosities", "Same size as i_Masses", o_Luminosities.size() );
+  }
 
-  double m05 = std::sqrt( i_Mass );
-  double m20 = i_Mass * i_Mass;
-  massPowers[ 0 ] = 1;
-  massPowers[ 1 ] = m20 * i_Mass;  // m^3
-  massPowers[ 2 ] = massPowers[ 1 ] * m20;  // m^5
-  massPowers[ 3 ] = massPowers[ 2 ] * m20;  // m^7
-  massPowers[ 4 ] = massPowers[ 3 ] * i_Mass; // m^8
-  massPowers[ 5 ] = massPowers[ 4 ] * i_Mass * m05; // m^9.5
+  if( o_Radii.size() != i_Masses.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_Radii", "Same size as i_Masses", o_Radii.size() );
+  }
 
-  double m55 = massPowers[ 2 ] * m05; // m5.5
+  const auto& rMassRange = ZeroAgeMainSequenceSpecs::s_MassRange;
+  Herd::SSE::ThrowIfAnyNotInRange( i_Masses, rMassRange.Lower(), rMassRange.Upper(), "i_Masses", rMassRange.GetRangeString().c_str() );
 
-  // Eq. 1
-  double num = m55 * ( rA[ 0 ] + m55 * rA[ 1 ] );
-  double den = Herd::Generic::ComputeInnerProduct( { rA[ 2 ], 1., rA[ 3 ], rA[ 4 ], rA[ 5 ], rA[ 6 ] }, massPowers );
+  const auto& rL = m_pCoefficients->m_LZAMS;
+  const auto& rR = m_pCoefficients->m_RZAMS;
 
-  return Herd::Generic::Luminosity( num / den );
+  using TBlock = Herd::SSE::TBatchBlock;
+  using TConstMap = Eigen::Map< const Eigen::ArrayXd >;
+  using TMap = Eigen::Map< Eigen::ArrayXd >;
+
+  for( std::size_t offset = 0; offset < i_Masses.size(); offset += s_BatchBlockSize )
+  {
+    Eigen::Index blockSize = std::min< Eigen::Index >( s_BatchBlockSize, i_Masses.size() - offset );
+    TConstMap mass( i_Masses.data() + offset, blockSize );
+
+    // Powers of mass. Same products as the single-mass computations
+    TBlock m05 = mass.sqrt();
+    TBlock m20 = mass * mass;
+    TBlock m30 = m20 * mass;
+    TBlock m50 = m30 * m20;
+    TBlock m70 = m50 * m20;
+    TBlock m80 = m70 * mass;
+
+    // Eq. 1
+    {
+      TBlock m55 = m50 * m05;
+      TBlock m95 = m80 * mass * m05;
+
+      TMap( o_Luminosities.data() + offset, blockSize ) = ( m55 * ( rL[ 0 ] + m55 * rL[ 1 ] ) )
+          / ( rL[ 2 ] + m30 + rL[ 3 ] * m50 + rL[ 4 ] * m70 + rL[ 5 ] * m80 + rL[ 6 ] * m95 );
+    }
+
+    // Eq. 2
+    {
+      TBlock m25 = m20 * m05;
+      TBlock m65 = m30 * m30 * m05;
+      TBlock m110 = m30 * m30 * m50;
+      TBlock m190 = m65 * m65 * m50 * mass;
+      TBlock m195 = m190 * m05;
+      TBlock m85 = m65 * m20;
+      TBlock m185 = m110 * m65 * mass;
+
+      TMap( o_Radii.data() + offset, blockSize ) = ( rR[ 0 ] * m25 + rR[ 1 ] * m65 + rR[ 2 ] * m110 + rR[ 3 ] * m190 + rR[ 4 ] * m195 )
+          / ( rR[ 5 ] + rR[ 6 ] * m20 + rR[ 7 ] * m85 + m185 + rR[ 8 ] * m195 );
+    }
+  }
 }
 
 /**
- * @param i_Mass Mass
- * @return \f$ R_{ZAMS}\f$
+ * @param i_Z Metallicity
+ * @return Coefficients
  */
-Herd::Generic::Radius ZeroAgeMainSequence::ComputeRadius( Herd::Generic::Mass i_Mass ) const
+ZeroAgeMainSequence::Coefficients ZeroAgeMainSequence::ComputeCoefficients( Herd::Generic::Metallicity i_Z )
 {
-  auto& rA = m_ZDependents.m_RZAMS;
+  std::array< double, 5 > zetaPowers;
+  double logZeta = log10( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 );
+  Herd::Generic::ComputePowers( zetaPowers, logZeta );
 
-  // Powers of mass
+  // Eq. 3
+  Coefficients coefficients;
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_LZAMS, s_ZL, zetaPowers );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_RZAMS, s_ZR, zetaPowers );
+
+  return coefficients;
+}
+
+/**
+ * @param i_Mass Mass
+ * @return \f$ t_{ZAMS} \f$, \f$ L_{ZAMS} \f$ and \f$ R_{ZAMS}\f$
+ */
+Herd::SSE::LandmarkValues ZeroAgeMainSequence::ComputeValues( Herd::Generic::Mass i_Mass ) const
+{
+  // Powers of mass, shared by both equations
   double m05 = std::sqrt( i_Mass );
   double m20 = i_Mass * i_Mass;
   double m30 = m20 * i_Mass;
   double m50 = m30 * m20;
 
-  std::array< double, 5 > massPowersNum;
-  massPowersNum[ 0 ] = m20 * m05; // m^2.5
-  massPowersNum[ 1 ] = m30 * m30 * m05; // m^6.5
-  massPowersNum[ 2 ] = m30 * m30 * m50; // m^11
-  massPowersNum[ 3 ] = massPowersNum[ 1 ] * massPowersNum[ 1 ] * m50 * i_Mass; // m^19
-  massPowersNum[ 4 ] = massPowersNum[ 3 ] * m05;  // m^19.5
+  Herd::SSE::LandmarkValues values;
+  values.m_Age.Set( 0. );
+
+  // Eq. 1
+  {
+    auto& rA = m_pCoefficients->m_LZAMS;
 
-  std::array< double, 5 > massPowersDen;
-  massPowersDen[ 0 ] = 1;
-  massPowersDen[ 1 ] = m20;
-  massPowersDen[ 2 ] = massPowersNum[ 1 ] * m20;  // m^8.5
-  massPowersDen[ 3 ] = massPowersNum[ 2 ] * massPowersNum[ 1 ] * i_Mass; // m^18.5
-  massPowersDen[ 4 ] = massPowersNum[ 4 ];  // m^19.5
+    std::array< double, 6 > massPowers;
+    massPowers[ 0 ] = 1;
+    massPowers[ 1 ] = m30;
+    massPowers[ 2 ] = m50;
+    massPowers[ 3 ] = m50 * m20;  // m^7
+    massPowers[ 4 ] = massPowers[ 3 ] * i_Mass; // m^8
+    massPowers[ 5 ] = massPowers[ 4 ] * i_Mass * m05; // m^9.5
+
+    double m55 = m50 * m05; // m5.5
+
+    double num = m55 * ( rA[ 0 ] + m55 * rA[ 1 ] );
+    double den = Herd::Generic::ComputeInnerProduct( { rA[ 2 ], 1., rA[ 3 ], rA[ 4 ], rA[ 5 ], rA[ 6 ] }, massPowers );
+    values.m_Luminosity.Set( num / den );
+  }
 
   // Eq. 2
-  double num = Herd::Generic::ComputeInnerProduct( { rA[ 0 ], rA[ 1 ], rA[ 2 ], rA[ 3 ], rA[ 4 ] }, massPowersNum );
-  double den = Herd::Generic::ComputeInnerProduct( { rA[ 5 ], rA[ 6 ], rA[ 7 ], 1., rA[ 8 ] }, massPowersDen );
+  {
+    auto& rA = m_pCoefficients->m_RZAMS;
+
+    std::array< double, 5 > massPowersNum;
+    massPowersNum[ 0 ] = m20 * m05; // m^2.5
+    massPowersNum[ 1 ] = m30 * m30 * m05; // m^6.5
+    massPowersNum[ 2 ] = m30 * m30 * m50; // m^11
+    massPowersNum[ 3 ] = massPowersNum[ 1 ] * massPowersNum[ 1 ] * m50 * i_Mass; // m^19
+    massPowersNum[ 4 ] = massPowersNum[ 3 ] * m05;  // m^19.5
 
-  return Herd::Generic::Radius( num / den );
+    std::array< double, 5 > massPowersDen;
+    massPowersDen[ 0 ] = 1;
+    massPowersDen[ 1 ] = m20;
+    massPowersDen[ 2 ] = massPowersNum[ 1 ] * m20;  // m^8.5
+    massPowersDen[ 3 ] = massPowersNum[ 2 ] * massPowersNum[ 1 ] * i_Mass; // m^18.5
+    massPowersDen[ 4 ] = massPowersNum[ 4 ];  // m^19.5
+
+    double num = Herd::Generic::ComputeInnerProduct( { rA[ 0 ], rA[ 1 ], rA[ 2 ], rA[ 3 ], rA[ 4 ] }, massPowersNum );
+    double den = Herd::Generic::ComputeInnerProduct( { rA[ 5 ], rA[ 6 ], rA[ 7 ], 1., rA[ 8 ] }, massPowersDen );
+    values.m_Radius.Set( num / den );
+  }
+
+  return values;
 }
 } // namespace Herd::SSE
-
@@ -14,13 +14,15 @@
 #define HD2D9C3D9_9FCD_46C9_ABA8_24F21756CD03
 
 #include "ILandmark.h"
+#include "MassCache.h"
 
 #include <Generic/Quantity.h>
 #include <Generic/QuantityRange.h>
 
 #include <array>
-#include <optional>
-#include <utility>
+#include <memory>
+#include <span>
+#include <vector>
 
 namespace Herd::SSE
 {
@@ -29,7 +31,7 @@ namespace Herd::SSE
  * @brief Computes the track point at ZAMS
  * @cite Tout96
  */
-class ZeroAgeMainSequence : public ILandmark
+class ZeroAgeMainSequence final : public ILandmark
 {
 public:
 
@@ -38,24 +40,30 @@ public:
   Herd::Generic::Time Age( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{ZAMS} \f$
   Herd::Generic::Luminosity Luminosity( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ L_{ZAMS} \f$
   Herd::Generic::Radius Radius( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ R_{ZAMS} \f$
+  Herd::SSE::LandmarkValues Evaluate( Herd::Generic::Mass i_Mass ) override;  ///< Returns \f$ t_{ZAMS} \f$, \f$ L_{ZAMS} \f$ and \f$ R_{ZAMS} \f$
 
-private:
+  std::vector< Herd::Generic::Mass > Breakpoints() const override; ///< Returns the masses at which the landmark functions are not smooth
+  Herd::SSE::MassCacheStatistics CacheStatistics() const override; ///< Returns the hit and miss counts of the mass caches
+
+  void Compute( std::span< const double > i_Masses, std::span< double > o_Luminosities, std::span< double > o_Radii ) const; ///< Computes \f$ L_{ZAMS} \f$ and \f$ R_{ZAMS} \f$ for a batch of masses
 
-  void ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z );  ///< Computes the metallicity dependents
+private:
 
-  Herd::Generic::Luminosity ComputeLuminosity( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ L_{ZAMS} \f$
-  Herd::Generic::Radius ComputeRadius( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ R_{ZAMS} \f$
+  Herd::SSE::LandmarkValues ComputeValues( Herd::Generic::Mass i_Mass ) const;  ///< Computes \f$ L_{ZAMS} \f$ and \f$ R_{ZAMS} \f$
 
   /**
-   * @brief Various quantities and values that depend on the metallicity only
+   * @brief Equation coefficients that depend on the metallicity only
+   * @remarks Shared via MetallicityCache
    */
-  struct MetallicityDependents
+  struct Coefficients
   {
     std::array< double, 7 > m_LZAMS;  ///< Coefficients for \f$ L_{ZAMS}\f$
     std::array< double, 9 > m_RZAMS;  ///< Coefficients for \f$ R_{ZAMS}\f$
   };
 
-  MetallicityDependents m_ZDependents;  ///< Metallicity dependents
+  static Coefficients ComputeCoefficients( Herd::Generic::Metallicity i_Z );  ///< Computes the metallicity-dependent coefficients
+
+  std::shared_ptr< const Coefficients > m_pCoefficients; ///< Metallicity-dependent coefficients
 
   /**
    * @brief Various quantities and values that depend on mass
@@ -63,10 +71,7 @@ private:
    */
   struct MassDependents
   {
-    using TKey = std::optional< Herd::Generic::Mass >;
-
-    std::pair< TKey, Herd::Generic::Luminosity > m_Luminosity; ///< \f$ L_{ZAMS}\f$
-    std::pair< TKey, Herd::Generic::Radius > m_Radius;  ///< \f$ R_{ZAMS} \f$
+    Herd::SSE::MassCache< Herd::SSE::LandmarkValues > m_Values; ///< \f$ L_{ZAMS}\f$ and \f$ R_{ZAMS} \f$. Computed together, as they share the powers of mass
   };
 
   MassDependents m_MDependents; ///< Mass dependents
@@ -15,11 +15,14 @@
 #include "EvolutionState.h"
 
 #include <Generic/MathHelpers.h>
+#include <Generic/Profiling.h>
+#include <Generic/ValidationPolicy.h>
 #include <Physics/LuminosityRadiusTemperature.h>
 #include <SSE/Landmarks/BaseOfGiantBranch.h>
 #include <SSE/Landmarks/Constants.h>
 #include <SSE/Landmarks/CriticalMassValues.h>
 #include <SSE/Landmarks/HeliumIgnition.h>
+#include <SSE/Landmarks/MetallicityCache.h>
 #include <SSE/Landmarks/TerminalMainSequence.h>
 #include <SSE/Landmarks/ZeroAgeMainSequence.h>
 
@@ -36,7 +39,7 @@ namespace
 
 // @formatter:off
 
-const std::array< double, 44 > s_ZAlphaL { 2.321400e-01, 1.828075e-03, -2.232007e-02, -3.378734e-03,
+constexpr std::array< double, 44 > s_ZAlphaL { 2.321400e-01, 1.828075e-03, -2.232007e-02, -3.378734e-03,
   1.163659e-02, 3.427682e-03, 1.421393e-03, -3.710666e-03,
   1.048020e-02, -1.231921e-02, -1.686860e-02, -4.234354e-03,
   1.555590e+00, -3.223927e-01, -5.197429e-01, -1.066441e-01,
@@ -49,20 +52,20 @@ const std::array< double, 44 > s_ZAlphaL { 2.321400e-01, 1.828075e-03, -2.232007
   0.3625e+00, 0.062e+00, 0., 0.
 };  ///< Coefficients for \f$ alpha_L(z) \f$
 
-std::array< double, 20 > s_ZBetaL { 3.855707e-01, -6.104166e-01, 5.676742e+00, 1.060894e+01, 5.284014e+00,
+constexpr std::array< double, 20 > s_ZBetaL { 3.855707e-01, -6.104166e-01, 5.676742e+00, 1.060894e+01, 5.284014e+00,
   3.579064e-01, -6.442936e-01, 5.494644e+00, 1.054952e+01, 5.280991e+00,
   9.587587e-01, 8.777464e-01, 2.017321e-01, 0., 0.,
   1.5135e+00, 0.3769e+00, 0., 0., 0.
 };  ///< Coefficients for \f$ beta_L(z) \f$
 
-std::array<double, 20 > s_ZLhook{1.910302e-01, 1.158624e-01, 3.348990e-02, 2.599706e-03,
+constexpr std::array< double, 20 > s_ZLhook { 1.910302e-01, 1.158624e-01, 3.348990e-02, 2.599706e-03,
   3.931056e-01, 7.277637e-02, -1.366593e-01,-4.508946e-02,
   3.267776e-01, 1.204424e-01, 9.988332e-02, 2.455361e-02,
   5.990212e-01, 5.570264e-02, 6.207626e-02, 1.777283e-02,
   1.5135e+00, 0.3769e+00, 0., 0.
 };  ///< Coefficients for \f$ L_{hook}(z) \f$
 
-const std::array< double, 65 > s_ZAlphaR { 4.907546e-01, -1.683928e-01, -3.108742e-01, -7.202918e-02, 0.,
+constexpr std::array< double, 65 > s_ZAlphaR { 4.907546e-01, -1.683928e-01, -3.108742e-01, -7.202918e-02, 0.,
   4.537070e+00, -4.465455e+00, -1.612690e+00, -1.623246e+00, 0.,
     1.796220e+00, 2.814020e-01, 1.423325e+00, 3.421036e-01, 0.,
     2.256216e+00, 3.773400e-01, 1.537867e+00, 4.396373e-01, 0.,
@@ -77,7 +80,7 @@ const std::array< double, 65 > s_ZAlphaR { 4.907546e-01, -1.683928e-01, -3.10874
     0.136e+00, 0.0352e+00, 0., 0., 0.
 };  ///< Coefficients for \f$ \alpha_R(z) \f$ calculations
 
-const std::array< double, 24 > s_ZBetaR { 1.071489e+00, -1.164852e-01, -8.623831e-02, -1.582349e-02,
+constexpr std::array< double, 24 > s_ZBetaR { 1.071489e+00, -1.164852e-01, -8.623831e-02, -1.582349e-02,
   7.108492e-01, 7.935927e-01, 3.926983e-01, 3.622146e-02,
     3.478514e+00, -2.585474e-02, -1.512955e-02, -2.833691e-03,
     3.969331e-03, 4.539076e-03, 1.720906e-03, 1.897857e-04,
@@ -85,7 +88,7 @@ const std::array< double, 24 > s_ZBetaR { 1.071489e+00, -1.164852e-01, -8.623831
     1.6e+00, 0.764e+00, 0.3322e+00, 0.
 };  ///< Coefficients for \f$ \beta_R(z) \f$ calculations
 
-const std::array< double, 48 > s_ZGammaR { 1.192334e-02, 1.083057e-02, 1.230969e+00, 1.551656e+00,
+constexpr std::array< double, 48 > s_ZGammaR { 1.192334e-02, 1.083057e-02, 1.230969e+00, 1.551656e+00,
   -1.668868e-01, 5.818123e-01, -1.105027e+01, -1.668070e+01,
   7.615495e-01, 1.068243e-01, -2.011333e-01, -9.371415e-02,
  -1.015564e-01, -2.161264e-01, -5.182516e-02, 0.,
@@ -99,7 +102,7 @@ const std::array< double, 48 > s_ZGammaR { 1.192334e-02, 1.083057e-02, 1.230969e
   -0.2711e+00, -0.5756e+00, -0.0838e+00, 0.
 };   ///< Coefficients for \f$ \gamma_R(z) \f$ calculations
 
-const std::array< double, 28 > s_ZRhook { 7.330122e-01, 5.192827e-01, 2.316416e-01, 8.346941e-03,
+constexpr std::array< double, 28 > s_ZRhook { 7.330122e-01, 5.192827e-01, 2.316416e-01, 8.346941e-03,
   1.172768e+00, -1.209262e-01, -1.193023e-01, -2.859837e-02,
   3.982622e-01, -2.296279e-01, -2.262539e-01, -5.219837e-02,
   3.571038e+00, -2.223625e-02, -2.611794e-02, -6.359648e-03,
@@ -120,14 +123,21 @@ using Herd::Generic::BXhC;
 
 /**
  * @param i_InitialMetallicity Metallicity at ZAMS
+ * @param[in, out] io_pResource Memory resource for the landmark computers. Must outlive the object
  * @pre \c i_InitialMetallicity is in (0,1]
  * @throws PreconditionError If the precondition is violated
  */
-MainSequence::MainSequence( Herd::Generic::Metallicity i_InitialMetallicity )
+MainSequence::MainSequence( Herd::Generic::Metallicity i_InitialMetallicity, std::pmr::memory_resource* io_pResource )
 {
   Herd::Generic::ThrowIfNotPositive( i_InitialMetallicity, "i_InitialMetallicity" );
 
-  ComputeMetallicityDependents( i_InitialMetallicity );
+  m_ZDependents.m_EvaluatedAt = i_InitialMetallicity;
+  m_ZDependents.m_pCoefficients = Herd::SSE::MetallicityCache::Get< Coefficients >( i_InitialMetallicity, &MainSequence::ComputeCoefficients );
+
+  // Initialise the landmark computers
+  m_ZDependents.m_pZAMSComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::ZeroAgeMainSequence >( io_pResource, i_InitialMetallicity );
+  m_ZDependents.m_pTMSComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::TerminalMainSequence >( io_pResource, i_InitialMetallicity, io_pResource );
+  m_ZDependents.m_pHeIComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::HeliumIgnition >( io_pResource, i_InitialMetallicity );
 }
 
 /**
@@ -140,21 +150,26 @@ MainSequence::~MainSequence() = default;
  * @return Next evolution stage
  * @pre Mass in \c io_rState is positive
  * @pre Age in \c io_rState is non-negative
- * @throws PreconditionError If any preconditions are violated
+ * @throws PreconditionError If any preconditions are violated, and Herd::Generic::InnerValidation is enabled
  * @remarks Call at age=0 returns the ZAMS state
  */
 Herd::SSE::EvolutionStage MainSequence::Evolve( Herd::SSE::EvolutionState& io_rState )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_MainSequenceEvolve );
+
   // Validation
-  Herd::Generic::ThrowIfNotPositive( io_rState.m_TrackPoint.m_Mass, "m_Mass" );
-  Herd::Generic::ThrowIfNegative( io_rState.m_EffectiveAge, "m_EffectiveAge" );
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    Herd::Generic::ThrowIfNotPositive( io_rState.m_TrackPoint.m_Mass, "m_Mass" );
+    Herd::Generic::ThrowIfNegative( io_rState.m_EffectiveAge, "m_EffectiveAge" );
+  }
 
   auto& rTrackPoint = io_rState.m_TrackPoint;
   auto mass = rTrackPoint.m_Mass;
 
   // Still MS?
-  Herd::Generic::Time tMS = m_ZDependents.m_pTMSComputer->Age( mass );
-  Herd::Generic::Time thook = m_ZDependents.m_pTMSComputer->THook( mass );
+  Herd::SSE::TerminalMainSequence::Values tms = m_ZDependents.m_pTMSComputer->EvaluateWithTHook( mass );
+  Herd::Generic::Time tMS = tms.m_Age;
 
   // Change in mass changes the effective age of the star
   Herd::Generic::Time tMSOld = io_rState.m_EffectiveAge == 0 ? tMS : m_MDependents.m_TMS; // If ZAMS, we have no cached tMS yet
@@ -183,22 +198,24 @@ Herd::SSE::EvolutionStage MainSequence::Evolve( Herd::SSE::EvolutionState& io_rS
     ComputeMassDependents( mass );
   }
 
-  double tInthook = effectiveAge / thook;
+  double tInthook = effectiveAge / tms.m_THook;
   double tau1 = std::min( 1., tInthook );  // Eq. 14. This term linearly ramps up until hook
   double tau2 = std::clamp( 100. * tInthook - 99., 0., 1. ); // Eq. 15. This term swings sharply from (0.99, 0.) to ( 1.0, 1.), i.e. right before the hook
 
   double tau = effectiveAge / tMS; // Eq. 11.  Progress in MS
 
+  Herd::SSE::LandmarkValues zams = m_ZDependents.m_pZAMSComputer->Evaluate( mass );
+
   // Luminosity
 
   // Eq. 12
-  Herd::Generic::Luminosity lZAMS = m_ZDependents.m_pZAMSComputer->Luminosity( mass );
+  Herd::Generic::Luminosity lZAMS = zams.m_Luminosity;
   Herd::Generic::Luminosity luminosity;
   if( tau > 0 )
   {
     double term1 = m_MDependents.m_AlphaL * tau;
     double term2 = BXhC( tau, m_MDependents.m_BetaL, m_MDependents.m_Eta );
-    double term3 = ( std::log10( m_ZDependents.m_pTMSComputer->Luminosity( mass ) / lZAMS ) - m_MDependents.m_AlphaL - m_MDependents.m_BetaL )
+    double term3 = ( std::log10( tms.m_Luminosity / lZAMS ) - m_MDependents.m_AlphaL - m_MDependents.m_BetaL )
         * tau
         * tau;
     double term4 = m_MDependents.m_DeltaL * ( ( tau1 - tau2 ) * ( tau1 + tau2 ) );
@@ -211,14 +228,14 @@ Herd::SSE::EvolutionStage MainSequence::Evolve( Herd::SSE::EvolutionState& io_rS
   // Radius
 
   // Eq. 13
-  Herd::Generic::Radius rZAMS = m_ZDependents.m_pZAMSComputer->Radius( mass );
+  Herd::Generic::Radius rZAMS = zams.m_Radius;
   Herd::Generic::Radius radius;
   if( tau > 0 )
   {
     double term1 = m_MDependents.m_AlphaR * tau;
     double term2 = m_MDependents.m_BetaR * boost::math::pow< 10 >( tau );
     double term3 = m_MDependents.m_GammaR * boost::math::pow< 40 >( tau );
-    double term4 = ( std::log10( m_ZDependents.m_pTMSComputer->Radius( mass ) / rZAMS ) - m_MDependents.m_AlphaR - m_MDependents.m_BetaR
+    double term4 = ( std::log10( tms.m_Radius / rZAMS ) - m_MDependents.m_AlphaR - m_MDependents.m_BetaR
         - m_MDependents.m_GammaR )
         * boost::math::pow< 3 >( tau );
     double term5 = m_MDependents.m_DeltaR * ( boost::math::pow< 3 >( tau1 ) - boost::math::pow< 3 >( tau2 ) );
@@ -230,7 +247,7 @@ Herd::SSE::EvolutionStage MainSequence::Evolve( Herd::SSE::EvolutionState& io_rS
 
   // AMUSE.SSE, special case handling for low mass stars
   Herd::SSE::EvolutionStage stage;
-  if( rTrackPoint.m_Mass < m_ZDependents.m_Mhook - 0.3 )
+  if( rTrackPoint.m_Mass < m_ZDependents.m_pCoefficients->m_Mhook - 0.3 )
   {
     stage = Herd::SSE::EvolutionStage::e_MSLM;
 
@@ -265,12 +282,46 @@ Herd::Generic::Time MainSequence::EndsAt() const
 }
 
 /**
- * @param i_Z Metallicity
+ * @return Mass at which the mass-dependent quantities are evaluated. \c Herd::Generic::Mass() before any prior call to \c Evolve
+ * @remarks The mass-dependent quantities are not merely a cache: the terminal age at this mass determines the effective age after a change in mass
  */
-void MainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z )
+Herd::Generic::Mass MainSequence::MassDependentsEvaluatedAt() const
 {
-  m_ZDependents.m_EvaluatedAt = i_Z;
+  return m_MDependents.m_EvaluatedAt;
+}
 
+/**
+ * @param i_Mass Mass, as returned by MassDependentsEvaluatedAt
+ * @pre \c i_Mass is positive
+ * @throws PreconditionError If the precondition is violated
+ */
+void MainSequence::RestoreMassDependents( Herd::Generic::Mass i_Mass )
+{
+  Herd::Generic::ThrowIfNotPositive( i_Mass, "i_Mass" );
+  if( i_Mass != m_MDependents.m_EvaluatedAt )
+  {
+    ComputeMassDependents( i_Mass );
+  }
+}
+
+/**
+ * @return Total hit and miss counts of the mass caches of the ZAMS, TMS and HeI computers
+ * @remarks Accumulated over the lifetime of the object, across the stars
+ */
+Herd::SSE::MassCacheStatistics MainSequence::CacheStatistics() const
+{
+  Herd::SSE::MassCacheStatistics statistics = m_ZDependents.m_pZAMSComputer->CacheStatistics();
+  statistics += m_ZDependents.m_pTMSComputer->CacheStatistics();
+  statistics += m_ZDependents.m_pHeIComputer->CacheStatistics();
+  return statistics;
+}
+
+/**
+ * @param i_Z Metallicity
+ * @return Coefficients
+ */
+MainSequence::Coefficients MainSequence::ComputeCoefficients( Herd::Generic::Metallicity i_Z )
+{
   Herd::Generic::Metallicity relativeZ( i_Z / Herd::SSE::Constants::s_SolarMetallicityTout96 ); // Metallicity relative to the Sun
 
   std::array< double, 5 > zetaPowers4;
@@ -280,15 +331,17 @@ void MainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z
   std::array< double, 4 > zetaPowers3;
   ranges::cpp20::copy_n( zetaPowers4.begin(), 4, zetaPowers3.begin() );
 
-  m_ZDependents.m_Mhook = Herd::SSE::ComputeMhook( i_Z );
-  m_ZDependents.m_MFGB = Herd::SSE::ComputeMFGB( i_Z );
+  Coefficients coefficients;
+
+  coefficients.m_Mhook = Herd::SSE::ComputeMhook( i_Z );
+  coefficients.m_MFGB = Herd::SSE::ComputeMFGB( i_Z );
 
   // AlphaL
   std::array< double, 11 > tempAlphaL;
   Herd::Generic::MultiplyMatrixVector( tempAlphaL, s_ZAlphaL, zetaPowers3 );
-  ranges::cpp20::copy_n( tempAlphaL.begin(), 4, m_ZDependents.m_AlphaL.begin() );
+  ranges::cpp20::copy_n( tempAlphaL.begin(), 4, coefficients.m_AlphaL.begin() );
   {
-    auto& rA = m_ZDependents.m_AlphaL;
+    auto& rA = coefficients.m_AlphaL;
     rA[ 4 ] = std::max( 0.9, tempAlphaL[ 7 ] );
     rA[ 5 ] = std::max( 1., tempAlphaL[ 8 ] );
     if( i_Z > 0.01 )
@@ -300,26 +353,26 @@ void MainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z
     rA[ 6 ] = std::max( 0.145, tempAlphaL[ 4 ] );
     rA[ 7 ] = std::min( tempAlphaL[ 5 ], tempAlphaL[ 9 ] );
     rA[ 8 ] = std::min( tempAlphaL[ 6 ], tempAlphaL[ 10 ] );
-    rA[ 9 ] = ComputeAlphaL( Herd::Generic::Mass( 2. ) );
+    rA[ 9 ] = ComputeAlphaL( coefficients, Herd::Generic::Mass( 2. ) );
   }
 
   // BetaL
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_BetaL, s_ZBetaL, zetaPowers4 );
-  m_ZDependents.m_BetaL[ 3 ] = std::min( 1.4, m_ZDependents.m_BetaL[ 3 ] );
-  m_ZDependents.m_BetaL[ 3 ] = std::max( { 0.6355e+00 - 0.4192e+00 * zeta, 1.25, m_ZDependents.m_BetaL[ 3 ] } );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_BetaL, s_ZBetaL, zetaPowers4 );
+  coefficients.m_BetaL[ 3 ] = std::min( 1.4, coefficients.m_BetaL[ 3 ] );
+  coefficients.m_BetaL[ 3 ] = std::max( { 0.6355e+00 - 0.4192e+00 * zeta, 1.25, coefficients.m_BetaL[ 3 ] } );
 
   // Lhook
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_Lhook, s_ZLhook, zetaPowers3 );
-  m_ZDependents.m_Lhook[ 4 ] = std::min( 1.4, m_ZDependents.m_Lhook[ 4 ] );
-  m_ZDependents.m_Lhook[ 4 ] = std::max( { 0.6355e+00 - 0.4192e+00 * zeta, 1.25, m_ZDependents.m_Lhook[ 4 ] } );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_Lhook, s_ZLhook, zetaPowers3 );
+  coefficients.m_Lhook[ 4 ] = std::min( 1.4, coefficients.m_Lhook[ 4 ] );
+  coefficients.m_Lhook[ 4 ] = std::max( { 0.6355e+00 - 0.4192e+00 * zeta, 1.25, coefficients.m_Lhook[ 4 ] } );
 
   // AlphaR
   std::array< double, 13 > tempAlphaR;
   Herd::Generic::MultiplyMatrixVector( tempAlphaR, s_ZAlphaR, zetaPowers4 );
-  ranges::cpp20::copy_n( tempAlphaR.begin(), 5, m_ZDependents.m_AlphaR.begin() );
+  ranges::cpp20::copy_n( tempAlphaR.begin(), 5, coefficients.m_AlphaR.begin() );
 
   {
-    auto& rA = m_ZDependents.m_AlphaR;
+    auto& rA = coefficients.m_AlphaR;
     rA[ 5 ] = std::clamp( tempAlphaR[ 6 ], 0.9, 1.0 );
     rA[ 6 ] = std::max( tempAlphaR[ 7 ], std::min( 1.6, tempAlphaR[ 8 ] ) );
     rA[ 6 ] = std::max( 0.8, std::min( tempAlphaR[ 9 ], rA[ 6 ] ) );
@@ -336,16 +389,16 @@ void MainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z
   }
 
   // BetaR
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_BetaR, s_ZBetaR, zetaPowers3 );
-  m_ZDependents.m_BetaR[ 4 ] = i_Z <= 0.01 ? m_ZDependents.m_BetaR[ 4 ] : std::max( 0.95, m_ZDependents.m_BetaR[ 4 ] );
-  m_ZDependents.m_BetaR[ 5 ] = std::clamp( m_ZDependents.m_BetaR[ 5 ], 1.4, 1.6 );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_BetaR, s_ZBetaR, zetaPowers3 );
+  coefficients.m_BetaR[ 4 ] = i_Z <= 0.01 ? coefficients.m_BetaR[ 4 ] : std::max( 0.95, coefficients.m_BetaR[ 4 ] );
+  coefficients.m_BetaR[ 5 ] = std::clamp( coefficients.m_BetaR[ 5 ], 1.4, 1.6 );
 
   // GammaR
   std::array< double, 12 > tempGammaR;
   Herd::Generic::MultiplyMatrixVector( tempGammaR, s_ZGammaR, zetaPowers3 );
 
   {
-    auto& rA = m_ZDependents.m_GammaR;
+    auto& rA = coefficients.m_GammaR;
     rA[ 0 ] = std::max( tempGammaR[ 0 ], tempGammaR[ 3 ] );
     rA[ 1 ] = std::max( tempGammaR[ 4 ], std::min( 0., tempGammaR[ 1 ] ) );
     rA[ 2 ] = std::max( 0., std::min( tempGammaR[ 2 ], tempGammaR[ 6 ] ) );
@@ -356,17 +409,14 @@ void MainSequence::ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z
   }
 
   // Rhook
-  Herd::Generic::MultiplyMatrixVector( m_ZDependents.m_Rhook, s_ZRhook, zetaPowers3 );
-  m_ZDependents.m_Rhook[ 4 ] = std::clamp( m_ZDependents.m_Rhook[ 4 ], 1.1, 1.25 );
-  m_ZDependents.m_Rhook[ 6 ] = std::clamp( m_ZDependents.m_Rhook[ 6 ], 0.45, 1.3 );
+  Herd::Generic::MultiplyMatrixVector( coefficients.m_Rhook, s_ZRhook, zetaPowers3 );
+  coefficients.m_Rhook[ 4 ] = std::clamp( coefficients.m_Rhook[ 4 ], 1.1, 1.25 );
+  coefficients.m_Rhook[ 6 ] = std::clamp( coefficients.m_Rhook[ 6 ], 0.45, 1.3 );
 
   // Maximum value of eta
-  m_ZDependents.m_MaxEta = i_Z > 0.0009 ? 10. : 20.;
+  coefficients.m_MaxEta = i_Z > 0.0009 ? 10. : 20.;
 
-  // Initialise the landmark computers
-  m_ZDependents.m_pZAMSComputer = std::make_unique< Herd::SSE::ZeroAgeMainSequence >( i_Z );
-  m_ZDependents.m_pTMSComputer = std::make_unique< Herd::SSE::TerminalMainSequence >( i_Z );
-  m_ZDependents.m_pHeIComputer = std::make_unique< Herd::SSE::HeliumIgnition >( i_Z );
+  return coefficients;
 }
 
 /**
@@ -377,11 +427,11 @@ void MainSequence::ComputeMassDependents( Herd::Generic::Mass i_Mass )
   m_MDependents.m_EvaluatedAt = i_Mass;
 
   // Luminosity
-  m_MDependents.m_AlphaL = ComputeAlphaL( i_Mass );
+  m_MDependents.m_AlphaL = ComputeAlphaL( *m_ZDependents.m_pCoefficients, i_Mass );
   m_MDependents.m_BetaL = ComputeBetaL( i_Mass );
   m_MDependents.m_DeltaL = ComputeLHook( i_Mass );
 
-  m_MDependents.m_Eta = std::clamp( std::lerp( 10., 20., ( i_Mass - 1 ) / 0.1 ), 10., m_ZDependents.m_MaxEta ); // Eq. 18 and linear interpolation for Z <= 0.0009 . If Z> 0.0009, since m_MaxEta = 10, eta becomes 10
+  m_MDependents.m_Eta = std::clamp( std::lerp( 10., 20., ( i_Mass - 1 ) / 0.1 ), 10., m_ZDependents.m_pCoefficients->m_MaxEta ); // Eq. 18 and linear interpolation for Z <= 0.0009 . If Z> 0.0009, since m_MaxEta = 10, eta becomes 10
 
   // Radius
   m_MDependents.m_AlphaR = ComputeAlphaR( i_Mass );
@@ -394,12 +444,13 @@ void MainSequence::ComputeMassDependents( Herd::Generic::Mass i_Mass )
 }
 
 /**
+ * @param i_rCoefficients Equation coefficients
  * @param i_Mass Mass
  * @return \f$ \alpha_L \f$
  */
-double MainSequence::ComputeAlphaL( Herd::Generic::Mass i_Mass ) const
+double MainSequence::ComputeAlphaL( const Coefficients& i_rCoefficients, Herd::Generic::Mass i_Mass )
 {
-  auto& rA = m_ZDependents.m_AlphaL;
+  auto& rA = i_rCoefficients.m_AlphaL;
 
   // Eq. 19b
   if( i_Mass <= 0.5 )
@@ -440,7 +491,7 @@ double MainSequence::ComputeAlphaL( Herd::Generic::Mass i_Mass ) const
 double MainSequence::ComputeBetaL( Herd::Generic::Mass i_Mass ) const
 {
   // Eq. 20
-  auto& rA = m_ZDependents.m_BetaL;
+  auto& rA = m_ZDependents.m_pCoefficients->m_BetaL;
 
   double betaL = ApBXhC( i_Mass, rA[ 0 ], -rA[ 1 ], rA[ 2 ] );
 
@@ -460,9 +511,9 @@ double MainSequence::ComputeBetaL( Herd::Generic::Mass i_Mass ) const
 double MainSequence::ComputeLHook( Herd::Generic::Mass i_Mass ) const
 {
   // Eq. 16
-  auto& rA = m_ZDependents.m_Lhook;
+  auto& rA = m_ZDependents.m_pCoefficients->m_Lhook;
 
-  if( i_Mass <= m_ZDependents.m_Mhook )
+  if( i_Mass <= m_ZDependents.m_pCoefficients->m_Mhook )
   {
     return 0.;
   }
@@ -476,7 +527,7 @@ double MainSequence::ComputeLHook( Herd::Generic::Mass i_Mass ) const
   }
 
   double b = LuminosityComputer( rA[ 4 ] );
-  return BXhC( ComputeBlendWeight( i_Mass, m_ZDependents.m_Mhook, rA[ 4 ] ), b, 0.4 );
+  return BXhC( ComputeBlendWeight( i_Mass, m_ZDependents.m_pCoefficients->m_Mhook, rA[ 4 ] ), b, 0.4 );
 }
 
 
@@ -486,7 +537,7 @@ double MainSequence::ComputeLHook( Herd::Generic::Mass i_Mass ) const
  */
 double MainSequence::ComputeAlphaR( Herd::Generic::Mass i_Mass ) const
 {
-  auto& rA = m_ZDependents.m_AlphaR;
+  auto& rA = m_ZDependents.m_pCoefficients->m_AlphaR;
 
   // Eq. 21b
   if( i_Mass <= 0.5 )
@@ -526,7 +577,7 @@ double MainSequence::ComputeAlphaR( Herd::Generic::Mass i_Mass ) const
  */
 double MainSequence::ComputeBetaR( Herd::Generic::Mass i_Mass ) const
 {
-  auto& rA = m_ZDependents.m_BetaR;
+  auto& rA = m_ZDependents.m_pCoefficients->m_BetaR;
 
   double betaR = 0;
 
@@ -570,7 +621,7 @@ double MainSequence::ComputeBetaR( Herd::Generic::Mass i_Mass ) const
  */
 double MainSequence::ComputeGammaR( Herd::Generic::Mass i_Mass ) const
 {
-  auto& rA = m_ZDependents.m_GammaR;
+  auto& rA = m_ZDependents.m_pCoefficients->m_GammaR;
 
   // Eq. 23
 
@@ -608,18 +659,18 @@ double MainSequence::ComputeGammaR( Herd::Generic::Mass i_Mass ) const
  */
 double MainSequence::ComputeRHook( Herd::Generic::Mass i_Mass ) const
 {
-  auto& rA = m_ZDependents.m_Rhook;
+  auto& rA = m_ZDependents.m_pCoefficients->m_Rhook;
 
   // Eq. 17
 
-  if( i_Mass <= m_ZDependents.m_Mhook )
+  if( i_Mass <= m_ZDependents.m_pCoefficients->m_Mhook )
   {
     return 0.;
   }
 
-  if( i_Mass > m_ZDependents.m_Mhook && i_Mass <= rA[ 4 ] )
+  if( i_Mass > m_ZDependents.m_pCoefficients->m_Mhook && i_Mass <= rA[ 4 ] )
   {
-    return rA[ 5 ] * std::sqrt( ComputeBlendWeight( i_Mass, m_ZDependents.m_Mhook, rA[ 4 ] ) );
+    return rA[ 5 ] * std::sqrt( ComputeBlendWeight( i_Mass, m_ZDependents.m_pCoefficients->m_Mhook, rA[ 4 ] ) );
   }
 
   if( i_Mass > rA[ 4 ] && i_Mass <= 2. )
@@ -17,10 +17,14 @@
 #include "IPhase.h"
 #include "TrackPoint.h"
 
+#include <SSE/Landmarks/MassCache.h>
+
+#include <Generic/Arena.h>
 #include <Generic/Quantity.h>
 
 #include <array>
 #include <memory>
+#include <memory_resource>
 
 namespace Herd::SSE
 {
@@ -35,24 +39,50 @@ class ZeroAgeMainSequence;
  * @brief Main sequence evolution
  * @cite Hurley00
  */
-class MainSequence : public Herd::SSE::IPhase
+class MainSequence final : public Herd::SSE::IPhase
 {
 public:
 
-  MainSequence( Herd::Generic::Metallicity i_Z ); ///< Constructor
+  MainSequence( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource = std::pmr::get_default_resource() ); ///< Constructor
   ~MainSequence(); ///< Destructor
 
   Herd::SSE::EvolutionStage Evolve( Herd::SSE::EvolutionState& io_rState ) override; ///< Evolves the state
 
   Herd::Generic::Time EndsAt() const override;  ///< End of the phase
 
+  Herd::Generic::Mass MassDependentsEvaluatedAt() const; ///< Mass at which the mass-dependent quantities are evaluated
+  void RestoreMassDependents( Herd::Generic::Mass i_Mass ); ///< Evaluates the mass-dependent quantities at a mass, when resuming from a checkpoint
+
+  Herd::SSE::MassCacheStatistics CacheStatistics() const; ///< Returns the hit and miss counts of the mass caches of the landmark computers
+
 private:
 
-  void ComputeMetallicityDependents( Herd::Generic::Metallicity i_Z ); ///< Computes various metallicity-dependent quantities
+  /**
+   * @brief Equation coefficients and critical masses that depend on the metallicity only
+   * @remarks Shared via MetallicityCache
+   */
+  struct Coefficients
+  {
+    Herd::Generic::Mass m_Mhook;  ///< Minimum initial mass for a hook
+    Herd::Generic::Mass m_MFGB; ///< Maximum initial mass for He to ignite on the first giant branch
+
+    double m_MaxEta = 0.;  ///< \f$ \eta \f$ in Eq. 18
+
+    // Equation coefficients
+    std::array< double, 10 > m_AlphaL;  ///< \f$ \alpha_L \f$ calculations
+    std::array< double, 4 > m_BetaL;  ///< \f$ \beta_L \f$ calculations
+    std::array< double, 5 > m_Lhook;  ///< \f$ L_{hook} \f$ calculations
+    std::array< double, 12 > m_AlphaR;  ///< \f$ \alpha_R \f$ calculations
+    std::array< double, 6 > m_BetaR;  ///< \f$ \beta_R \f$ calculations
+    std::array< double, 7 > m_GammaR;  ///< \f$ \gamma_R \f$ calculations
+    std::array< double, 7 > m_Rhook;  ///< \f$ \R_{hook} \f$ calculations
+  };
+
+  static Coefficients ComputeCoefficients( Herd::Generic::Metallicity i_Z ); ///< Computes the metallicity-dependent coefficients
 
   void ComputeMassDependents( Herd::Generic::Mass i_Mass ); ///< Computes various mass-dependent quantities
 
-  double ComputeAlphaL( Herd::Generic::Mass i_Mass ) const; ///< Computes \f$ \alpha_L\f$
+  static double ComputeAlphaL( const Coefficients& i_rCoefficients, Herd::Generic::Mass i_Mass ); ///< Computes \f$ \alpha_L\f$
   double ComputeBetaL( Herd::Generic::Mass i_Mass ) const; ///< Computes \f$ \beta_L\f$
   double ComputeLHook( Herd::Generic::Mass i_Mass ) const; ///< Computes \f$ \Delta_L\f$
 
@@ -68,24 +98,12 @@ private:
   {
     Herd::Generic::Metallicity m_EvaluatedAt; ///< Dependents calculated at this value
 
-    Herd::Generic::Mass m_Mhook;  ///< Minimum initial mass for a hook
-    Herd::Generic::Mass m_MFGB; ///< Maximum initial mass for He to ignite on the first giant branch
-
-    double m_MaxEta = 0.;  ///< \f$ \eta \f$ in Eq. 18
-
-    // Equation coefficients
-    std::array< double, 10 > m_AlphaL;  ///< \f$ \alpha_L \f$ calculations
-    std::array< double, 4 > m_BetaL;  ///< \f$ \beta_L \f$ calculations
-    std::array< double, 5 > m_Lhook;  ///< \f$ L_{hook} \f$ calculations
-    std::array< double, 12 > m_AlphaR;  ///< \f$ \alpha_R \f$ calculations
-    std::array< double, 6 > m_BetaR;  ///< \f$ \beta_R \f$ calculations
-    std::array< double, 7 > m_GammaR;  ///< \f$ \gamma_R \f$ calculations
-    std::array< double, 7 > m_Rhook;  ///< \f$ \R_{hook} \f$ calculations
+    std::shared_ptr< const Coefficients > m_pCoefficients; ///< Equation coefficients
 
     // No default constructor, so needs to be a pointer
-    std::unique_ptr< Herd::SSE::ZeroAgeMainSequence > m_pZAMSComputer; ///< Computes the ZAMS parameters
-    std::unique_ptr< Herd::SSE::TerminalMainSequence > m_pTMSComputer; ///< Computes the characteristic values at TMS
-    std::unique_ptr< Herd::SSE::HeliumIgnition > m_pHeIComputer; ///< Computes the characteristic values at HeI
+    Herd::Generic::ArenaPtr< Herd::SSE::ZeroAgeMainSequence > m_pZAMSComputer; ///< Computes the ZAMS parameters
+    Herd::Generic::ArenaPtr< Herd::SSE::TerminalMainSequence > m_pTMSComputer; ///< Computes the characteristic values at TMS
+    Herd::Generic::ArenaPtr< Herd::SSE::HeliumIgnition > m_pHeIComputer; ///< Computes the characteristic values at HeI
   };
 
   MetallicityDependents m_ZDependents;  ///< Metallicity-dependent quantities evaluated at initial metallicity
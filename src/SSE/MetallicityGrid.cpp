@@ -0,0 +1,114 @@
+/**
+ * @file MetallicityGrid.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "MetallicityGrid.h"
+
+#include <SSE/Landmarks/Constants.h>
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+/**
+ * @brief Checks whether a branch point of the fitting formulae is between two metallicities
+ * @param i_Z Metallicity
+ * @param i_Snapped Snapped metallicity
+ * @return \c true if \c i_Z and \c i_Snapped are different, and a branch point is in the closed interval between them
+ */
+bool CrossesBranchPoint( double i_Z, double i_Snapped )
+{
+  double lower = std::min( i_Z, i_Snapped );
+  double upper = std::max( i_Z, i_Snapped );
+  return i_Z != i_Snapped && ranges::cpp20::any_of( Herd::SSE::Constants::s_MetallicityBranchPoints, [ = ]( double i_BranchPoint )
+  { return i_BranchPoint >= lower && i_BranchPoint <= upper;} );
+}
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_rRange Metallicity range. The first node is at the lower bound, and the last node is not beyond the upper bound
+ * @param i_Step Distance between the consecutive nodes in \f$ \zeta \f$, in dex
+ * @pre The lower bound of \c i_rRange is positive
+ * @pre \c i_Step is positive
+ * @throws PreconditionError If any preconditions are violated
+ */
+MetallicityGrid::MetallicityGrid( const Herd::Generic::ClosedRange& i_rRange, double i_Step ) :
+    m_Lower( i_rRange.Lower() ), m_Step( i_Step )
+{
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( m_Lower, "i_rRange" );
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_Step, "i_Step" );
+
+  m_Size = static_cast< std::size_t >( std::log10( i_rRange.Upper() / m_Lower ) / m_Step ) + 1;
+
+  // Rounding may put the last node just beyond the upper bound
+  while( m_Size > 1 && ( *this )[ m_Size - 1 ] > i_rRange.Upper() )
+  {
+    --m_Size;
+  }
+}
+
+/**
+ * @param i_Z Metallicity
+ * @return The nearest node on the same side of every branch point as \c i_Z. If neither neighbouring node qualifies, \c i_Z
+ * @pre \c i_Z is positive
+ * @remarks Metallicities outside of the grid are snapped to the nearest end
+ * @remarks Idempotent: a node snaps to itself
+ */
+Herd::Generic::Metallicity MetallicityGrid::Snap( Herd::Generic::Metallicity i_Z ) const
+{
+  double position = std::clamp( std::round( std::log10( i_Z / m_Lower ) / m_Step ), 0., static_cast< double >( m_Size - 1 ) );
+  std::size_t nearest = static_cast< std::size_t >( position );
+
+  Herd::Generic::Metallicity snapped = ( *this )[ nearest ];
+  if( !CrossesBranchPoint( i_Z, snapped ) )
+  {
+    return snapped;
+  }
+
+  // The neighbouring node on the other side of i_Z
+  if( snapped > i_Z && nearest > 0 )
+  {
+    snapped = ( *this )[ nearest - 1 ];
+  } else if( snapped < i_Z && nearest + 1 < m_Size )
+  {
+    snapped = ( *this )[ nearest + 1 ];
+  }
+
+  return CrossesBranchPoint( i_Z, snapped ) ? i_Z : snapped;
+}
+
+/**
+ * @return Number of nodes
+ */
+std::size_t MetallicityGrid::size() const
+{
+  return m_Size;
+}
+
+/**
+ * @param i_Index Node index
+ * @return Metallicity at the node
+ * @remarks No bounds checking
+ */
+Herd::Generic::Metallicity MetallicityGrid::operator[]( std::size_t i_Index ) const
+{
+  return Herd::Generic::Metallicity( m_Lower * std::pow( 10., static_cast< double >( i_Index ) * m_Step ) );
+}
+
+}
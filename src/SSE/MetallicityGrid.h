@@ -0,0 +1,48 @@
+/**
+ * @file MetallicityGrid.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H8E3F2A57_1C4B_4D9E_A6F0_5B7D2C9E4A13
+#define H8E3F2A57_1C4B_4D9E_A6F0_5B7D2C9E4A13
+
+#include <Generic/Quantity.h>
+#include <Generic/QuantityRange.h>
+
+#include <cstddef>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Metallicity grid, uniform in \f$ \zeta = \log_{10} Z \f$
+ * @remarks For populations with a continuous metallicity distribution. The stars snapped to the grid share the metallicity-dependent coefficients in MetallicityCache, so that a new metallicity costs a cache lookup instead of the coefficient computations
+ * @remarks Snapping never moves a metallicity across Constants::s_MetallicityBranchPoints, where the fitting formulae switch branches. So, the coefficients at the snapped metallicity follow the same branches as at the original metallicity
+ */
+class MetallicityGrid
+{
+public:
+
+  MetallicityGrid( const Herd::Generic::ClosedRange& i_rRange, double i_Step ); ///< Constructor
+
+  Herd::Generic::Metallicity Snap( Herd::Generic::Metallicity i_Z ) const; ///< Returns the grid metallicity for a metallicity
+
+  std::size_t size() const; ///< Number of nodes
+  Herd::Generic::Metallicity operator[]( std::size_t i_Index ) const; ///< Metallicity at a node
+
+private:
+
+  double m_Lower; ///< Metallicity at the first node
+  double m_Step; ///< Distance between the consecutive nodes in \f$ \zeta \f$
+  std::size_t m_Size; ///< Number of nodes
+};
+}
+
+#endif /* H8E3F2A57_1C4B_4D9E_A6F0_5B7D2C9E4A13 */
@@ -0,0 +1,159 @@
+/**
+ * @file OutputFilter.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "OutputFilter.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_Policy Output policy
+ * @param i_OutputAges Output ages, for OutputPolicy::e_OutputAges. Increasing, >=0. The filter does not take ownership
+ * @param i_RelativeChange Threshold for OutputPolicy::e_RelativeChange. >0
+ * @throws PreconditionError If any parameters are invalid
+ */
+OutputFilter::OutputFilter( Herd::SSE::OutputPolicy i_Policy, std::span< const Herd::Generic::Time > i_OutputAges, double i_RelativeChange ) :
+    m_Policy( i_Policy ), m_OutputAges( i_OutputAges ), m_RelativeChange( i_RelativeChange )
+{
+  Validate( i_OutputAges, i_RelativeChange );
+}
+
+/**
+ * @param i_rTrackPoint Track point. Not older than the previous one
+ * @param[in, out] io_rSink Receives the stored track points
+ */
+void OutputFilter::Push( const Herd::SSE::TrackPoint& i_rTrackPoint, Herd::SSE::ITrajectorySink& io_rSink )
+{
+  bool isStored = false;
+
+  if( !m_HasPrevious )
+  {
+    // Output ages that precede the first track point cannot be interpolated
+    while( m_NextOutputAge < m_OutputAges.size() && m_OutputAges[ m_NextOutputAge ] <= i_rTrackPoint.m_Age )
+    {
+      ++m_NextOutputAge;
+    }
+
+    Store( i_rTrackPoint, io_rSink );
+    isStored = true;
+  } else
+  {
+    switch( m_Policy )
+    {
+      case Herd::SSE::OutputPolicy::e_EveryStep:
+        Store( i_rTrackPoint, io_rSink );
+        isStored = true;
+        break;
+
+      case Herd::SSE::OutputPolicy::e_StageBoundaries:
+        if( i_rTrackPoint.m_Stage != m_Previous.m_Stage )
+        {
+          if( !m_IsPreviousStored )
+          {
+            Store( m_Previous, io_rSink );
+          }
+
+          Store( i_rTrackPoint, io_rSink );
+          isStored = true;
+        }
+        break;
+
+      case Herd::SSE::OutputPolicy::e_OutputAges:
+        for( ; m_NextOutputAge < m_OutputAges.size() && m_OutputAges[ m_NextOutputAge ] <= i_rTrackPoint.m_Age; ++m_NextOutputAge )
+        {
+          Store( Herd::SSE::InterpolateTrackPoints( m_Previous, i_rTrackPoint, m_OutputAges[ m_NextOutputAge ] ), io_rSink );
+          isStored = m_OutputAges[ m_NextOutputAge ] == i_rTrackPoint.m_Age;
+        }
+        break;
+
+      case Herd::SSE::OutputPolicy::e_RelativeChange:
+        if( HasChanged( i_rTrackPoint ) )
+        {
+          Store( i_rTrackPoint, io_rSink );
+          isStored = true;
+        }
+        break;
+    }
+  }
+
+  m_Previous = i_rTrackPoint;
+  m_HasPrevious = true;
+  m_IsPreviousStored = isStored;
+}
+
+/**
+ * @param[in, out] io_rSink Receives the stored track points
+ * @remarks Call after the last integrator step
+ */
+void OutputFilter::Flush( Herd::SSE::ITrajectorySink& io_rSink )
+{
+  if( m_HasPrevious && !m_IsPreviousStored )
+  {
+    Store( m_Previous, io_rSink );
+    m_IsPreviousStored = true;
+  }
+}
+
+/**
+ * @param i_OutputAges Output ages
+ * @param i_RelativeChange Threshold for the relative change
+ * @pre \c i_OutputAges is strictly increasing, and non-negative
+ * @pre \c i_RelativeChange is positive
+ * @throws PreconditionError If any preconditions are violated
+ */
+void OutputFilter::Validate( std::span< const Herd::Generic::Time > i_OutputAges, double i_RelativeChange )
+{
+  if( !i_OutputAges.empty() )
+  {
+    Herd::Generic::ThrowIfNegative( i_OutputAges.front(), "i_OutputAges" );
+  }
+
+  if( std::adjacent_find( i_OutputAges.begin(), i_OutputAges.end(), std::greater_equal<>() ) != i_OutputAges.end() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_OutputAges", "Strictly increasing", "Not strictly increasing" );
+  }
+
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_RelativeChange, "i_RelativeChange" );
+}
+
+/**
+ * @param i_rTrackPoint Track point
+ * @return \c true if luminosity, radius or temperature differs from that of the last stored track point by more than the threshold
+ */
+bool OutputFilter::HasChanged( const Herd::SSE::TrackPoint& i_rTrackPoint ) const
+{
+  auto IsChanged = [ & ]( double i_Current, double i_Stored )
+  {
+    return std::abs( i_Current - i_Stored ) > m_RelativeChange * std::abs( i_Stored );
+  };
+
+  return IsChanged( i_rTrackPoint.m_Luminosity, m_LastStored.m_Luminosity ) || IsChanged( i_rTrackPoint.m_Radius, m_LastStored.m_Radius )
+      || IsChanged( i_rTrackPoint.m_Temperature, m_LastStored.m_Temperature );
+}
+
+/**
+ * @param i_rTrackPoint Track point
+ * @param[in, out] io_rSink Receives the stored track points
+ */
+void OutputFilter::Store( const Herd::SSE::TrackPoint& i_rTrackPoint, Herd::SSE::ITrajectorySink& io_rSink )
+{
+  io_rSink.Push( i_rTrackPoint );
+  m_LastStored = i_rTrackPoint;
+}
+
+}
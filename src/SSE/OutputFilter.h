@@ -0,0 +1,72 @@
+/**
+ * @file OutputFilter.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H808F6124_1F1C_4633_BFA7_1E47287B761A
+#define H808F6124_1F1C_4633_BFA7_1E47287B761A
+
+#include "ITrajectorySink.h"
+#include "TrackPoint.h"
+
+#include <Generic/Quantity.h>
+
+#include <cstddef>
+#include <span>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Track points to be stored in a trajectory
+ */
+enum class OutputPolicy
+{
+  e_EveryStep,  // Every integrator step
+  e_StageBoundaries, // The last track point of a stage and the first track point of the next
+  e_OutputAges,  // Track points at the requested ages, interpolated between the integrator steps
+  e_RelativeChange // Track points at which luminosity, radius or temperature changes by more than a threshold since the last stored one
+};
+
+/**
+ * @brief Selects the integrator steps that are stored in a trajectory, or passed to a sink
+ * @remarks The first and the last track points are always stored, so that the trajectory spans the entire evolution
+ * @remarks The integrator is not affected. The filter only reduces the number of stored track points
+ */
+class OutputFilter
+{
+public:
+
+  OutputFilter( Herd::SSE::OutputPolicy i_Policy, std::span< const Herd::Generic::Time > i_OutputAges, double i_RelativeChange ); ///< Constructor
+
+  void Push( const Herd::SSE::TrackPoint& i_rTrackPoint, Herd::SSE::ITrajectorySink& io_rSink ); ///< Offers the track point of an integrator step
+  void Flush( Herd::SSE::ITrajectorySink& io_rSink ); ///< Stores the last track point, if not already stored
+
+  static void Validate( std::span< const Herd::Generic::Time > i_OutputAges, double i_RelativeChange ); ///< Validates the parameters
+
+private:
+
+  bool HasChanged( const Herd::SSE::TrackPoint& i_rTrackPoint ) const; ///< Whether a track point differs significantly from the last stored one
+  void Store( const Herd::SSE::TrackPoint& i_rTrackPoint, Herd::SSE::ITrajectorySink& io_rSink ); ///< Stores a track point
+
+  Herd::SSE::OutputPolicy m_Policy; ///< Output policy
+  std::span< const Herd::Generic::Time > m_OutputAges;  ///< Output ages, for OutputPolicy::e_OutputAges
+  std::size_t m_NextOutputAge = 0;  ///< Index of the next output age
+  double m_RelativeChange;  ///< Threshold for OutputPolicy::e_RelativeChange
+
+  Herd::SSE::TrackPoint m_Previous; ///< Last offered track point
+  Herd::SSE::TrackPoint m_LastStored; ///< Last stored track point
+  bool m_HasPrevious = false; ///< \c true if a track point is offered
+  bool m_IsPreviousStored = false;  ///< \c true if the last offered track point is stored
+};
+
+}
+
+#endif /* H808F6124_1F1C_4633_BFA7_1E47287B761A */
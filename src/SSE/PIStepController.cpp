@@ -0,0 +1,94 @@
+/**
+ * @file PIStepController.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "PIStepController.h"
+
+#include "EvolutionState.h"
+#include "TrackPoint.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_Tolerance Target relative change of luminosity, radius and mass per step
+ * @pre \c i_Tolerance is positive
+ * @throws PreconditionError If the precondition is violated
+ */
+PIStepController::PIStepController( double i_Tolerance ) :
+    m_Tolerance( i_Tolerance )
+{
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_Tolerance, "i_Tolerance" );
+}
+
+void PIStepController::Reset()
+{
+  m_HasHistory = false;
+  m_Stage = Herd::SSE::EvolutionStage::e_Undefined;
+  m_DeltaT.Set( 0. );
+  m_Error = 1.;
+  m_PreviousError = 1.;
+}
+
+/**
+ * @param i_rState State
+ * @param i_BaseTimestep Fixed fraction of the duration of the phase
+ * @return Size of the next timestep. \c i_BaseTimestep at the beginning of a stage
+ */
+Herd::Generic::Time PIStepController::Propose( const Herd::SSE::EvolutionState& i_rState, Herd::Generic::Time i_BaseTimestep )
+{
+  if( !m_HasHistory || i_rState.m_TrackPoint.m_Stage != m_Stage )
+  {
+    return i_BaseTimestep;
+  }
+
+  double factor = s_Safety * std::pow( m_Error, -s_IntegralGain ) * std::pow( m_PreviousError, s_ProportionalGain );
+  return Herd::Generic::Time( m_DeltaT * std::clamp( factor, s_MinFactor, s_MaxFactor ) );
+}
+
+/**
+ * @param i_rPrevious Track point before the step
+ * @param i_rCurrent Track point after the step
+ * @param i_DeltaT Size of the step
+ */
+void PIStepController::Accept( const Herd::SSE::TrackPoint& i_rPrevious, const Herd::SSE::TrackPoint& i_rCurrent, Herd::Generic::Time i_DeltaT )
+{
+  auto ComputeRelativeChange = []( double i_Previous, double i_Current )
+  {
+    return std::abs( i_Current - i_Previous ) / std::abs( i_Previous );
+  };
+
+  double change = std::max( { ComputeRelativeChange( i_rPrevious.m_Luminosity, i_rCurrent.m_Luminosity ), ComputeRelativeChange( i_rPrevious.m_Radius,
+      i_rCurrent.m_Radius ), ComputeRelativeChange( i_rPrevious.m_Mass, i_rCurrent.m_Mass ) } );
+  double error = std::max( change / m_Tolerance, s_MinError );
+
+  bool isContinued = m_HasHistory && i_rCurrent.m_Stage == m_Stage;
+  m_PreviousError = isContinued ? m_Error : error;
+  m_Error = error;
+  m_DeltaT = i_DeltaT;
+  m_Stage = i_rCurrent.m_Stage;
+  m_HasHistory = true;
+}
+
+/**
+ * @return Target relative change per step
+ */
+double PIStepController::Tolerance() const
+{
+  return m_Tolerance;
+}
+
+}
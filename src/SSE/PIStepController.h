@@ -0,0 +1,59 @@
+/**
+ * @file PIStepController.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H6B025941_A532_4575_B77E_99217131B1B7
+#define H6B025941_A532_4575_B77E_99217131B1B7
+
+#include "EvolutionStage.h"
+#include "IStepController.h"
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Proportional-integral controller on the relative change of luminosity, radius and mass per step
+ * @remarks The error of a step is the largest relative change of luminosity, radius and mass, over the tolerance. The next step is scaled from the previous one, to bring the error to 1
+ * @remarks The first step of a stage is the base timestep, as there is no history
+ * @cite Gustafsson91
+ */
+class PIStepController : public Herd::SSE::IStepController
+{
+public:
+
+  explicit PIStepController( double i_Tolerance ); ///< Constructor
+
+  void Reset() override; ///< Discards the history of the previous star
+  Herd::Generic::Time Propose( const Herd::SSE::EvolutionState& i_rState, Herd::Generic::Time i_BaseTimestep ) override; ///< Proposes the size of the next timestep
+  void Accept( const Herd::SSE::TrackPoint& i_rPrevious, const Herd::SSE::TrackPoint& i_rCurrent, Herd::Generic::Time i_DeltaT ) override; ///< Updates the controller with an accepted step
+
+  double Tolerance() const; ///< Accessor for PIStepController::m_Tolerance
+
+  inline static constexpr double s_Safety = 0.9; ///< Safety factor on the proposal
+  inline static constexpr double s_IntegralGain = 0.7; ///< Exponent of the error of the previous step
+  inline static constexpr double s_ProportionalGain = 0.4; ///< Exponent of the error of the step before the previous
+  inline static constexpr double s_MinFactor = 0.2;  ///< Minimum ratio of consecutive steps
+  inline static constexpr double s_MaxFactor = 5.;  ///< Maximum ratio of consecutive steps
+  inline static constexpr double s_MinError = 1e-4; ///< Errors are clamped from below, so that a step without any change does not produce an infinite factor
+
+private:
+
+  double m_Tolerance; ///< Target relative change per step
+
+  bool m_HasHistory = false; ///< \c true if there is a previous step in the current stage
+  Herd::SSE::EvolutionStage m_Stage = Herd::SSE::EvolutionStage::e_Undefined;  ///< Stage at the end of the previous step
+  Herd::Generic::Time m_DeltaT; ///< Size of the previous step
+  double m_Error = 1.; ///< Error of the previous step
+  double m_PreviousError = 1.;  ///< Error of the step before the previous
+};
+}
+
+#endif /* H6B025941_A532_4575_B77E_99217131B1B7 */
@@ -0,0 +1,229 @@
+/**
+ * @file PopulationEvolution.cpp
+ * @author Evren Imre
+ * @date 17 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "PopulationEvolution.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <numeric>
+
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+
+/**
+ * @param[in, out] io_rReport Report, to which the counts for \c i_rWork are added
+ * @param i_rWork Work to be profiled
+ * @remarks Calls \c i_rWork directly if profiling is disabled
+ */
+template< class TCallable >
+void Profile( Herd::Generic::ProfilingReport& io_rReport, const TCallable& i_rWork )
+{
+  if constexpr( Herd::Generic::s_IsProfilingEnabled )
+  {
+    Herd::Generic::ProfilingReport start = Herd::Generic::ProfilingReport::ThreadReport();
+    i_rWork();
+
+    Herd::Generic::ProfilingReport counts = Herd::Generic::ProfilingReport::ThreadReport();
+    counts -= start;
+    io_rReport += counts;
+  } else
+  {
+    i_rWork();
+  }
+}
+
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_ThreadCount Number of threads. If 0, the number of hardware threads
+ */
+PopulationEvolution::PopulationEvolution( unsigned int i_ThreadCount ) :
+    m_Scheduler( i_ThreadCount )
+{
+  m_Simulators.reserve( m_Scheduler.ThreadCount() );
+  for( unsigned int index = 0; index < m_Scheduler.ThreadCount(); ++index )
+  {
+    m_Simulators.push_back( std::make_unique< Herd::SSE::SingleStarEvolutuion >() );
+  }
+
+  m_ProfilingReports.resize( m_Scheduler.ThreadCount() );
+}
+
+/**
+ * @param i_Population Initial conditions for each star
+ * @param i_rParameters Evolution parameters, common to all stars
+ * @param[out] o_FinalStates State of each star at the end of its evolution. Caller-allocated, same order as \c i_Population
+ * @pre \c o_FinalStates has the same size as \c i_Population
+ * @pre Each element of \c i_Population satisfies the preconditions of SingleStarEvolutuion::Evolve
+ * @throws PreconditionError If any preconditions are violated
+ * @remarks Stars are evolved in the order of increasing metallicity, so that each metallicity group is set up once per thread
+ * @remarks The supernova kick seed of each star is derived from Parameters::m_Seed and its index in \c i_Population
+ */
+void PopulationEvolution::Evolve( std::span< const InitialConditions > i_Population, const Herd::SSE::SingleStarEvolutuion::Parameters& i_rParameters,
+    std::span< Herd::SSE::TrackPoint > o_FinalStates )
+{
+  if( i_Population.size() != o_FinalStates.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_FinalStates", "Same size as i_Population", o_FinalStates.size() );
+  }
+
+  SortByMetallicity( i_Population );
+  ResetProfilingReports();
+
+  m_Scheduler.Run( m_Order.size(), [ & ]( std::size_t i_WorkerIndex, std::size_t i_TaskIndex )
+  {
+    std::size_t index = m_Order[ i_TaskIndex ];
+    const InitialConditions& rStar = i_Population[ index ];
+
+    Herd::SSE::SingleStarEvolutuion& rSimulator = *m_Simulators[ i_WorkerIndex ];
+    Profile( m_ProfilingReports[ i_WorkerIndex ], [ & ]()
+    {
+      rSimulator.Evolve( rStar.m_Mass, rStar.m_Z, rStar.m_EvolveUntil, i_rParameters, ComputeSeed( i_rParameters.m_Seed, index ) );
+    } );
+    o_FinalStates[ index ] = rSimulator.Trajectory().back();
+  } );
+}
+
+/**
+ * @param i_Population Initial conditions for each star
+ * @param i_rParameters Evolution parameters, common to all stars
+ * @param[out] o_FinalStates State of each star at the end of its evolution. Caller-allocated, same order as \c i_Population
+ * @param[in, out] io_Sinks Sinks, one per thread. Each receives the trajectories of the stars evolved by its thread, with the index of the star in \c i_Population as the track index
+ * @pre \c o_FinalStates has the same size as \c i_Population
+ * @pre \c io_Sinks has ThreadCount() elements, none of which are \c nullptr
+ * @pre Each element of \c i_Population satisfies the preconditions of SingleStarEvolutuion::Evolve
+ * @throws PreconditionError If any preconditions are violated
+ * @remarks The trajectories are not held in memory, so the memory use is bounded by the sinks. The order of the tracks within a sink depends on the scheduling
+ */
+void PopulationEvolution::Evolve( std::span< const InitialConditions > i_Population, const Herd::SSE::SingleStarEvolutuion::Parameters& i_rParameters,
+    std::span< Herd::SSE::TrackPoint > o_FinalStates, std::span< Herd::SSE::ITrajectorySink* const > io_Sinks )
+{
+  if( i_Population.size() != o_FinalStates.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "o_FinalStates", "Same size as i_Population", o_FinalStates.size() );
+  }
+
+  if( io_Sinks.size() != ThreadCount() || ranges::cpp20::find( io_Sinks, nullptr ) != io_Sinks.end() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "io_Sinks", "One sink per thread", io_Sinks.size() );
+  }
+
+  SortByMetallicity( i_Population );
+  ResetProfilingReports();
+
+  for( unsigned int index = 0; index < ThreadCount(); ++index )
+  {
+    m_Simulators[ index ]->SetTrajectorySink( io_Sinks[ index ] );
+  }
+
+  try
+  {
+    m_Scheduler.Run( m_Order.size(), [ & ]( std::size_t i_WorkerIndex, std::size_t i_TaskIndex )
+    {
+      std::size_t index = m_Order[ i_TaskIndex ];
+      const InitialConditions& rStar = i_Population[ index ];
+
+      Herd::SSE::SingleStarEvolutuion& rSimulator = *m_Simulators[ i_WorkerIndex ];
+      Herd::SSE::ITrajectorySink& rSink = *io_Sinks[ i_WorkerIndex ];
+
+      rSink.Begin( index );
+      Profile( m_ProfilingReports[ i_WorkerIndex ], [ & ]()
+      {
+        rSimulator.Evolve( rStar.m_Mass, rStar.m_Z, rStar.m_EvolveUntil, i_rParameters, ComputeSeed( i_rParameters.m_Seed, index ) );
+      } );
+      rSink.End();
+
+      o_FinalStates[ index ] = rSimulator.MakeCheckpoint().m_State.m_TrackPoint;
+    } );
+  } catch( ... )
+  {
+    for( auto& rpSimulator : m_Simulators )
+    {
+      rpSimulator->SetTrajectorySink( nullptr );
+    }
+
+    throw;
+  }
+
+  for( auto& rpSimulator : m_Simulators )
+  {
+    rpSimulator->SetTrajectorySink( nullptr );
+  }
+}
+
+/**
+ * @return Number of threads, including the calling thread
+ */
+unsigned int PopulationEvolution::ThreadCount() const
+{
+  return m_Scheduler.ThreadCount();
+}
+
+/**
+ * @return Profiling counters for the stars evolved in the last call to Evolve, summed over the threads. All zero if profiling is disabled
+ * @remarks Only the time spent in SingleStarEvolutuion::Evolve is counted, so the work of other objects on the same threads is excluded
+ */
+Herd::Generic::ProfilingReport PopulationEvolution::ProfilingReport() const
+{
+  Herd::Generic::ProfilingReport output;
+  for( const auto& rReport : m_ProfilingReports )
+  {
+    output += rReport;
+  }
+
+  return output;
+}
+
+/**
+ * @param i_Seed Seed for the population
+ * @param i_Index Index of the star in the population
+ * @return Seed for the star
+ * @remarks SplitMix64 finaliser, so that the seeds of neighbouring stars are uncorrelated
+ * @cite Steele14
+ */
+uint_fast64_t PopulationEvolution::ComputeSeed( uint_fast64_t i_Seed, std::size_t i_Index )
+{
+  std::uint64_t z = i_Seed + ( i_Index + 1 ) * 0x9e3779b97f4a7c15ull;
+  z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ull;
+  z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebull;
+  return z ^ ( z >> 31 );
+}
+
+/**
+ * @param i_Population Initial conditions for each star
+ * @remarks Stable, so the stars with the same metallicity are processed in their input order
+ */
+void PopulationEvolution::SortByMetallicity( std::span< const InitialConditions > i_Population )
+{
+  m_Order.resize( i_Population.size() );
+  std::iota( m_Order.begin(), m_Order.end(), 0 );
+  ranges::cpp20::stable_sort( m_Order, [ & ]( std::size_t i_Left, std::size_t i_Right )
+  { return i_Population[ i_Left ].m_Z < i_Population[ i_Right ].m_Z;} );
+}
+
+/**
+ * @remarks Called at the start of each population, so that ProfilingReport() covers only the last one
+ */
+void PopulationEvolution::ResetProfilingReports()
+{
+  for( auto& rReport : m_ProfilingReports )
+  {
+    rReport.Reset();
+  }
+}
+
+}
@@ -0,0 +1,78 @@
+/**
+ * @file PopulationEvolution.h
+ * @author Evren Imre
+ * @date 17 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H875A0992_BA36_4C42_BE3C_A6A1A43A2E71
+#define H875A0992_BA36_4C42_BE3C_A6A1A43A2E71
+
+#include "ITrajectorySink.h"
+#include "SingleStarEvolution.h"
+#include "TrackPoint.h"
+
+#include <Generic/Profiling.h>
+#include <Generic/Quantity.h>
+#include <Generic/WorkStealingScheduler.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Evolves a population of stars with a common set of parameters
+ * @remarks Stars with the same metallicity share the metallicity-dependent computations
+ * @remarks Stars are distributed across threads with work stealing. The results do not depend on the number of threads
+ */
+class PopulationEvolution
+{
+public:
+
+  /**
+   * @brief Initial conditions for a star
+   */
+  struct InitialConditions
+  {
+    Herd::Generic::Mass m_Mass; ///< Initial mass
+    Herd::Generic::Metallicity m_Z; ///< Metallicity
+    Herd::Generic::Time m_EvolveUntil; ///< Evolve until this age
+  };
+
+  explicit PopulationEvolution( unsigned int i_ThreadCount = 1 ); ///< Constructor
+
+  void Evolve( std::span< const InitialConditions > i_Population, const Herd::SSE::SingleStarEvolutuion::Parameters& i_rParameters,
+      std::span< Herd::SSE::TrackPoint > o_FinalStates ); ///< Evolves a population
+  void Evolve( std::span< const InitialConditions > i_Population, const Herd::SSE::SingleStarEvolutuion::Parameters& i_rParameters,
+      std::span< Herd::SSE::TrackPoint > o_FinalStates, std::span< Herd::SSE::ITrajectorySink* const > io_Sinks ); ///< Evolves a population, and passes the trajectories to sinks
+
+  unsigned int ThreadCount() const; ///< Number of threads
+
+  Herd::Generic::ProfilingReport ProfilingReport() const; ///< Returns the profiling counters for the last population
+
+  static uint_fast64_t ComputeSeed( uint_fast64_t i_Seed, std::size_t i_Index ); ///< Computes the random number seed for a star
+
+private:
+
+  void SortByMetallicity( std::span< const InitialConditions > i_Population ); ///< Orders the stars by metallicity
+  void ResetProfilingReports(); ///< Clears the profiling counters of the workers
+
+  Herd::Generic::WorkStealingScheduler m_Scheduler; ///< Distributes the stars across the threads
+  std::vector< std::unique_ptr< Herd::SSE::SingleStarEvolutuion > > m_Simulators;  ///< Evolves the individual stars. One per thread
+  std::vector< std::size_t > m_Order; ///< Order in which the stars are evolved
+  std::vector< Herd::Generic::ProfilingReport > m_ProfilingReports; ///< Profiling counters for the stars evolved by each worker
+};
+
+}
+
+#endif /* H875A0992_BA36_4C42_BE3C_A6A1A43A2E71 */
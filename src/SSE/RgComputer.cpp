@@ -12,6 +12,7 @@
 
 #include "RgComputer.h"
 
+#include <Generic/ValidationPolicy.h>
 #include <SSE/Landmarks/BaseOfGiantBranch.h>
 
 namespace Herd::SSE
@@ -19,10 +20,11 @@ namespace Herd::SSE
 
 /**
  * @param i_Z Metallicity
+ * @param[in, out] io_pResource Memory resource for the landmark computers. Must outlive the object
  */
-RgComputer::RgComputer( Herd::Generic::Metallicity i_Z )
+RgComputer::RgComputer( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource )
 {
-  m_ZDependents.m_pBGBComputer = std::make_unique< Herd::SSE::BaseOfGiantBranch >( i_Z );
+  m_ZDependents.m_pBGBComputer = Herd::Generic::MakeArenaPtr< Herd::SSE::BaseOfGiantBranch >( io_pResource, i_Z, io_pResource );
 }
 
 /**
@@ -32,7 +34,10 @@ RgComputer::RgComputer( Herd::Generic::Metallicity i_Z )
  */
 Herd::Generic::Radius RgComputer::ComputeRg( const Herd::SSE::EvolutionState& i_rState )
 {
-  Herd::SSE::ValidateEvolutionState( i_rState );
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    Herd::SSE::ValidateEvolutionState( i_rState );
+  }
 
   const auto& rTrackPoint = i_rState.m_TrackPoint;
   if( rTrackPoint.m_Stage == Herd::SSE::EvolutionStage::e_MS || rTrackPoint.m_Stage == Herd::SSE::EvolutionStage::e_MSLM )
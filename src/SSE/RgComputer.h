@@ -15,9 +15,11 @@
 
 #include "EvolutionState.h"
 
+#include <Generic/Arena.h>
 #include <Generic/Quantity.h>
 
 #include <memory>
+#include <memory_resource>
 
 namespace Herd::SSE
 {
@@ -33,7 +35,7 @@ class RgComputer
 {
 public:
 
-  RgComputer( Herd::Generic::Metallicity i_Z );  ///< Constructor
+  RgComputer( Herd::Generic::Metallicity i_Z, std::pmr::memory_resource* io_pResource = std::pmr::get_default_resource() );  ///< Constructor
   ~RgComputer(); ///< Destructor
 
   Herd::Generic::Radius ComputeRg( const Herd::SSE::EvolutionState& i_rState ); ///< Computes \f$ R_g \f$
@@ -45,7 +47,7 @@ private:
    */
   struct MetallicityDependents
   {
-    std::unique_ptr< Herd::SSE::BaseOfGiantBranch > m_pBGBComputer; ///< Computes the characteristic values at BGB
+    Herd::Generic::ArenaPtr< Herd::SSE::BaseOfGiantBranch > m_pBGBComputer; ///< Computes the characteristic values at BGB
   };
 
   MetallicityDependents m_ZDependents;  ///< Metallicity-dependent quantities evaluated at initial metallicity
@@ -13,17 +13,25 @@
 #include "SingleStarEvolution.h"
 
 #include "ConvectiveEnvelope.h"
+#include "FixedFractionStepController.h"
 #include "EvolutionState.h"
 #include "IPhase.h"
 #include "MainSequence.h"
+#include "MetallicityGrid.h"
+#include "PIStepController.h"
 #include "StellarRotation.h"
 #include "StellarWindMassLoss.h"
 
+#include <SSE/Landmarks/Constants.h>
+
 #include <Exceptions/ExceptionWrappers.h>
+#include <Generic/Profiling.h>
 #include <Generic/Quantity.h>
 
+#include <bit>
 #include <cmath>
 #include <functional>
+#include <iterator>
 
 #include <range/v3/algorithm.hpp>
 #include <range/v3/numeric.hpp>
@@ -32,6 +40,13 @@
 namespace Herd::SSE
 {
 
+SingleStarEvolutuion::SingleStarEvolutuion() = default;
+
+/**
+ * @remarks Destructor is needed to be able to use forward declarations in with std::unique_ptr
+ */
+SingleStarEvolutuion::~SingleStarEvolutuion() = default;
+
 /**
  * @param i_Mass Initial mass in \f$ M_{\odot}\f$
  * @param i_Z Metallicity
@@ -41,30 +56,132 @@ namespace Herd::SSE
  * @pre \c i_Mass within SingleStarEvolutuionSpecs::s_MassRange
  * @pre \c i_Z within SingleStarEvolutuionSpecs::s_MetallicityRange
  * @pre \c i_EvolveUntil >= 0
+ * @remarks The metallicity-dependent computations are shared with the previous call if the metallicity is the same
+ * @remarks Supernova kicks are seeded from Parameters::m_Seed
  */
 void SingleStarEvolutuion::Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z, Herd::Generic::Time i_EvolveUntil,
     const Parameters& i_rParameters )
+{
+  Evolve( i_Mass, i_Z, i_EvolveUntil, i_rParameters, i_rParameters.m_Seed );
+}
+
+/**
+ * @param i_Mass Initial mass in \f$ M_{\odot}\f$
+ * @param i_Z Metallicity
+ * @param i_EvolveUntil Evolve until this age
+ * @param i_rParameters %Parameters
+ * @param i_Seed Random number seed for the supernova kick. Overrides Parameters::m_Seed
+ * @pre \c i_rParameters is valid
+ * @pre \c i_Mass within SingleStarEvolutuionSpecs::s_MassRange
+ * @pre \c i_Z within SingleStarEvolutuionSpecs::s_MetallicityRange
+ * @pre \c i_EvolveUntil >= 0
+ * @remarks The metallicity-dependent computations are shared with the previous call if the metallicity is the same
+ * @remarks Parameters::m_OutputPolicy selects the track points stored in the trajectory
+ * @remarks If Parameters::m_MetallicityGridStep is positive, the star is evolved at the grid metallicity, which is also the initial metallicity in the trajectory
+ * @remarks The seed is stored for the supernova kick, and is not consumed yet
+ */
+void SingleStarEvolutuion::Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z, Herd::Generic::Time i_EvolveUntil,
+    const Parameters& i_rParameters, uint_fast64_t i_Seed )
 {
   Validate( i_rParameters );
   Validate( i_Mass, i_Z, i_EvolveUntil );
 
-  m_Trajectory.reserve( EstimateTrajectoryLength( i_rParameters ) );
+  m_Seed = i_Seed;
+  m_InitialMass = i_Mass;
+
+  InitialisePhases( i_Mass, SnapMetallicity( i_Z, i_rParameters ) );
 
   // ZAMS
   Herd::SSE::EvolutionState state;
-  auto& rTrackPoint = state.m_TrackPoint;
-  rTrackPoint.m_Mass = i_Mass;
+  state.m_TrackPoint.m_Mass = i_Mass;
 
-  Herd::SSE::MainSequence ms( i_Z );
-  ms.Evolve( state ); // Call at age zero initialises the state to ZAMS
+  m_pMainSequence->Evolve( state ); // Call at age zero initialises the state to ZAMS
 
-  Herd::SSE::ConvectiveEnvelope convectiveEnvelopeComputer( i_Mass, i_Z );
-  auto convectiveEnvelope = convectiveEnvelopeComputer.Compute( state );
+  auto convectiveEnvelope = m_pConvectiveEnvelope->Compute( state );
   state.m_K2 = convectiveEnvelope.m_K2;
-  rTrackPoint.m_EnvelopeMass = convectiveEnvelope.m_Mass;
+  state.m_TrackPoint.m_EnvelopeMass = convectiveEnvelope.m_Mass;
 
   Herd::SSE::StellarRotation::InitialiseAtZAMS( state );
-  m_Trajectory.push_back( rTrackPoint );
+
+  Run( state, i_EvolveUntil, i_rParameters );
+}
+
+/**
+ * @param i_rCheckpoint Checkpoint, from MakeCheckpoint or ReadCheckpoint
+ * @param i_EvolveUntil Evolve until this age
+ * @param i_rParameters %Parameters
+ * @pre \c i_rParameters is valid
+ * @pre The initial mass and the metallicity in \c i_rCheckpoint are within SingleStarEvolutuionSpecs::s_MassRange and SingleStarEvolutuionSpecs::s_MetallicityRange
+ * @pre \c i_EvolveUntil >= 0
+ * @remarks The trajectory starts at the track point of the checkpoint. If \c i_EvolveUntil does not exceed its age, that is the only track point
+ * @remarks The result is the same as that of an evolution that stopped at the age of the checkpoint and continued. It differs from an uninterrupted evolution, as the step before the checkpoint is cut short to end at its age
+ * @remarks The timestep controller starts afresh, as after a stage change
+ */
+void SingleStarEvolutuion::Resume( const Herd::SSE::Checkpoint& i_rCheckpoint, Herd::Generic::Time i_EvolveUntil, const Parameters& i_rParameters )
+{
+  Validate( i_rParameters );
+  Validate( i_rCheckpoint.m_InitialMass, i_rCheckpoint.m_State.m_TrackPoint.m_InitialMetallicity, i_EvolveUntil );
+
+  m_Seed = i_rCheckpoint.m_Seed;
+  m_InitialMass = i_rCheckpoint.m_InitialMass;
+
+  InitialisePhases( i_rCheckpoint.m_InitialMass, SnapMetallicity( i_rCheckpoint.m_State.m_TrackPoint.m_InitialMetallicity, i_rParameters ) );
+  m_pMainSequence->RestoreMassDependents( i_rCheckpoint.m_MainSequenceEvaluatedAt );
+
+  Herd::SSE::EvolutionState state = i_rCheckpoint.m_State;
+  Run( state, i_EvolveUntil, i_rParameters );
+}
+
+/**
+ * @return Checkpoint at the last accepted step of the most recent call to Evolve or Resume
+ * @pre A star is evolved
+ * @throws PreconditionError If the precondition is violated
+ */
+Herd::SSE::Checkpoint SingleStarEvolutuion::MakeCheckpoint() const
+{
+  if( !m_pMainSequence || m_InitialMass == 0 )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "SingleStarEvolutuion", "An evolved star", "No star" );
+  }
+
+  return Herd::SSE::Checkpoint { m_State, m_InitialMass, m_pMainSequence->MassDependentsEvaluatedAt(), m_Seed };
+}
+
+/**
+ * @param[in, out] io_rState Initial state. At exit, the state at the last accepted step
+ * @param i_EvolveUntil Evolve until this age
+ * @param i_rParameters %Parameters
+ * @pre The phase computers are initialised for the star
+ * @remarks The stored track points go to the sink, if set. Otherwise, to SingleStarEvolutuion::m_Trajectory
+ */
+void SingleStarEvolutuion::Run( Herd::SSE::EvolutionState& io_rState, Herd::Generic::Time i_EvolveUntil, const Parameters& i_rParameters )
+{
+  m_Trajectory.clear();
+  m_TimestepStatistics.Reset();
+  if( !m_pSink && i_rParameters.m_OutputPolicy == Herd::SSE::OutputPolicy::e_EveryStep )
+  {
+    m_Trajectory.reserve( EstimateTrajectoryLength( i_rParameters ) );
+  }
+
+  Herd::SSE::ITrajectorySink& rSink = m_pSink ? *m_pSink : m_Trajectory;
+
+  Herd::SSE::OutputFilter outputFilter( i_rParameters.m_OutputPolicy, i_rParameters.m_OutputAges, i_rParameters.m_OutputRelativeChange );
+
+  Herd::SSE::MainSequence& ms = *m_pMainSequence;
+  Herd::SSE::ConvectiveEnvelope& convectiveEnvelopeComputer = *m_pConvectiveEnvelope;
+  Herd::SSE::ConvectiveEnvelope::Envelope convectiveEnvelope;
+
+  Herd::SSE::EvolutionState& state = io_rState;
+  auto& rTrackPoint = state.m_TrackPoint;
+  outputFilter.Push( rTrackPoint, rSink );
+
+  // Timestep controller. Both are cheap to construct
+  Herd::SSE::FixedFractionStepController fixedFractionController;
+  Herd::SSE::PIStepController piController( i_rParameters.m_StepTolerance );
+  Herd::SSE::IStepController& rStepController =
+      i_rParameters.m_StepControl == Herd::SSE::StepControl::e_PI ? static_cast< Herd::SSE::IStepController& >( piController ) : fixedFractionController;
+
+  TrialStep trialStep;
 
   while( rTrackPoint.m_Age < i_EvolveUntil )
   {
@@ -74,24 +191,52 @@ void SingleStarEvolutuion::Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Me
       break;
     }
 
+    Herd::SSE::EvolutionState previousState = state;
+
     // Mass and angular momentum loss rate between the previous step and the current step
     state.m_MassLossRate = Herd::SSE::StellarWindMassLoss::Compute( rTrackPoint, i_rParameters.m_Eta, i_rParameters.m_HeWind, i_rParameters.m_BinaryWind,
         i_rParameters.m_RocheLobe );
     double angularMomentumLossRate = Herd::SSE::StellarRotation::ComputeAngularMomentumLossRate( state ); // Momentum loss from the angular velocity at the previous time point
 
+    // The phase is dispatched statically, so that the calls into the phase are direct
+    PhaseVariant phase = SelectPhase( rTrackPoint.m_Stage );
+    Herd::SSE::StageTimestepStatistics& rStatistics = m_TimestepStatistics[ rTrackPoint.m_Stage ];
+
     // Compute the size of the time step
-    Herd::Generic::Time DeltaT = ComputeTimestep( ms, state, i_rParameters, i_EvolveUntil );
+    Herd::Generic::Time DeltaT = std::visit( [ & ]( auto* io_pPhase )
+    {
+      return ComputeTimestep( *io_pPhase, state, i_rParameters, i_EvolveUntil, rStepController, trialStep, rStatistics );
+    }, phase );
 
     state.m_DeltaT = DeltaT;
     rTrackPoint.m_Age += DeltaT;
     rTrackPoint.m_Mass -= Herd::Generic::Mass( ( state.m_MassLossRate * 1.0e6 ) * DeltaT ); // 1e6 to convert loss in year to Myr
     state.m_AngularMomentum -= Herd::Generic::AngularMomentum( ( angularMomentumLossRate * 1.0e6 ) * DeltaT );
 
-    // Run the evolution step
+    // Run the evolution step. If the last trial step had the same inputs, its result is reused
     // TODO Stage transition to be implemented
-    Herd::SSE::EvolutionStage nextStage = ms.Evolve( state );
+    Herd::SSE::EvolutionStage nextStage;
+    if( IsSameStep( trialStep, state ) )
+    {
+      nextStage = trialStep.m_NextStage;
+      if( Herd::SSE::IsMS( nextStage ) )
+      {
+        Herd::Generic::AngularMomentum angularMomentum = state.m_AngularMomentum; // The phase does not update the angular momentum
+        state = trialStep.m_State;
+        state.m_AngularMomentum = angularMomentum;
+      }
+    } else
+    {
+      nextStage = std::visit( [ & ]( auto* io_pPhase )
+      {
+        return io_pPhase->Evolve( state );
+      }, phase );
+      ++rStatistics.m_PhaseEvaluations;
+    }
+
     if( !Herd::SSE::IsMS( nextStage ) )
     {
+      state = previousState; // Not accepted
       break;
     }
 
@@ -102,9 +247,16 @@ void SingleStarEvolutuion::Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Me
 
     rTrackPoint.m_AngularVelocity = Herd::SSE::StellarRotation::ComputeAngularVelocity( state );
 
-    m_Trajectory.push_back( rTrackPoint );
+    rStepController.Accept( previousState.m_TrackPoint, rTrackPoint, DeltaT );
+    outputFilter.Push( rTrackPoint, rSink );
+
+    ++rStatistics.m_AcceptedSteps;
+    ++rStatistics.LimitedBy( trialStep.m_Limit );
   }
 
+  outputFilter.Flush( rSink );
+  m_State = state;
+
   // TODO Correct the temperature: AMUSE.SSE and IAU use slightly different values. But do this only when all computations are finished. menv uses temperature ratios, so it is not affected
 
   // Loop
@@ -115,14 +267,92 @@ void SingleStarEvolutuion::Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Me
 
 }
 
+/**
+ * @return 64-bit FNV-1a hash of the parameters
+ * @remarks Stable across runs and platforms with the same byte order. Time step sizes are hashed in the order of the stages
+ */
+uint64_t SingleStarEvolutuion::Parameters::Hash() const
+{
+  uint64_t hash = 0xcbf29ce484222325;
+  auto Combine = [ &hash ]( uint64_t i_Value )
+  {
+    for( unsigned int index = 0; index < 8; ++index )
+    {
+      hash ^= ( i_Value >> ( 8 * index ) ) & 0xFF;
+      hash *= 0x100000001b3;
+    }
+  };
+
+  auto CombineDouble = [ &Combine ]( double i_Value )
+  {
+    Combine( std::bit_cast< uint64_t >( i_Value ) );
+  };
+
+  CombineDouble( m_Eta );
+  CombineDouble( m_HeWind );
+  CombineDouble( m_BinaryWind );
+  CombineDouble( m_RocheLobe );
+  CombineDouble( m_SupernovaKickDispersion );
+  Combine( m_Seed );
+
+  Combine( m_UseHanIFMR );
+  Combine( m_UseModifiedMestel );
+  Combine( m_AllowVelocityKickForBlackHoles );
+  Combine( m_UseBelczynskiMass );
+
+  for( auto stage : Herd::SSE::EnumerateEvolutionStages() )
+  {
+    if( auto it = m_RelativeTimeStepSizes.find( stage ); it != m_RelativeTimeStepSizes.end() )
+    {
+      Combine( static_cast< uint64_t >( stage ) );
+      CombineDouble( it->second );
+    }
+  }
+
+  CombineDouble( m_DefaultTimestep );
+  Combine( static_cast< uint64_t >( m_StepControl ) );
+  CombineDouble( m_StepTolerance );
+  CombineDouble( m_MinRemnantTimestep );
+
+  Combine( static_cast< uint64_t >( m_OutputPolicy ) );
+  Combine( m_OutputAges.size() );
+  for( auto age : m_OutputAges )
+  {
+    CombineDouble( age );
+  }
+  CombineDouble( m_OutputRelativeChange );
+  CombineDouble( m_MetallicityGridStep );
+
+  return hash;
+}
+
+/**
+ * @param io_pSink Sink. If \c nullptr, the track points are stored in SingleStarEvolutuion::m_Trajectory
+ * @remarks With a sink, Trajectory() is empty, and the memory use does not grow with the length of the track
+ * @remarks The sink must outlive the subsequent calls to Evolve and Resume. Begin and End are the responsibility of the caller
+ */
+void SingleStarEvolutuion::SetTrajectorySink( Herd::SSE::ITrajectorySink* io_pSink )
+{
+  m_pSink = io_pSink;
+}
+
 /**
  * @return A constant reference to SingleStarEvolutuion::m_Trajectory
  */
-const std::vector< Herd::SSE::TrackPoint >& SingleStarEvolutuion::Trajectory() const
+const Herd::SSE::ColumnarTrajectory& SingleStarEvolutuion::Trajectory() const
 {
   return m_Trajectory;
 }
 
+/**
+ * @return A constant reference to SingleStarEvolutuion::m_TimestepStatistics
+ * @remarks Counts for the most recent call to Evolve or Resume. The steps are attributed to the stage at their start
+ */
+const Herd::SSE::TimestepStatistics& SingleStarEvolutuion::TimestepStatistics() const
+{
+  return m_TimestepStatistics;
+}
+
 /**
  * @param i_rParameters %Parameters to be validated
  * @throws PreconditionError
@@ -143,6 +373,10 @@ void SingleStarEvolutuion::Validate( const Parameters& i_rParameters )
 
   Herd::Exceptions::ThrowPreconditionErrorIfNegative( i_rParameters.m_DefaultTimestep, "m_DefaultTimestep" ); // @suppress("Invalid arguments")
   Herd::Exceptions::ThrowPreconditionErrorIfNegative( i_rParameters.m_MinRemnantTimestep, "m_MinRemnantTimestep" ); // @suppress("Invalid arguments")
+  Herd::Exceptions::ThrowPreconditionErrorIfNotPositive( i_rParameters.m_StepTolerance, "m_StepTolerance" ); // @suppress("Invalid arguments")
+  Herd::Exceptions::ThrowPreconditionErrorIfNegative( i_rParameters.m_MetallicityGridStep, "m_MetallicityGridStep" ); // @suppress("Invalid arguments")
+
+  Herd::SSE::OutputFilter::Validate( i_rParameters.m_OutputAges, i_rParameters.m_OutputRelativeChange );
 }
 
 /**
@@ -158,6 +392,68 @@ void SingleStarEvolutuion::Validate( Herd::Generic::Mass i_Mass, Herd::Generic::
   Herd::Exceptions::ThrowPreconditionErrorIfNegative( i_EvolveUntil, "i_EvolveUntil" ); // @suppress("Invalid arguments")
 }
 
+/**
+ * @param i_Z Metallicity
+ * @param i_rParameters %Parameters
+ * @return \c i_Z snapped to the metallicity grid in Parameters::m_MetallicityGridStep. If the step is zero, \c i_Z
+ * @pre \c i_Z within SingleStarEvolutuionSpecs::s_MetallicityRange
+ * @remarks Idempotent, so a resumed star is evolved at the same metallicity
+ */
+Herd::Generic::Metallicity SingleStarEvolutuion::SnapMetallicity( Herd::Generic::Metallicity i_Z, const Parameters& i_rParameters )
+{
+  if( i_rParameters.m_MetallicityGridStep == 0 )
+  {
+    return i_Z;
+  }
+
+  return Herd::SSE::MetallicityGrid( SingleStarEvolutuionSpecs::s_MetallicityRange, i_rParameters.m_MetallicityGridStep ).Snap( i_Z );
+}
+
+/**
+ * @param i_Mass Initial mass
+ * @param i_Z Metallicity
+ * @remarks At a new metallicity, the computers are rebuilt in SingleStarEvolutuion::m_Arena. Once the arena has grown to fit them, this does not allocate
+ */
+void SingleStarEvolutuion::InitialisePhases( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z )
+{
+  if( m_pMainSequence && i_Z == m_PhasesEvaluatedAt )
+  {
+    m_pConvectiveEnvelope->Reset( i_Mass );
+    return;
+  }
+
+  // The old computers are destroyed before the arena is reused
+  m_pMainSequence.reset();
+  m_pConvectiveEnvelope.reset();
+  m_Arena.Reset();
+
+  m_pMainSequence = Herd::Generic::MakeArenaPtr< Herd::SSE::MainSequence >( &m_Arena, i_Z, &m_Arena );
+  m_pConvectiveEnvelope = Herd::Generic::MakeArenaPtr< Herd::SSE::ConvectiveEnvelope >( &m_Arena, i_Mass, i_Z, &m_Arena );
+  m_PhasesEvaluatedAt = i_Z;
+}
+
+/**
+ * @param i_Stage Evolution stage
+ * @return Phase computer for \c i_Stage
+ * @remarks Only the main sequence is implemented. The evolution loop ends at the first stage after the main sequence
+ */
+SingleStarEvolutuion::PhaseVariant SingleStarEvolutuion::SelectPhase( [[maybe_unused]] Herd::SSE::EvolutionStage i_Stage ) const
+{
+  return m_pMainSequence.get();
+}
+
+/**
+ * @param i_rTrialStep Trial step
+ * @param i_rState State before the actual step
+ * @return \c true if the trial step has the same mass and timestep as \c i_rState
+ * @remarks The trial starts from the same state as the actual step, so the other inputs of the phase are the same. The phase does not read the angular momentum
+ */
+bool SingleStarEvolutuion::IsSameStep( const TrialStep& i_rTrialStep, const Herd::SSE::EvolutionState& i_rState )
+{
+  return i_rTrialStep.m_NextStage != Herd::SSE::EvolutionStage::e_Undefined && i_rTrialStep.m_State.m_DeltaT == i_rState.m_DeltaT
+      && i_rTrialStep.m_State.m_TrackPoint.m_Mass == i_rState.m_TrackPoint.m_Mass;
+}
+
 unsigned int SingleStarEvolutuion::EstimateTrajectoryLength( const Parameters& i_rParameters )
 {
   // Accumulate is not included in C++20. C++23 has fold-left
@@ -166,16 +462,86 @@ unsigned int SingleStarEvolutuion::EstimateTrajectoryLength( const Parameters& i
           | ranges::cpp20::views::transform( std::bind( std::divides< double >(), 1., std::placeholders::_1 ) ), 0 );
 }
 
+/**
+ * @remarks The coefficients are stored in MetallicityCache, which retains them. The subsequent evolutions at these metallicities do not compute them
+ * @remarks Thread-safe. Optional: the coefficients are otherwise computed at the first use
+ */
+void SingleStarEvolutuion::PrecomputeCanonicalMetallicities()
+{
+  for( double z : Herd::SSE::Constants::s_CanonicalMetallicities )
+  {
+    PrecomputeCoefficients( Herd::Generic::Metallicity( z ) );  // Retained by the cache
+  }
+}
+
+/**
+ * @param i_Step Step of the grid in dex, as in Parameters::m_MetallicityGridStep
+ * @return References to the coefficients in MetallicityCache
+ * @pre \c i_Step is positive
+ * @throws PreconditionError If the precondition is violated
+ * @remarks The coefficients are retained as long as the returned references are held, e.g. for the duration of a population run
+ * @remarks Thread-safe. Optional: the coefficients are otherwise computed at the first use
+ */
+Herd::SSE::MetallicityCache::Handles SingleStarEvolutuion::PrecomputeMetallicityGrid( double i_Step )
+{
+  Herd::SSE::MetallicityGrid grid( SingleStarEvolutuionSpecs::s_MetallicityRange, i_Step );
+
+  Herd::SSE::MetallicityCache::Handles output;
+  for( std::size_t index = 0; index < grid.size(); ++index )
+  {
+    Herd::SSE::MetallicityCache::Handles node = PrecomputeCoefficients( grid[ index ] );
+    output.insert( output.end(), std::make_move_iterator( node.begin() ), std::make_move_iterator( node.end() ) );
+  }
+
+  return output;
+}
+
+/**
+ * @param i_Z Metallicity
+ * @return References to the coefficients for \c i_Z in MetallicityCache
+ */
+Herd::SSE::MetallicityCache::Handles SingleStarEvolutuion::PrecomputeCoefficients( Herd::Generic::Metallicity i_Z )
+{
+  // The phase computers fetch all coefficient blocks they need from the cache
+  Herd::SSE::MainSequence ms { i_Z };
+  Herd::SSE::ConvectiveEnvelope convectiveEnvelope( Herd::Generic::Mass( 1. ), i_Z );
+  return Herd::SSE::MetallicityCache::Entries( i_Z );
+}
+
 /**
  * @param[in, out] io_rPhase PEvolution phase simulator
  * @param i_rState Evolution state
  * @param i_rParameters Parameters
  * @param i_EvolveUntil Evolution cut-off
  * @return Timestep in Myr
+ * @remarks Uses FixedFractionStepController
+ * @remarks Dispatches dynamically on \c io_rPhase. The evolution loop uses the statically dispatched overload
  */
 Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( Herd::SSE::IPhase& io_rPhase, const Herd::SSE::EvolutionState& i_rState,
     const Parameters& i_rParameters,
     Herd::Generic::Time i_EvolveUntil )
+{
+  Herd::SSE::FixedFractionStepController stepController;
+  TrialStep trialStep;
+  Herd::SSE::StageTimestepStatistics statistics;
+  return ComputeTimestep( io_rPhase, i_rState, i_rParameters, i_EvolveUntil, stepController, trialStep, statistics );
+}
+
+/**
+ * @param[in, out] io_rPhase PEvolution phase simulator
+ * @param i_rState Evolution state
+ * @param i_rParameters Parameters
+ * @param i_EvolveUntil Evolution cut-off
+ * @param[in, out] io_rStepController Timestep controller
+ * @param[out] o_rTrialStep The last trial step, and the constraint that determined the timestep
+ * @param[in, out] io_rStatistics Counts for the current stage. The phase evaluations and the rejected trials are added
+ * @return Timestep in Myr
+ * @tparam TPhase Phase. A concrete phase is dispatched statically, and IPhase dynamically
+ */
+template< Herd::SSE::Phase TPhase >
+Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( TPhase& io_rPhase, const Herd::SSE::EvolutionState& i_rState, const Parameters& i_rParameters,
+    Herd::Generic::Time i_EvolveUntil, Herd::SSE::IStepController& io_rStepController, TrialStep& o_rTrialStep,
+    Herd::SSE::StageTimestepStatistics& io_rStatistics )
 {
   // Absolute timestep size from the relative size
   const auto& rTrackPoint = i_rState.m_TrackPoint;
@@ -201,16 +567,22 @@ Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( Herd::SSE::IPhase& io
       break;
   }
 
+  deltaT = io_rStepController.Propose( i_rState, deltaT );
+  Herd::SSE::StepLimit limit = Herd::SSE::StepLimit::e_StageFraction;
+
   Herd::Generic::Time remainingTime = endOfPhase - i_rState.m_EffectiveAge;  // Remaining time in the current phase
 
   // Limit the radius change to 10%
   // Compute the state at the next time point and limit the jump
   // Even with the mass loss, this is done at the current mass
-  // When there is no mass loss, this computation is repeated redundantly in the main loop
+  // When there is no mass loss, the main loop reuses the last trial step
   unsigned int iterationCount = 0;
   while( true )
   {
-    Herd::SSE::EvolutionState clonedState = i_rState;  // We want to preserve the original state
+    [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_TimestepTrial );
+
+    Herd::SSE::EvolutionState& clonedState = o_rTrialStep.m_State;
+    clonedState = i_rState;  // We want to preserve the original state
 
     bool bEndOfPhase = remainingTime - deltaT < 1e-10;
     if( bEndOfPhase )
@@ -225,13 +597,17 @@ Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( Herd::SSE::IPhase& io
     }
     clonedState.m_TrackPoint.m_Age += clonedState.m_DeltaT;
 
-    io_rPhase.Evolve( clonedState );
+    o_rTrialStep.m_NextStage = io_rPhase.Evolve( clonedState );
+    ++io_rStatistics.m_PhaseEvaluations;
 
     Herd::Generic::Radius newRadius = clonedState.m_TrackPoint.m_Radius;
     Herd::Generic::Radius oldRadius = i_rState.m_TrackPoint.m_Radius;
     Herd::Generic::Radius absDeltaRadius( std::abs( newRadius - oldRadius ) );
     if( absDeltaRadius / oldRadius > 0.1 )
     {
+      ++io_rStatistics.m_RejectedTrials;
+      limit = Herd::SSE::StepLimit::e_Radius;
+
       if( bEndOfPhase )
       {
         deltaT.Set( remainingTime - i_rState.m_EffectiveAge * 1e-6 );
@@ -248,6 +624,7 @@ Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( Herd::SSE::IPhase& io
       if( bEndOfPhase )
       {
         deltaT.Set( remainingTime );
+        limit = Herd::SSE::StepLimit::e_EndOfPhase;
       }
       break;
     }
@@ -266,6 +643,7 @@ Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( Herd::SSE::IPhase& io
     {
       deltaT.Set( deltaT.Value() * ( nonCoreMass / massLoss ) );
       massLoss = nonCoreMass;
+      limit = Herd::SSE::StepLimit::e_EnvelopeMass;
     }
   }
 
@@ -274,12 +652,24 @@ Herd::Generic::Time SingleStarEvolutuion::ComputeTimestep( Herd::SSE::IPhase& io
   if( relativeMassChange > 0.01 )
   {
     deltaT.Set( deltaT.Value() * ( 0.01 / relativeMassChange ) );
+    limit = Herd::SSE::StepLimit::e_MassChange;
   }
 
   Herd::Generic::Time minStepSize( 1e-7 * i_rState.m_EffectiveAge ); // Minimum timestep prevents tiny updates due to incremental changes to tMS due to mass loss
-  deltaT.Set( std::max( minStepSize, deltaT ) );
-  deltaT.Set( std::min( deltaT, i_EvolveUntil - i_rState.m_TrackPoint.m_Age ) );
+  if( minStepSize > deltaT )
+  {
+    deltaT = minStepSize;
+    limit = Herd::SSE::StepLimit::e_MinimumStep;
+  }
+
+  Herd::Generic::Time remainingEvolution = i_EvolveUntil - i_rState.m_TrackPoint.m_Age;
+  if( remainingEvolution < deltaT )
+  {
+    deltaT = remainingEvolution;
+    limit = Herd::SSE::StepLimit::e_EndOfEvolution;
+  }
 
+  o_rTrialStep.m_Limit = limit;
   return deltaT;
 }
 
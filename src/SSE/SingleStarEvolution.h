@@ -13,23 +13,34 @@
 #ifndef H5CFC91CB_E335_485A_9D7D_189B85CF3E28
 #define H5CFC91CB_E335_485A_9D7D_189B85CF3E28
 
+#include <Generic/Arena.h>
 #include <Generic/Quantity.h>
 #include <Generic/QuantityRange.h>
+#include <SSE/Landmarks/MetallicityCache.h>
 
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
+#include <variant>
 #include <vector>
 
+#include "Checkpoint.h"
+#include "ColumnarTrajectory.h"
 #include "EvolutionStage.h"
+#include "EvolutionState.h"
+#include "IPhase.h"
+#include "ITrajectorySink.h"
+#include "IStepController.h"
+#include "OutputFilter.h"
+#include "TimestepStatistics.h"
 #include "TrackPoint.h"
 
 namespace Herd::SSE
 {
 
 // Forward declarations
-struct EvolutionState;
-class IPhase;
+class ConvectiveEnvelope;
+class MainSequence;
 
 /**
  * @brief Implements the single star evolution
@@ -84,23 +95,86 @@ public:
                         //@formatter:on
 
     double m_DefaultTimestep = 0.01;  ///< Default timestep size as a percentage of the duration of a phase. >0
+
+    Herd::SSE::StepControl m_StepControl = Herd::SSE::StepControl::e_FixedFraction; ///< Timestep controller. The radius and mass change limits apply to all controllers
+    double m_StepTolerance = 0.1; ///< Target relative change of luminosity, radius and mass per step, for StepControl::e_PI. >0
     double m_MinRemnantTimestep = 0.1; ///< Minimum timestep for evolution of a remnant, in Myr. >0
+
+    Herd::SSE::OutputPolicy m_OutputPolicy = Herd::SSE::OutputPolicy::e_EveryStep; ///< Track points to be stored in the trajectory. The timesteps are not affected
+    std::vector< Herd::Generic::Time > m_OutputAges; ///< Output ages for OutputPolicy::e_OutputAges, in Myr. Strictly increasing, >=0
+    double m_OutputRelativeChange = 0.1; ///< Threshold for OutputPolicy::e_RelativeChange. >0
+
+    double m_MetallicityGridStep = 0; ///< If positive, the star is evolved at the metallicity snapped to a MetallicityGrid over SingleStarEvolutuionSpecs::s_MetallicityRange, with this step in dex. >=0
+
+    uint64_t Hash() const; ///< Hash of all parameters, to identify the configuration of a stored track
   };
 
+  SingleStarEvolutuion(); ///< Default constructor
+  ~SingleStarEvolutuion(); ///< Destructor
+
   void Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z, Herd::Generic::Time i_EvolveUntil, const Parameters& i_rParameters ); ///< Evolves a star
+  void Evolve( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z, Herd::Generic::Time i_EvolveUntil, const Parameters& i_rParameters,
+      uint_fast64_t i_Seed ); ///< Evolves a star with an explicit random number seed
+  void Resume( const Herd::SSE::Checkpoint& i_rCheckpoint, Herd::Generic::Time i_EvolveUntil, const Parameters& i_rParameters ); ///< Continues the evolution of a star from a checkpoint
+
+  Herd::SSE::Checkpoint MakeCheckpoint() const; ///< Makes a checkpoint at the last accepted step of the most recent evolution
 
-  const std::vector< Herd::SSE::TrackPoint >& Trajectory() const;  ///< Accessor for SingleStarEvolutuion::m_Trajectory
+  void SetTrajectorySink( Herd::SSE::ITrajectorySink* io_pSink ); ///< Redirects the stored track points to a sink
+  const Herd::SSE::ColumnarTrajectory& Trajectory() const;  ///< Accessor for SingleStarEvolutuion::m_Trajectory
+  const Herd::SSE::TimestepStatistics& TimestepStatistics() const;  ///< Accessor for SingleStarEvolutuion::m_TimestepStatistics
+
+  static Herd::Generic::Time ComputeTimestep( Herd::SSE::IPhase& io_rPhase, const Herd::SSE::EvolutionState& i_rState,
+      const Parameters& i_rParameters, Herd::Generic::Time i_EvolveUntil ); ///< Computes the size of the timestep
+
+  static void PrecomputeCanonicalMetallicities(); ///< Computes the metallicity-dependent coefficients for the canonical metallicities
+  static Herd::SSE::MetallicityCache::Handles PrecomputeMetallicityGrid( double i_Step ); ///< Computes the metallicity-dependent coefficients at the nodes of a metallicity grid
 
 private:
 
+  /**
+   * @brief The last trial step in ComputeTimestep
+   */
+  struct TrialStep
+  {
+    Herd::SSE::EvolutionState m_State; ///< State after the trial step
+    Herd::SSE::EvolutionStage m_NextStage = Herd::SSE::EvolutionStage::e_Undefined; ///< Stage returned by the phase
+    Herd::SSE::StepLimit m_Limit = Herd::SSE::StepLimit::e_StageFraction; ///< Constraint that determined the timestep
+  };
+
+  using PhaseVariant = std::variant< Herd::SSE::MainSequence* >; ///< Implemented phases, for static dispatch
+
+  template< Herd::SSE::Phase TPhase >
+  static Herd::Generic::Time ComputeTimestep( TPhase& io_rPhase, const Herd::SSE::EvolutionState& i_rState, const Parameters& i_rParameters,
+      Herd::Generic::Time i_EvolveUntil, Herd::SSE::IStepController& io_rStepController, TrialStep& o_rTrialStep,
+      Herd::SSE::StageTimestepStatistics& io_rStatistics ); ///< Computes the size of the timestep, and retains the last trial step
+  static bool IsSameStep( const TrialStep& i_rTrialStep, const Herd::SSE::EvolutionState& i_rState ); ///< Whether the trial step has the same inputs as the actual step
+
   static void Validate( const Parameters& i_rParameters ); ///< Validates parameters
   static void Validate( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z, Herd::Generic::Time i_EvolveUntil );  ///< Validates the input arguments
 
+  static Herd::SSE::MetallicityCache::Handles PrecomputeCoefficients( Herd::Generic::Metallicity i_Z ); ///< Computes the metallicity-dependent coefficients of the phase computers
+  static Herd::Generic::Metallicity SnapMetallicity( Herd::Generic::Metallicity i_Z, const Parameters& i_rParameters ); ///< Metallicity at which a star is evolved
+
+  void InitialisePhases( Herd::Generic::Mass i_Mass, Herd::Generic::Metallicity i_Z ); ///< Prepares the phase computers for a new star
+  PhaseVariant SelectPhase( Herd::SSE::EvolutionStage i_Stage ) const; ///< Phase computer for a stage
+  void Run( Herd::SSE::EvolutionState& io_rState, Herd::Generic::Time i_EvolveUntil, const Parameters& i_rParameters ); ///< Evolves a state, and stores the trajectory
+
   unsigned int EstimateTrajectoryLength( const Parameters& i_rParameters ); ///< Estimates the total number of timesteps
-  static Herd::Generic::Time ComputeTimestep( Herd::SSE::IPhase& io_rPhase, const Herd::SSE::EvolutionState& i_rState,
-      const Parameters& i_rParameters, Herd::Generic::Time i_EvolveUntil ); ///< Computes the size of the timestep
 
-  std::vector< Herd::SSE::TrackPoint > m_Trajectory; ///< Evolution trajectory
+  Herd::SSE::ColumnarTrajectory m_Trajectory; ///< Evolution trajectory
+  Herd::SSE::TimestepStatistics m_TimestepStatistics; ///< Timestep counts of the current star
+  Herd::SSE::ITrajectorySink* m_pSink = nullptr; ///< If set, receives the stored track points instead of SingleStarEvolutuion::m_Trajectory
+
+  uint_fast64_t m_Seed = 0; ///< Random number seed for the supernova kick of the current star
+  Herd::Generic::Mass m_InitialMass; ///< Initial mass of the current star. Zero before the first evolution
+  Herd::SSE::EvolutionState m_State;  ///< State at the last accepted step of the current star
+
+  // Metallicity-dependent computers are retained between the calls, and only rebuilt when the metallicity changes
+  // They are allocated from the arena, which is reset at each rebuild. So, a new metallicity does not touch the heap
+  Herd::Generic::Metallicity m_PhasesEvaluatedAt; ///< Metallicity of the phase computers
+  Herd::Generic::Arena m_Arena; ///< Memory for the phase computers and their landmark computers. Declared before them, so that it outlives them
+  Herd::Generic::ArenaPtr< Herd::SSE::MainSequence > m_pMainSequence; ///< Main sequence evolution
+  Herd::Generic::ArenaPtr< Herd::SSE::ConvectiveEnvelope > m_pConvectiveEnvelope; ///< Convective envelope computations
 };
 
 /**
@@ -112,6 +186,7 @@ struct SingleStarEvolutuionSpecs
   // Domain
   inline static const Herd::Generic::ClosedRange s_MassRange = Herd::Generic::ClosedRange( 0.1, 100. ); ///< Valid mass range
   inline static const Herd::Generic::ClosedRange s_MetallicityRange = Herd::Generic::ClosedRange( 1e-4, 0.03 ); ///< Valid metallicity range
+  inline static const Herd::Generic::ClosedRange s_EvolvableMassRange = Herd::Generic::ClosedRange( 0.2, 100. ); ///< Mass range, over which the evolution completes. Narrower than s_MassRange, as the main sequence requires ZeroAgeMainSequenceSpecs::s_MassRange
 };
 }
 
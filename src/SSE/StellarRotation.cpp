@@ -17,6 +17,8 @@
 #include "TrackPoint.h"
 
 #include <Exceptions/ExceptionWrappers.h>
+#include <Generic/Profiling.h>
+#include <Generic/ValidationPolicy.h>
 
 #include <cmath>
 
@@ -33,6 +35,8 @@ namespace Herd::SSE
  */
 void StellarRotation::InitialiseAtZAMS( Herd::SSE::EvolutionState& io_rState )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_RotationInitialise );
+
   if( io_rState.m_TrackPoint.m_Age > 0. )
   {
     Herd::Exceptions::ThrowPreconditionError( "m_Age", "0", std::to_string( io_rState.m_TrackPoint.m_Age.Value() ).c_str() );
@@ -55,6 +59,8 @@ void StellarRotation::InitialiseAtZAMS( Herd::SSE::EvolutionState& io_rState )
  */
 void StellarRotation::InitialiseAtNSOrBH( Herd::SSE::EvolutionState& io_rState )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_RotationInitialise );
+
   Herd::SSE::ValidateEvolutionState( io_rState );
   if( ( io_rState.m_TrackPoint.m_Stage != Herd::SSE::EvolutionStage::e_BH ) && ( io_rState.m_TrackPoint.m_Stage != Herd::SSE::EvolutionStage::e_NS ) )
   {
@@ -74,7 +80,12 @@ void StellarRotation::InitialiseAtNSOrBH( Herd::SSE::EvolutionState& io_rState )
  */
 double StellarRotation::ComputeAngularMomentumLossRate( const Herd::SSE::EvolutionState& i_rState )
 {
-  Herd::SSE::ValidateEvolutionState( i_rState );
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_RotationLossRate );
+
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    Herd::SSE::ValidateEvolutionState( i_rState );
+  }
 
   double dJwind = ComputeStellarWindLoss( i_rState );
   double dJmb = ComputeMagneticBrakingLoss( i_rState.m_TrackPoint );
@@ -102,7 +113,12 @@ Herd::Generic::AngularVelocity StellarRotation::ComputeInitialAngularVelocity( c
  */
 Herd::Generic::AngularVelocity StellarRotation::ComputeAngularVelocity( const Herd::SSE::EvolutionState& i_rState )
 {
-  Herd::SSE::ValidateEvolutionState( i_rState );
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_RotationAngularVelocity );
+
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    Herd::SSE::ValidateEvolutionState( i_rState );
+  }
 
   double momentOfIntertia = ComputeMomentOfInertia( i_rState );
   double angularVelocity = i_rState.m_AngularMomentum / momentOfIntertia;
@@ -15,6 +15,8 @@
 #include "TrackPoint.h"
 
 #include <Exceptions/ExceptionWrappers.h>
+#include <Generic/Profiling.h>
+#include <Generic/ValidationPolicy.h>
 #include <SSE/Landmarks/Constants.h>
 
 #include <algorithm>
@@ -36,6 +38,8 @@ namespace Herd::SSE
  */
 double StellarWindMassLoss::Compute( const Herd::SSE::TrackPoint& i_rTrackPoint, double i_Eta, double i_HeWind, double i_BinaryWind, double i_RocheLobe )
 {
+  [[maybe_unused]] Herd::Generic::ProfilingScope scope( Herd::Generic::ProfiledFunction::e_StellarWind );
+
   Validate( i_rTrackPoint, i_Eta, i_HeWind, i_BinaryWind, i_RocheLobe );
 
   // MS and remnant loss
@@ -69,10 +73,14 @@ double StellarWindMassLoss::Compute( const Herd::SSE::TrackPoint& i_rTrackPoint,
  * @param i_BinaryWind Mass loss factor for binary stars
  * @param i_RocheLobe Roche lobe factor for binary stars
  * @throws PreconditionError if preconditions violated
+ * @remarks The track point is validated only if Herd::Generic::InnerValidation is enabled
  */
 void StellarWindMassLoss::Validate( const Herd::SSE::TrackPoint& i_rTrackPoint, double i_Eta, double i_HeWind, double i_BinaryWind, double i_RocheLobe )
 {
-  Herd::SSE::ValidateTrackPoint( i_rTrackPoint );
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    Herd::SSE::ValidateTrackPoint( i_rTrackPoint );
+  }
 
   Herd::Exceptions::ThrowPreconditionErrorIfNegative( i_Eta, "i_Eta" ); // @suppress("Invalid arguments")
   Herd::Exceptions::ThrowPreconditionErrorIfNegative( i_BinaryWind, "i_BinaryWind" ); // @suppress("Invalid arguments")
@@ -0,0 +1,95 @@
+/**
+ * @file TimestepStatistics.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "TimestepStatistics.h"
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_Limit Constraint
+ * @return A reference to the count for \c i_Limit
+ * @pre \c i_Limit is not \c e_Count
+ */
+uint64_t& StageTimestepStatistics::LimitedBy( Herd::SSE::StepLimit i_Limit )
+{
+  return m_LimitedBy[ static_cast< std::size_t >( i_Limit ) ];
+}
+
+/**
+ * @param i_Limit Constraint
+ * @return Count for \c i_Limit
+ * @pre \c i_Limit is not \c e_Count
+ */
+uint64_t StageTimestepStatistics::LimitedBy( Herd::SSE::StepLimit i_Limit ) const
+{
+  return m_LimitedBy[ static_cast< std::size_t >( i_Limit ) ];
+}
+
+/**
+ * @param i_rOther Counts to be added
+ * @return A reference to this object
+ */
+StageTimestepStatistics& StageTimestepStatistics::operator+=( const StageTimestepStatistics& i_rOther )
+{
+  m_AcceptedSteps += i_rOther.m_AcceptedSteps;
+  m_RejectedTrials += i_rOther.m_RejectedTrials;
+  m_PhaseEvaluations += i_rOther.m_PhaseEvaluations;
+
+  for( std::size_t index = 0; index < m_LimitedBy.size(); ++index )
+  {
+    m_LimitedBy[ index ] += i_rOther.m_LimitedBy[ index ];
+  }
+
+  return *this;
+}
+
+/**
+ * @param i_Stage Evolution stage
+ * @return A reference to the counts for \c i_Stage
+ * @pre \c i_Stage is not \c e_Undefined
+ */
+StageTimestepStatistics& TimestepStatistics::operator[]( Herd::SSE::EvolutionStage i_Stage )
+{
+  return m_Stages[ static_cast< std::size_t >( i_Stage ) ];
+}
+
+/**
+ * @param i_Stage Evolution stage
+ * @return A constant reference to the counts for \c i_Stage
+ * @pre \c i_Stage is not \c e_Undefined
+ */
+const StageTimestepStatistics& TimestepStatistics::operator[]( Herd::SSE::EvolutionStage i_Stage ) const
+{
+  return m_Stages[ static_cast< std::size_t >( i_Stage ) ];
+}
+
+/**
+ * @return Counts over all stages
+ */
+StageTimestepStatistics TimestepStatistics::Total() const
+{
+  StageTimestepStatistics output;
+  for( const auto& rStage : m_Stages )
+  {
+    output += rStage;
+  }
+
+  return output;
+}
+
+void TimestepStatistics::Reset()
+{
+  m_Stages.fill( StageTimestepStatistics() );
+}
+
+}
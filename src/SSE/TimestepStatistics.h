@@ -0,0 +1,79 @@
+/**
+ * @file TimestepStatistics.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H3E91B6D4_7C20_4A5F_8E13_5B9F02D6C7A8
+#define H3E91B6D4_7C20_4A5F_8E13_5B9F02D6C7A8
+
+#include "EvolutionStage.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Constraint that determines the size of a timestep
+ * @remarks Each constraint can only shorten the step. The last one that does is recorded
+ */
+enum class StepLimit
+{
+  e_StageFraction,  // Fraction of the duration of the stage, as proposed by the step controller
+  e_Radius, // 10% radius change
+  e_EndOfPhase, // End of the current phase
+  e_EnvelopeMass, // Mass loss cannot exceed the envelope mass
+  e_MassChange, // 1% mass change
+  e_MinimumStep,  // Minimum step size, relative to the age
+  e_EndOfEvolution, // Requested end of the evolution
+  e_Count // Number of constraints
+};
+
+/**
+ * @brief Timestep counts for a stage
+ */
+struct StageTimestepStatistics
+{
+  uint64_t m_AcceptedSteps = 0; ///< Number of accepted steps
+  uint64_t m_RejectedTrials = 0;  ///< Number of trial steps rejected for exceeding the radius change limit
+  uint64_t m_PhaseEvaluations = 0; ///< Number of calls to the phase, including the trial steps
+  std::array< uint64_t, static_cast< std::size_t >( Herd::SSE::StepLimit::e_Count ) > m_LimitedBy { }; ///< Number of accepted steps limited by each constraint, indexed by StepLimit
+
+  uint64_t& LimitedBy( Herd::SSE::StepLimit i_Limit ); ///< Element access to StageTimestepStatistics::m_LimitedBy
+  uint64_t LimitedBy( Herd::SSE::StepLimit i_Limit ) const; ///< Element access to StageTimestepStatistics::m_LimitedBy
+
+  StageTimestepStatistics& operator+=( const StageTimestepStatistics& i_rOther ); ///< Accumulates the counts of another stage
+};
+
+/**
+ * @brief Timestep counts of a star, for each stage
+ * @remarks Identifies the stars for which the timestep control is expensive, and the constraint responsible
+ */
+class TimestepStatistics
+{
+public:
+
+  Herd::SSE::StageTimestepStatistics& operator[]( Herd::SSE::EvolutionStage i_Stage ); ///< Element access
+  const Herd::SSE::StageTimestepStatistics& operator[]( Herd::SSE::EvolutionStage i_Stage ) const; ///< Element access
+
+  Herd::SSE::StageTimestepStatistics Total() const; ///< Returns the counts summed over the stages
+
+  void Reset(); ///< Sets all counts to zero
+
+private:
+
+  std::array< Herd::SSE::StageTimestepStatistics, static_cast< std::size_t >( Herd::SSE::EvolutionStage::e_Undefined ) > m_Stages; ///< Counts, indexed by EvolutionStage
+};
+
+}
+
+#endif /* H3E91B6D4_7C20_4A5F_8E13_5B9F02D6C7A8 */
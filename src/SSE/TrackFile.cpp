@@ -0,0 +1,365 @@
+/**
+ * @file TrackFile.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#include "TrackFile.h"
+
+#include <Exceptions/ExceptionWrappers.h>
+
+#include <bit>
+#include <cstring>
+#include <fstream>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace
+{
+constexpr std::array< char, 8 > s_Magic { 'H', 'E', 'R', 'D', 'T', 'R', 'C', 'K' }; ///< Identifies a track file
+constexpr uint32_t s_Version = 1; ///< Format version. Increment when the layout changes
+constexpr uint32_t s_ByteOrderMark = 0x01020304; ///< Reads differently on a platform with a different byte order
+constexpr std::size_t s_Alignment = alignof(double); ///< Alignment of the blocks, so that the columns can be accessed in place
+
+constexpr std::size_t s_ColumnCount = static_cast< std::size_t >( Herd::SSE::TrackPointField::e_Count ); ///< Number of numerical columns
+constexpr std::size_t s_BlockCount = s_ColumnCount + 1;  ///< Numerical columns and the stages
+
+/**
+ * @brief Fixed header at the beginning of a track file
+ */
+struct FileHeader
+{
+  std::array< char, 8 > m_Magic; ///< s_Magic
+  uint32_t m_Version; ///< s_Version
+  uint32_t m_ByteOrderMark; ///< s_ByteOrderMark
+  uint64_t m_Length; ///< Number of track points
+  double m_InitialMass; ///< Initial mass
+  double m_Metallicity; ///< Metallicity
+  uint64_t m_ParametersHash; ///< Hash of the evolution parameters
+  uint32_t m_Compression; ///< Compression of the numerical columns
+  uint32_t m_BlockCount;  ///< Number of blocks
+};
+
+static_assert( sizeof(FileHeader) == 56, "Padding in the file header" );
+
+/**
+ * @brief Location of a block in a track file, following the header
+ */
+struct BlockEntry
+{
+  uint64_t m_Offset;  ///< Offset from the beginning of the file
+  uint64_t m_Size;  ///< Size in bytes
+};
+
+/**
+ * @brief Appends the object representation of a value
+ * @param i_rValue Value
+ * @param io_rBuffer Buffer
+ */
+template< class T >
+void Append( const T& i_rValue, std::vector< char >& io_rBuffer )
+{
+  const char* pBegin = reinterpret_cast< const char* >( &i_rValue );
+  io_rBuffer.insert( io_rBuffer.end(), pBegin, pBegin + sizeof(T) );
+}
+
+/**
+ * @brief Compresses a column
+ * @param i_Column Values
+ * @return Compressed column
+ * @remarks For each value, a control byte holds the number of zero bytes at both ends of the XOR with the previous value, and the bytes in between follow. Consecutive values of a track share the sign, the exponent and the leading digits of the mantissa, and constant columns cost one byte per value
+ */
+std::vector< char > EncodeXORDelta( std::span< const double > i_Column )
+{
+  std::vector< char > encoded;
+  encoded.reserve( i_Column.size() * 4 );
+
+  uint64_t previous = 0;
+  for( double value : i_Column )
+  {
+    uint64_t bits = std::bit_cast< uint64_t >( value );
+    uint64_t delta = bits ^ previous;
+    previous = bits;
+
+    unsigned int leading = std::countl_zero( delta ) / 8;
+    unsigned int trailing = delta == 0 ? 0 : std::countr_zero( delta ) / 8;
+    encoded.push_back( static_cast< char >( ( leading << 4 ) | trailing ) );
+
+    for( unsigned int index = trailing; index < 8 - leading; ++index )
+    {
+      encoded.push_back( static_cast< char >( ( delta >> ( 8 * index ) ) & 0xFF ) );
+    }
+  }
+
+  return encoded;
+}
+
+/**
+ * @brief Decompresses a column
+ * @param i_Encoded Compressed column
+ * @param i_Length Number of values
+ * @return Values
+ * @throws RuntimeError If \c i_Encoded is malformed
+ */
+std::vector< double > DecodeXORDelta( std::span< const char > i_Encoded, std::size_t i_Length )
+{
+  std::vector< double > decoded;
+  decoded.reserve( i_Length );
+
+  uint64_t previous = 0;
+  std::size_t position = 0;
+  for( std::size_t count = 0; count < i_Length; ++count )
+  {
+    if( position >= i_Encoded.size() )
+    {
+      [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Truncated column in the track file" );
+    }
+
+    auto control = static_cast< unsigned char >( i_Encoded[ position++ ] );
+    unsigned int leading = control >> 4;
+    unsigned int trailing = control & 0x0F;
+    if( leading + trailing > 8 || position + ( 8 - leading - trailing ) > i_Encoded.size() )
+    {
+      [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Malformed column in the track file" );
+    }
+
+    uint64_t delta = 0;
+    for( unsigned int index = trailing; index < 8 - leading; ++index )
+    {
+      delta |= static_cast< uint64_t >( static_cast< unsigned char >( i_Encoded[ position++ ] ) ) << ( 8 * index );
+    }
+
+    previous ^= delta;
+    decoded.push_back( std::bit_cast< double >( previous ) );
+  }
+
+  return decoded;
+}
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @param i_rPath Path to the file. Overwritten if it exists
+ * @param i_rTrajectory Trajectory
+ * @param i_rHeader Description of the trajectory
+ * @throws RuntimeError If the file cannot be written
+ * @remarks The file consists of a fixed header, a table of blocks, and one block per column. Numerical columns precede the stages
+ */
+void WriteTrackFile( const std::filesystem::path& i_rPath, const Herd::SSE::ColumnarTrajectory& i_rTrajectory, const Herd::SSE::TrackFileHeader& i_rHeader )
+{
+  // Blocks
+  std::array< std::vector< char >, s_BlockCount > blocks;
+  for( std::size_t index = 0; index < s_ColumnCount; ++index )
+  {
+    auto column = i_rTrajectory.Column( static_cast< Herd::SSE::TrackPointField >( index ) );
+    if( i_rHeader.m_Compression == Herd::SSE::TrackCompression::e_XORDelta )
+    {
+      blocks[ index ] = EncodeXORDelta( column );
+    } else
+    {
+      auto bytes = std::as_bytes( column );
+      blocks[ index ].resize( bytes.size() );
+      std::memcpy( blocks[ index ].data(), bytes.data(), bytes.size() );
+    }
+  }
+
+  auto stages = std::as_bytes( i_rTrajectory.Stages() );
+  blocks.back().resize( stages.size() );
+  std::memcpy( blocks.back().data(), stages.data(), stages.size() );
+
+  // Header and the table of blocks
+  FileHeader header { s_Magic, s_Version, s_ByteOrderMark, i_rTrajectory.size(), i_rHeader.m_InitialMass, i_rHeader.m_Metallicity, i_rHeader.m_ParametersHash,
+      static_cast< uint32_t >( i_rHeader.m_Compression ), s_BlockCount };
+
+  std::vector< char > buffer;
+  Append( header, buffer );
+
+  uint64_t offset = sizeof(FileHeader) + s_BlockCount * sizeof(BlockEntry);
+  for( const auto& rBlock : blocks )
+  {
+    offset = ( offset + s_Alignment - 1 ) / s_Alignment * s_Alignment;
+    Append( BlockEntry { offset, rBlock.size() }, buffer );
+    offset += rBlock.size();
+  }
+
+  for( const auto& rBlock : blocks )
+  {
+    buffer.resize( ( buffer.size() + s_Alignment - 1 ) / s_Alignment * s_Alignment, 0 );
+    buffer.insert( buffer.end(), rBlock.begin(), rBlock.end() );
+  }
+
+  std::ofstream file( i_rPath, std::ios::binary | std::ios::trunc );
+  file.write( buffer.data(), buffer.size() );
+  file.close();
+  if( !file )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Cannot write the track file" );
+  }
+}
+
+/**
+ * @param i_rPath Path to the file. Overwritten if it exists
+ * @param i_rSimulator Simulator
+ * @param i_rParameters %Parameters of the most recent evolution
+ * @param i_Compression Compression of the numerical columns
+ * @pre \c i_rSimulator has evolved a star
+ * @throws PreconditionError If the precondition is violated
+ * @throws RuntimeError If the file cannot be written
+ */
+void WriteTrackFile( const std::filesystem::path& i_rPath, const Herd::SSE::SingleStarEvolutuion& i_rSimulator,
+    const Herd::SSE::SingleStarEvolutuion::Parameters& i_rParameters, Herd::SSE::TrackCompression i_Compression )
+{
+  Herd::SSE::Checkpoint checkpoint = i_rSimulator.MakeCheckpoint();
+  Herd::SSE::TrackFileHeader header { checkpoint.m_InitialMass, checkpoint.m_State.m_TrackPoint.m_InitialMetallicity, i_rParameters.Hash(), i_Compression };
+  WriteTrackFile( i_rPath, i_rSimulator.Trajectory(), header );
+}
+
+/**
+ * @param i_rPath Path to the file
+ * @throws RuntimeError If the file cannot be read, or is not a valid track file
+ */
+TrackFileReader::TrackFileReader( const std::filesystem::path& i_rPath )
+{
+  std::error_code error;
+  std::uintmax_t fileSize = std::filesystem::file_size( i_rPath, error );
+  if( error || fileSize < sizeof(FileHeader) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Not a track file" );
+  }
+
+  try
+  {
+    boost::interprocess::file_mapping file( i_rPath.c_str(), boost::interprocess::read_only );
+    m_pRegion = std::make_unique< boost::interprocess::mapped_region >( file, boost::interprocess::read_only );
+  } catch( const boost::interprocess::interprocess_exception& )
+  {
+    Herd::Exceptions::ThrowRuntimeError( "Cannot map the track file" );
+  }
+
+  std::span< const char > bytes( static_cast< const char* >( m_pRegion->get_address() ), m_pRegion->get_size() );
+
+  // Header
+  FileHeader header;
+  std::memcpy( &header, bytes.data(), sizeof(FileHeader) );
+  if( header.m_Magic != s_Magic )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Not a track file" );
+  }
+
+  if( header.m_Version != s_Version || header.m_ByteOrderMark != s_ByteOrderMark || header.m_BlockCount != s_BlockCount
+      || header.m_Compression > static_cast< uint32_t >( Herd::SSE::TrackCompression::e_XORDelta ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Unsupported track file" );
+  }
+
+  if( header.m_Length > bytes.size() )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Truncated track file" );
+  }
+
+  m_Size = header.m_Length;
+  m_Header.m_InitialMass.Set( header.m_InitialMass );
+  m_Header.m_Metallicity.Set( header.m_Metallicity );
+  m_Header.m_ParametersHash = header.m_ParametersHash;
+  m_Header.m_Compression = static_cast< Herd::SSE::TrackCompression >( header.m_Compression );
+
+  if( bytes.size() < sizeof(FileHeader) + s_BlockCount * sizeof(BlockEntry) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Truncated track file" );
+  }
+
+  std::array< BlockEntry, s_BlockCount > blocks;
+  std::memcpy( blocks.data(), bytes.data() + sizeof(FileHeader), sizeof(blocks) );
+  auto GetBlock = [ & ]( const BlockEntry& i_rEntry, std::size_t i_ExpectedSize )
+  {
+    if( i_rEntry.m_Offset % s_Alignment != 0 || i_rEntry.m_Offset > bytes.size() || i_rEntry.m_Size > bytes.size() - i_rEntry.m_Offset
+        || ( i_ExpectedSize != 0 && i_rEntry.m_Size != i_ExpectedSize ) )
+    {
+      [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Malformed block in the track file" );
+    }
+
+    return bytes.subspan( i_rEntry.m_Offset, i_rEntry.m_Size );
+  };
+
+  // Columns
+  bool isCompressed = m_Header.m_Compression == Herd::SSE::TrackCompression::e_XORDelta;
+  for( std::size_t index = 0; index < s_ColumnCount; ++index )
+  {
+    if( isCompressed )
+    {
+      m_Decoded[ index ] = DecodeXORDelta( GetBlock( blocks[ index ], 0 ), m_Size );
+      m_Columns[ index ] = m_Decoded[ index ];
+    } else
+    {
+      auto block = GetBlock( blocks[ index ], m_Size * sizeof(double) );
+      m_Columns[ index ] = std::span( reinterpret_cast< const double* >( block.data() ), m_Size );
+    }
+  }
+
+  auto stageBlock = GetBlock( blocks.back(), m_Size * sizeof(Herd::SSE::EvolutionStage) );
+  m_Stages = std::span( reinterpret_cast< const Herd::SSE::EvolutionStage* >( stageBlock.data() ), m_Size );
+  for( auto stage : m_Stages )
+  {
+    if( stage < Herd::SSE::EvolutionStage::e_MSLM || stage > Herd::SSE::EvolutionStage::e_Undefined )
+    {
+      [[unlikely]] Herd::Exceptions::ThrowRuntimeError( "Invalid stage in the track file" );
+    }
+  }
+}
+
+/**
+ * @remarks Destructor is needed to be able to use forward declarations in with std::unique_ptr
+ */
+TrackFileReader::~TrackFileReader() = default;
+
+/**
+ * @return A constant reference to TrackFileReader::m_Header
+ */
+const Herd::SSE::TrackFileHeader& TrackFileReader::Header() const
+{
+  return m_Header;
+}
+
+/**
+ * @return Number of track points
+ */
+std::size_t TrackFileReader::size() const
+{
+  return m_Size;
+}
+
+/**
+ * @param i_Field Field
+ * @return Values of \c i_Field, in the order of the track points
+ * @pre \c i_Field is not \c e_Count
+ * @throws PreconditionError If the precondition is violated
+ */
+std::span< const double > TrackFileReader::Column( Herd::SSE::TrackPointField i_Field ) const
+{
+  if( i_Field == Herd::SSE::TrackPointField::e_Count )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Field", "A track point field", "e_Count" );
+  }
+
+  return m_Columns[ static_cast< std::size_t >( i_Field ) ];
+}
+
+/**
+ * @return Evolution stages, in the order of the track points
+ */
+std::span< const Herd::SSE::EvolutionStage > TrackFileReader::Stages() const
+{
+  return m_Stages;
+}
+
+}
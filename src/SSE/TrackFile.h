@@ -0,0 +1,96 @@
+/**
+ * @file TrackFile.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef H3CA2F7BC_41A1_4137_A04E_B76AF7339A4D
+#define H3CA2F7BC_41A1_4137_A04E_B76AF7339A4D
+
+#include "ColumnarTrajectory.h"
+#include "EvolutionStage.h"
+#include "SingleStarEvolution.h"
+
+#include <Generic/Quantity.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+// Forward declarations
+namespace boost::interprocess
+{
+class mapped_region;
+}
+
+namespace Herd::SSE
+{
+
+/**
+ * @brief Compression of the numerical columns in a track file
+ */
+enum class TrackCompression
+{
+  e_None, // Raw values. Read without copying
+  e_XORDelta  // Each value is XORed with its predecessor, and only the non-zero bytes are stored. Lossless. Decoded when the file is opened
+};
+
+/**
+ * @brief Description of the track in a track file
+ */
+struct TrackFileHeader
+{
+  Herd::Generic::Mass m_InitialMass; ///< Initial mass
+  Herd::Generic::Metallicity m_Metallicity; ///< Metallicity
+  uint64_t m_ParametersHash = 0; ///< SingleStarEvolutuion::Parameters::Hash of the evolution parameters
+  Herd::SSE::TrackCompression m_Compression = Herd::SSE::TrackCompression::e_None; ///< Compression of the numerical columns
+};
+
+void WriteTrackFile( const std::filesystem::path& i_rPath, const Herd::SSE::ColumnarTrajectory& i_rTrajectory, const Herd::SSE::TrackFileHeader& i_rHeader ); ///< Writes a trajectory to a track file
+void WriteTrackFile( const std::filesystem::path& i_rPath, const Herd::SSE::SingleStarEvolutuion& i_rSimulator,
+    const Herd::SSE::SingleStarEvolutuion::Parameters& i_rParameters, Herd::SSE::TrackCompression i_Compression ); ///< Writes the trajectory of the most recent evolution to a track file
+
+/**
+ * @brief Reads a track file via a memory map
+ * @remarks Columns are spans into the mapped file, unless they are compressed. The spans are valid for the lifetime of the reader
+ * @remarks Values are stored in their native representation. A file written on a platform with a different byte order is rejected
+ */
+class TrackFileReader
+{
+public:
+
+  explicit TrackFileReader( const std::filesystem::path& i_rPath ); ///< Constructor
+  ~TrackFileReader(); ///< Destructor
+
+  const Herd::SSE::TrackFileHeader& Header() const; ///< Accessor for TrackFileReader::m_Header
+  std::size_t size() const; ///< Number of track points
+
+  std::span< const double > Column( Herd::SSE::TrackPointField i_Field ) const; ///< Values of a field for all track points
+  std::span< const Herd::SSE::EvolutionStage > Stages() const; ///< Evolution stages for all track points
+
+private:
+
+  static constexpr std::size_t s_ColumnCount = static_cast< std::size_t >( Herd::SSE::TrackPointField::e_Count ); ///< Number of numerical columns
+
+  std::unique_ptr< boost::interprocess::mapped_region > m_pRegion; ///< Mapped file
+
+  Herd::SSE::TrackFileHeader m_Header; ///< Header
+  std::size_t m_Size = 0; ///< Number of track points
+
+  std::array< std::span< const double >, s_ColumnCount > m_Columns; ///< Numerical columns, in the mapped file or in TrackFileReader::m_Decoded
+  std::array< std::vector< double >, s_ColumnCount > m_Decoded; ///< Decoded numerical columns, for compressed files
+  std::span< const Herd::SSE::EvolutionStage > m_Stages; ///< Evolution stages, in the mapped file
+};
+}
+
+#endif /* H3CA2F7BC_41A1_4137_A04E_B76AF7339A4D */
@@ -53,5 +53,45 @@ void ValidateTrackPoint( const TrackPoint& i_rTrackPoint )
 
 }
 
+/**
+ * @param i_rFrom Earlier track point
+ * @param i_rTo Later track point
+ * @param i_Age Age of the interpolated track point
+ * @return Track point at \c i_Age
+ * @pre \c i_Age is within [i_rFrom.m_Age, i_rTo.m_Age]
+ * @throws PreconditionError If the precondition is violated
+ * @remarks Numerical members are interpolated linearly in age. The stage is that of \c i_rFrom, unless \c i_Age is the age of \c i_rTo
+ */
+TrackPoint InterpolateTrackPoints( const TrackPoint& i_rFrom, const TrackPoint& i_rTo, Herd::Generic::Time i_Age )
+{
+  if( !( i_Age >= i_rFrom.m_Age && i_Age <= i_rTo.m_Age ) )
+  {
+    [[unlikely]] Herd::Exceptions::ThrowPreconditionError( "i_Age", "Within [i_rFrom.m_Age, i_rTo.m_Age]", i_Age.Value() );
+  }
+
+  if( i_Age == i_rTo.m_Age )
+  {
+    return i_rTo;
+  }
+
+  double weight = ( i_Age - i_rFrom.m_Age ) / ( i_rTo.m_Age - i_rFrom.m_Age );
+  auto Interpolate = [ weight ]< class TQuantity >( TQuantity i_From, TQuantity i_To )
+  {
+    return TQuantity( i_From.Value() + weight * ( i_To.Value() - i_From.Value() ) );
+  };
+
+  TrackPoint interpolated = i_rFrom;
+  interpolated.m_Mass = Interpolate( i_rFrom.m_Mass, i_rTo.m_Mass );
+  interpolated.m_InitialMetallicity = Interpolate( i_rFrom.m_InitialMetallicity, i_rTo.m_InitialMetallicity );
+  interpolated.m_Radius = Interpolate( i_rFrom.m_Radius, i_rTo.m_Radius );
+  interpolated.m_Luminosity = Interpolate( i_rFrom.m_Luminosity, i_rTo.m_Luminosity );
+  interpolated.m_Temperature = Interpolate( i_rFrom.m_Temperature, i_rTo.m_Temperature );
+  interpolated.m_Age = i_Age;
+  interpolated.m_CoreMass = Interpolate( i_rFrom.m_CoreMass, i_rTo.m_CoreMass );
+  interpolated.m_EnvelopeMass = Interpolate( i_rFrom.m_EnvelopeMass, i_rTo.m_EnvelopeMass );
+  interpolated.m_AngularVelocity = Interpolate( i_rFrom.m_AngularVelocity, i_rTo.m_AngularVelocity );
+
+  return interpolated;
 }
 
+}
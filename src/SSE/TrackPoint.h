@@ -38,6 +38,7 @@ struct TrackPoint
 };
 
 void ValidateTrackPoint( const TrackPoint& i_rTrackPoint ); ///< Validates a track point
+TrackPoint InterpolateTrackPoints( const TrackPoint& i_rFrom, const TrackPoint& i_rTo, Herd::Generic::Time i_Age ); ///< Interpolates between two track points
 }
 
 #endif /* H8AB9F35C_A33A_4D5D_8F9A_CB81639D74B5 */
@@ -0,0 +1,244 @@
+/**
+ * @file BufferedFileSinkUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/BufferedFileSink.h>
+#include <SSE/ColumnarTrajectory.h>
+#include <SSE/ITrajectorySink.h>
+#include <SSE/PopulationEvolution.h>
+#include <SSE/SingleStarEvolution.h>
+#include <SSE/TrackPoint.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Exceptions/RuntimeError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+/**
+ * @brief Fixture with temporary files
+ */
+class BufferedFileSinkTestFixture : public Herd::UnitTestUtils::RandomTestFixture
+{
+public:
+
+  ~BufferedFileSinkTestFixture()
+  {
+    for( const auto& rPath : m_Paths )
+    {
+      std::error_code error;
+      std::filesystem::remove( rPath, error );
+    }
+  }
+
+  /**
+   * @brief Makes the path of a temporary file, to be removed with the fixture
+   * @return Path
+   */
+  std::filesystem::path MakePath()
+  {
+    m_Paths.push_back(
+        std::filesystem::temp_directory_path() / ( "HerdSink" + std::to_string( Seed() ) + "_" + std::to_string( Rng()() ) + "_" + std::to_string( m_Paths.size() )
+            + ".trj" ) );
+    return m_Paths.back();
+  }
+
+  /**
+   * @brief Checks whether two trajectories are identical
+   * @param i_rActual Actual
+   * @param i_rExpected Expected
+   */
+  static void TestEqual( const Herd::SSE::ColumnarTrajectory& i_rActual, const Herd::SSE::ColumnarTrajectory& i_rExpected )
+  {
+    BOOST_TEST_REQUIRE( i_rActual.size() == i_rExpected.size() ); // @suppress("Invalid arguments")
+    for( std::size_t field = 0; field < static_cast< std::size_t >( Herd::SSE::TrackPointField::e_Count ); ++field )
+    {
+      auto column = static_cast< Herd::SSE::TrackPointField >( field );
+      BOOST_TEST( ranges::cpp20::equal( i_rActual.Column( column ), i_rExpected.Column( column ) ) ); // @suppress("Invalid arguments")
+    }
+
+    BOOST_TEST( ranges::cpp20::equal( i_rActual.Stages(), i_rExpected.Stages() ) ); // @suppress("Invalid arguments")
+  }
+
+  std::vector< std::filesystem::path > m_Paths; ///< Temporary files
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE( BufferedFileSinkUnitTests, BufferedFileSinkTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  BOOST_CHECK_THROW( Herd::SSE::BufferedFileSink( MakePath(), 0 ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::SSE::BufferedFileSink { MakePath() / "NoSuchDirectory" / "File.trj" }, Herd::Exceptions::RuntimeError );
+
+  std::filesystem::path path = MakePath();
+  Herd::SSE::BufferedFileSink sink( path );
+  sink.Close();
+  BOOST_CHECK_NO_THROW( sink.Close() );
+  BOOST_CHECK_THROW( sink.Begin( 0 ), Herd::Exceptions::PreconditionError );
+
+  auto Ignore = []( std::size_t, const Herd::SSE::ColumnarTrajectory& )
+  {
+  };
+
+  BOOST_CHECK_THROW( Herd::SSE::BufferedFileSink::Read( MakePath(), Ignore ), Herd::Exceptions::RuntimeError );
+
+  {
+    std::ofstream file( path, std::ios::binary );
+    file << std::string( 100, 'x' );
+  }
+  BOOST_CHECK_THROW( Herd::SSE::BufferedFileSink::Read( path, Ignore ), Herd::Exceptions::RuntimeError );
+}
+
+// A sink should receive exactly the trajectory that would be stored otherwise
+BOOST_AUTO_TEST_CASE( ExternalSinkTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Mass mass( GenerateNumber( 0.5, 50. ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity z( GenerateMetallicity() );
+  Herd::Generic::Time until( GenerateNumber( 0., 13800. ) ); // @suppress("Invalid arguments")
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  Herd::SSE::SingleStarEvolutuion reference;
+  reference.Evolve( mass, z, until, parameters );
+
+  Herd::SSE::ColumnarTrajectory sink;
+  Herd::SSE::SingleStarEvolutuion simulator;
+  simulator.SetTrajectorySink( &sink );
+  simulator.Evolve( mass, z, until, parameters );
+
+  BOOST_TEST( simulator.Trajectory().empty() ); // @suppress("Invalid arguments")
+  TestEqual( sink, reference.Trajectory() );
+
+  simulator.SetTrajectorySink( nullptr );
+  simulator.Evolve( mass, z, until, parameters );
+  TestEqual( simulator.Trajectory(), reference.Trajectory() );
+}
+
+BOOST_AUTO_TEST_CASE( RoundTripTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  std::filesystem::path path = MakePath();
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  // A small queue, to exercise the blocking producer
+  std::size_t trackCount = GenerateNumber( 2u, 5u ); // @suppress("Invalid arguments")
+  std::vector< Herd::SSE::ColumnarTrajectory > expected( trackCount );
+  {
+    Herd::SSE::BufferedFileSink sink( path, GenerateNumber( 1u, 8u ) ); // @suppress("Invalid arguments")
+    Herd::SSE::SingleStarEvolutuion simulator;
+    for( std::size_t index = 0; index < trackCount; ++index )
+    {
+      Herd::Generic::Mass mass( GenerateNumber( 0.5, 50. ) ); // @suppress("Invalid arguments")
+      Herd::Generic::Metallicity z( GenerateMetallicity() );
+      Herd::Generic::Time until( 13800. );
+
+      simulator.SetTrajectorySink( nullptr );
+      simulator.Evolve( mass, z, until, parameters );
+      expected[ index ] = simulator.Trajectory();
+
+      sink.Begin( index );
+      simulator.SetTrajectorySink( &sink );
+      simulator.Evolve( mass, z, until, parameters );
+      sink.End();
+    }
+  }
+
+  std::size_t readCount = 0;
+  Herd::SSE::BufferedFileSink::Read( path, [ & ]( std::size_t i_TrackIndex, const Herd::SSE::ColumnarTrajectory& i_rTrajectory )
+  {
+    BOOST_TEST_REQUIRE( i_TrackIndex == readCount ); // @suppress("Invalid arguments")
+    TestEqual( i_rTrajectory, expected[ i_TrackIndex ] );
+    ++readCount;
+  } );
+
+  BOOST_TEST( readCount == trackCount ); // @suppress("Invalid arguments")
+}
+
+// Per-thread sinks should receive each star once, and the final states should not change
+BOOST_AUTO_TEST_CASE( PopulationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  const auto& rMassRange = Herd::SSE::SingleStarEvolutuionSpecs::s_EvolvableMassRange;
+
+  constexpr std::size_t populationSize = 12;
+  std::vector< Herd::SSE::PopulationEvolution::InitialConditions > population( populationSize );
+  for( auto& rStar : population )
+  {
+    rStar.m_Mass.Set( GenerateNumber( rMassRange.Lower(), rMassRange.Upper() ) ); // @suppress("Invalid arguments")
+    rStar.m_Z.Set( GenerateMetallicity() );
+    rStar.m_EvolveUntil.Set( GenerateNumber( 0., 13800. ) ); // @suppress("Invalid arguments")
+  }
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+  Herd::SSE::PopulationEvolution simulator( GenerateNumber( 1u, 4u ) ); // @suppress("Invalid arguments")
+
+  std::vector< Herd::SSE::TrackPoint > expected( populationSize );
+  simulator.Evolve( population, parameters, expected );
+
+  std::vector< std::unique_ptr< Herd::SSE::BufferedFileSink > > sinks;
+  std::vector< Herd::SSE::ITrajectorySink* > sinkPointers;
+  for( unsigned int index = 0; index < simulator.ThreadCount(); ++index )
+  {
+    sinks.push_back( std::make_unique< Herd::SSE::BufferedFileSink >( MakePath() ) );
+    sinkPointers.push_back( sinks.back().get() );
+  }
+
+  std::vector< Herd::SSE::TrackPoint > finalStates( populationSize );
+  BOOST_CHECK_THROW( simulator.Evolve( population, parameters, finalStates, std::span( sinkPointers ).first( sinkPointers.size() - 1 ) ),
+      Herd::Exceptions::PreconditionError );
+
+  simulator.Evolve( population, parameters, finalStates, sinkPointers );
+  for( auto& rpSink : sinks )
+  {
+    rpSink->Close();
+  }
+
+  std::vector< std::size_t > counts( populationSize, 0 );
+  for( std::size_t index = 0; index < sinks.size(); ++index )
+  {
+    Herd::SSE::BufferedFileSink::Read( m_Paths[ index ], [ & ]( std::size_t i_TrackIndex, const Herd::SSE::ColumnarTrajectory& i_rTrajectory )
+    {
+      BOOST_TEST_REQUIRE( i_TrackIndex < populationSize ); // @suppress("Invalid arguments")
+      BOOST_TEST_REQUIRE( !i_rTrajectory.empty() ); // @suppress("Invalid arguments")
+      BOOST_TEST( i_rTrajectory.back().m_Age.Value() == finalStates[ i_TrackIndex ].m_Age.Value() ); // @suppress("Invalid arguments")
+      ++counts[ i_TrackIndex ];
+    } );
+  }
+
+  BOOST_TEST( ranges::cpp20::all_of( counts, []( std::size_t i_Count ) { return i_Count == 1; } ) ); // @suppress("Invalid arguments")
+
+  for( std::size_t idx = 0; idx < populationSize; ++idx )
+  {
+    BOOST_TEST_CONTEXT( "Star index " << idx )
+    {
+      BOOST_TEST( finalStates[ idx ].m_Age.Value() == expected[ idx ].m_Age.Value() );
+      BOOST_TEST( finalStates[ idx ].m_Mass.Value() == expected[ idx ].m_Mass.Value() );
+      BOOST_TEST( finalStates[ idx ].m_Radius.Value() == expected[ idx ].m_Radius.Value() );
+      BOOST_TEST( finalStates[ idx ].m_Luminosity.Value() == expected[ idx ].m_Luminosity.Value() );
+      BOOST_TEST( finalStates[ idx ].m_AngularVelocity.Value() == expected[ idx ].m_AngularVelocity.Value() );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+/**
+ * @file CheckpointUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "SSETestUtils.h"
+
+#include <SSE/Checkpoint.h>
+#include <SSE/EvolutionState.h>
+
+#include <Exceptions/RuntimeError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <sstream>
+#include <string>
+
+BOOST_FIXTURE_TEST_SUITE( CheckpointUnitTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( RoundTripTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::Checkpoint checkpoint;
+  checkpoint.m_State = Herd::SSE::UnitTests::GenerateRandomEvolutionState( Rng() );
+  checkpoint.m_InitialMass.Set( GenerateNumber( 0.1, 100. ) ); // @suppress("Invalid arguments")
+  checkpoint.m_MainSequenceEvaluatedAt.Set( GenerateNumber( 0.1, 100. ) ); // @suppress("Invalid arguments")
+  checkpoint.m_Seed = Rng()();
+
+  std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+  Herd::SSE::WriteCheckpoint( checkpoint, stream );
+  Herd::SSE::Checkpoint read = Herd::SSE::ReadCheckpoint( stream );
+
+  // Exact
+  const Herd::SSE::EvolutionState& rExpected = checkpoint.m_State;
+  const Herd::SSE::EvolutionState& rActual = read.m_State;
+  BOOST_TEST( rActual.m_TrackPoint.m_Mass == rExpected.m_TrackPoint.m_Mass ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_InitialMetallicity == rExpected.m_TrackPoint.m_InitialMetallicity ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_Radius == rExpected.m_TrackPoint.m_Radius ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_Luminosity == rExpected.m_TrackPoint.m_Luminosity ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_Temperature == rExpected.m_TrackPoint.m_Temperature ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_Age == rExpected.m_TrackPoint.m_Age ); // @suppress("Invalid arguments")
+  BOOST_TEST( ( rActual.m_TrackPoint.m_Stage == rExpected.m_TrackPoint.m_Stage ) );
+  BOOST_TEST( rActual.m_TrackPoint.m_CoreMass == rExpected.m_TrackPoint.m_CoreMass ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_EnvelopeMass == rExpected.m_TrackPoint.m_EnvelopeMass ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_TrackPoint.m_AngularVelocity == rExpected.m_TrackPoint.m_AngularVelocity ); // @suppress("Invalid arguments")
+
+  BOOST_TEST( rActual.m_EffectiveAge == rExpected.m_EffectiveAge ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_CoreRadius == rExpected.m_CoreRadius ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_MassLossRate == rExpected.m_MassLossRate ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_AngularMomentum == rExpected.m_AngularMomentum ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_K2 == rExpected.m_K2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_MZAMS == rExpected.m_MZAMS ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_MZHe == rExpected.m_MZHe ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_MFGB == rExpected.m_MFGB ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_MCHeI == rExpected.m_MCHeI ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_DeltaT == rExpected.m_DeltaT ); // @suppress("Invalid arguments")
+  BOOST_TEST( rActual.m_THeMS == rExpected.m_THeMS ); // @suppress("Invalid arguments")
+
+  BOOST_TEST( read.m_InitialMass == checkpoint.m_InitialMass ); // @suppress("Invalid arguments")
+  BOOST_TEST( read.m_MainSequenceEvaluatedAt == checkpoint.m_MainSequenceEvaluatedAt ); // @suppress("Invalid arguments")
+  BOOST_TEST( read.m_Seed == checkpoint.m_Seed ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( InvalidStreamTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  {
+    std::stringstream stream( "Not a checkpoint" );
+    BOOST_CHECK_THROW( Herd::SSE::ReadCheckpoint( stream ), Herd::Exceptions::RuntimeError );
+  }
+
+  {
+    Herd::SSE::Checkpoint checkpoint;
+    checkpoint.m_State = Herd::SSE::UnitTests::GenerateRandomEvolutionState( Rng() );
+
+    std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+    Herd::SSE::WriteCheckpoint( checkpoint, stream );
+    std::string written = stream.str();
+
+    std::stringstream truncated( written.substr( 0, GenerateNumber( std::size_t( 0 ), written.size() - 1 ) ), std::ios::in | std::ios::binary ); // @suppress("Invalid arguments")
+    BOOST_CHECK_THROW( Herd::SSE::ReadCheckpoint( truncated ), Herd::Exceptions::RuntimeError );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,92 @@
+/**
+ * @file ColumnarTrajectoryUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "SSETestUtils.h"
+
+#include <SSE/ColumnarTrajectory.h>
+#include <SSE/TrackPoint.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <vector>
+
+BOOST_FIXTURE_TEST_SUITE( ColumnarTrajectoryUnitTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::ColumnarTrajectory trajectory;
+  BOOST_CHECK_THROW( trajectory.back(), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( trajectory[ 0 ], Herd::Exceptions::PreconditionError );
+
+  trajectory.push_back( Herd::SSE::UnitTests::GenerateRandomTrackPoint( Rng() ) );
+  BOOST_CHECK_NO_THROW( trajectory[ 0 ] );
+  BOOST_CHECK_THROW( trajectory[ 1 ], Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( trajectory.Column( Herd::SSE::TrackPointField::e_Count ), Herd::Exceptions::PreconditionError );
+}
+
+BOOST_AUTO_TEST_CASE( OperationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  std::size_t trackLength = GenerateNumber( 1, 100 );  // @suppress("Invalid arguments")
+  std::vector< Herd::SSE::TrackPoint > expected( trackLength );
+
+  Herd::SSE::ColumnarTrajectory trajectory;
+  trajectory.reserve( trackLength );
+  for( auto& rTrackPoint : expected )
+  {
+    rTrackPoint = Herd::SSE::UnitTests::GenerateRandomTrackPoint( Rng() );
+    trajectory.push_back( rTrackPoint );
+  }
+
+  BOOST_TEST_REQUIRE( trajectory.size() == trackLength );
+
+  // Row view
+  for( std::size_t index = 0; index < trackLength; ++index )
+  {
+    Herd::SSE::TrackPoint actual = trajectory[ index ];
+    BOOST_CHECK_EQUAL( actual.m_Mass, expected[ index ].m_Mass );
+    BOOST_CHECK_EQUAL( actual.m_InitialMetallicity, expected[ index ].m_InitialMetallicity );
+    BOOST_CHECK_EQUAL( actual.m_Radius, expected[ index ].m_Radius );
+    BOOST_CHECK_EQUAL( actual.m_Luminosity, expected[ index ].m_Luminosity );
+    BOOST_CHECK_EQUAL( actual.m_Temperature, expected[ index ].m_Temperature );
+    BOOST_CHECK_EQUAL( actual.m_Age, expected[ index ].m_Age );
+    BOOST_CHECK( actual.m_Stage == expected[ index ].m_Stage );
+    BOOST_CHECK_EQUAL( actual.m_CoreMass, expected[ index ].m_CoreMass );
+    BOOST_CHECK_EQUAL( actual.m_EnvelopeMass, expected[ index ].m_EnvelopeMass );
+    BOOST_CHECK_EQUAL( actual.m_AngularVelocity, expected[ index ].m_AngularVelocity );
+  }
+
+  BOOST_CHECK_EQUAL( trajectory.back().m_Age, expected.back().m_Age );
+
+  // Column view
+  auto luminosity = trajectory.Column( Herd::SSE::TrackPointField::e_Luminosity );
+  auto stages = trajectory.Stages();
+  BOOST_TEST_REQUIRE( luminosity.size() == trackLength );
+  BOOST_TEST_REQUIRE( stages.size() == trackLength );
+  for( std::size_t index = 0; index < trackLength; ++index )
+  {
+    BOOST_CHECK_EQUAL( luminosity[ index ], expected[ index ].m_Luminosity );
+    BOOST_CHECK( stages[ index ] == expected[ index ].m_Stage );
+  }
+
+  trajectory.clear();
+  BOOST_CHECK( trajectory.empty() );
+  BOOST_CHECK( trajectory.Column( Herd::SSE::TrackPointField::e_Age ).empty() );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
@@ -17,6 +17,7 @@
 #include "SSETestUtils.h"
 
 #include <Exceptions/PreconditionError.h>
+#include <Generic/ValidationPolicy.h>
 #include <SSE/ConvectiveEnvelope.h>
 #include <SSE/EvolutionStage.h>
 #include <UnitTestUtils/RandomTestFixture.h>
@@ -47,7 +48,10 @@ BOOST_AUTO_TEST_CASE( InputTest, *Herd::UnitTestUtils::Labels::s_Compile )
     BOOST_TEST( Output.m_K2 == 0. ); // @suppress("Invalid arguments") // @suppress("Method cannot be resolved")
   }
 
-  BOOST_CHECK_THROW( envelopeComputer.Compute( Herd::SSE::EvolutionState() ), Herd::Exceptions::PreconditionError );
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+  {
+    BOOST_CHECK_THROW( envelopeComputer.Compute( Herd::SSE::EvolutionState() ), Herd::Exceptions::PreconditionError );
+  }
 
 }
 
@@ -0,0 +1,160 @@
+/**
+ * @file DenseTrajectoryUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "SSETestUtils.h"
+
+#include <SSE/ColumnarTrajectory.h>
+#include <SSE/DenseTrajectory.h>
+#include <SSE/EvolutionStage.h>
+#include <SSE/TrackPoint.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+/**
+ * @brief Generates a trajectory with increasing ages, luminosity linear in age, and a stage change
+ * @param io_rFixture Random number generator
+ * @param i_Length Number of track points
+ * @param i_Boundary Index of the first track point of the second stage
+ * @return Trajectory
+ */
+Herd::SSE::ColumnarTrajectory GenerateTrajectory( Herd::UnitTestUtils::RandomTestFixture& io_rFixture, std::size_t i_Length, std::size_t i_Boundary )
+{
+  Herd::SSE::TrackPoint trackPoint = Herd::SSE::UnitTests::GenerateRandomTrackPoint( io_rFixture.Rng() );
+
+  Herd::SSE::ColumnarTrajectory trajectory;
+  for( std::size_t index = 0; index < i_Length; ++index )
+  {
+    trackPoint.m_Age.Set( index == 0 ? 0. : trackPoint.m_Age + io_rFixture.GenerateNumber( 0.1, 1. ) ); // @suppress("Invalid arguments")
+    trackPoint.m_Luminosity.Set( 1. + 2. * trackPoint.m_Age );
+    trackPoint.m_Stage = index < i_Boundary ? Herd::SSE::EvolutionStage::e_MSLM : Herd::SSE::EvolutionStage::e_MS;
+    trajectory.push_back( trackPoint );
+  }
+
+  return trajectory;
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE( DenseTrajectoryUnitTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  BOOST_CHECK_THROW( Herd::SSE::DenseTrajectory( Herd::SSE::ColumnarTrajectory() ), Herd::Exceptions::PreconditionError );
+
+  Herd::SSE::ColumnarTrajectory decreasing = GenerateTrajectory( *this, 3, 3 );
+  Herd::SSE::TrackPoint last = decreasing[ 0 ];
+  last.m_Age.Set( decreasing.back().m_Age - 0.05 );
+  decreasing.push_back( last );
+  BOOST_CHECK_THROW( Herd::SSE::DenseTrajectory { decreasing }, Herd::Exceptions::PreconditionError );
+
+  Herd::SSE::DenseTrajectory dense( GenerateTrajectory( *this, 10, 10 ) );
+  BOOST_CHECK_THROW( dense.At( Herd::Generic::Time( GenerateNumber( -1., -0.1 ) ) ), Herd::Exceptions::PreconditionError ); // @suppress("Invalid arguments")
+  BOOST_CHECK_THROW( dense.At( Herd::Generic::Time( dense.MaxAge() + 0.1 ) ), Herd::Exceptions::PreconditionError );
+
+  std::vector< Herd::Generic::Time > ages { dense.MinAge(), Herd::Generic::Time( dense.MaxAge() + 0.1 ) };
+  BOOST_CHECK_THROW( dense.At( ages ), Herd::Exceptions::PreconditionError );
+}
+
+BOOST_AUTO_TEST_CASE( TrackPointTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  std::size_t length = GenerateNumber( 1, 50 ); // @suppress("Invalid arguments")
+  Herd::SSE::DenseTrajectory dense( GenerateTrajectory( *this, length, length ) );
+
+  const Herd::SSE::ColumnarTrajectory& trajectory = dense.Trajectory();
+  BOOST_TEST_REQUIRE( trajectory.size() == length ); // @suppress("Invalid arguments")
+  BOOST_TEST( dense.MinAge() == trajectory[ 0 ].m_Age ); // @suppress("Invalid arguments")
+  BOOST_TEST( dense.MaxAge() == trajectory.back().m_Age ); // @suppress("Invalid arguments")
+
+  // Stored track points are returned as is
+  for( std::size_t index = 0; index < length; ++index )
+  {
+    Herd::SSE::TrackPoint trackPoint = dense.At( trajectory[ index ].m_Age );
+    BOOST_TEST( trackPoint.m_Age == trajectory[ index ].m_Age ); // @suppress("Invalid arguments")
+    BOOST_TEST( trackPoint.m_Luminosity == trajectory[ index ].m_Luminosity ); // @suppress("Invalid arguments")
+  }
+}
+
+BOOST_AUTO_TEST_CASE( InterpolationTest, *Herd::UnitTestUtils::Labels::s_Compile * boost::unit_test::tolerance( 1e-10 ) )
+{
+  std::size_t boundary = GenerateNumber( 1, 49 ); // @suppress("Invalid arguments")
+  Herd::SSE::DenseTrajectory dense( GenerateTrajectory( *this, 50, boundary ) );
+  const Herd::SSE::ColumnarTrajectory& trajectory = dense.Trajectory();
+
+  // Within a stage, luminosity is linear in age
+  std::size_t index = GenerateNumber( 0, 48 ); // @suppress("Invalid arguments")
+  Herd::Generic::Time age( GenerateNumber( trajectory[ index ].m_Age.Value(), trajectory[ index + 1 ].m_Age.Value() ) ); // @suppress("Invalid arguments")
+  Herd::SSE::TrackPoint trackPoint = dense.At( age );
+  BOOST_TEST( trackPoint.m_Age.Value() == age.Value() ); // @suppress("Invalid arguments")
+
+  if( index + 1 != boundary )
+  {
+    BOOST_TEST( trackPoint.m_Luminosity.Value() == 1. + 2. * age ); // @suppress("Invalid arguments")
+    BOOST_TEST( ( trackPoint.m_Stage == trajectory[ index ].m_Stage ) );
+  }
+
+  // Across the stage change, the last track point of the earlier stage is held
+  Herd::Generic::Time boundaryAge( GenerateNumber( trajectory[ boundary - 1 ].m_Age.Value(), trajectory[ boundary ].m_Age.Value() ) ); // @suppress("Invalid arguments")
+  Herd::SSE::TrackPoint boundaryPoint = dense.At( boundaryAge );
+  if( boundaryAge < trajectory[ boundary ].m_Age )
+  {
+    BOOST_TEST( boundaryPoint.m_Luminosity.Value() == trajectory[ boundary - 1 ].m_Luminosity.Value() ); // @suppress("Invalid arguments")
+    BOOST_TEST( ( boundaryPoint.m_Stage == Herd::SSE::EvolutionStage::e_MSLM ) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( BatchTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  std::size_t boundary = GenerateNumber( 1, 49 ); // @suppress("Invalid arguments")
+  Herd::SSE::DenseTrajectory dense( GenerateTrajectory( *this, 50, boundary ) );
+
+  std::vector< Herd::Generic::Time > ages;
+  std::size_t count = GenerateNumber( 1, 100 ); // @suppress("Invalid arguments")
+  for( std::size_t index = 0; index < count; ++index )
+  {
+    ages.emplace_back( GenerateNumber( dense.MinAge().Value(), dense.MaxAge().Value() ) ); // @suppress("Invalid arguments")
+  }
+  ages.push_back( dense.MaxAge() );
+
+  // Unsorted and sorted queries are equivalent to the individual queries
+  for( bool isSorted : { false, true } )
+  {
+    if( isSorted )
+    {
+      ranges::cpp20::sort( ages );
+    }
+
+    Herd::SSE::ColumnarTrajectory states = dense.At( ages );
+    BOOST_TEST_REQUIRE( states.size() == ages.size() ); // @suppress("Invalid arguments")
+    for( std::size_t index = 0; index < ages.size(); ++index )
+    {
+      Herd::SSE::TrackPoint expected = dense.At( ages[ index ] );
+      BOOST_TEST( states[ index ].m_Age == expected.m_Age ); // @suppress("Invalid arguments")
+      BOOST_TEST( states[ index ].m_Luminosity == expected.m_Luminosity ); // @suppress("Invalid arguments")
+      BOOST_TEST( ( states[ index ].m_Stage == expected.m_Stage ) );
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
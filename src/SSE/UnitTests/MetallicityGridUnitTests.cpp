@@ -0,0 +1,88 @@
+/**
+ * @file MetallicityGridUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/MetallicityGrid.h>
+#include <SSE/SingleStarEvolution.h>
+#include <SSE/Landmarks/Constants.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/Quantity.h>
+#include <Generic/QuantityRange.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cmath>
+#include <cstddef>
+
+BOOST_FIXTURE_TEST_SUITE( MetallicityGridTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  const auto& rRange = Herd::SSE::SingleStarEvolutuionSpecs::s_MetallicityRange;
+  BOOST_CHECK_THROW( Herd::SSE::MetallicityGrid( rRange, 0. ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::SSE::MetallicityGrid( rRange, GenerateNumber( -1., -0.1 ) ), Herd::Exceptions::PreconditionError ); // @suppress("Invalid arguments")
+  BOOST_CHECK_THROW( Herd::SSE::MetallicityGrid( Herd::Generic::ClosedRange( 0., 0.03 ), 0.01 ), Herd::Exceptions::PreconditionError );
+}
+
+BOOST_AUTO_TEST_CASE( NodeTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  const auto& rRange = Herd::SSE::SingleStarEvolutuionSpecs::s_MetallicityRange;
+  double step = GenerateNumber( 0.001, 0.5 ); // @suppress("Invalid arguments")
+  Herd::SSE::MetallicityGrid grid( rRange, step );
+
+  BOOST_TEST_REQUIRE( grid.size() > 0 ); // @suppress("Invalid arguments")
+  BOOST_TEST( grid[ 0 ].Value() == rRange.Lower() ); // @suppress("Invalid arguments")
+  BOOST_TEST( grid[ grid.size() - 1 ].Value() <= rRange.Upper() ); // @suppress("Invalid arguments")
+  BOOST_TEST( std::log10( rRange.Upper() / grid[ grid.size() - 1 ] ) < step ); // @suppress("Invalid arguments")
+
+  // Nodes snap to themselves
+  std::size_t index = GenerateNumber( static_cast< std::size_t >( 0 ), grid.size() - 1 ); // @suppress("Invalid arguments")
+  BOOST_TEST( grid.Snap( grid[ index ] ) == grid[ index ] ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( SnapTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  const auto& rRange = Herd::SSE::SingleStarEvolutuionSpecs::s_MetallicityRange;
+  double step = GenerateNumber( 0.001, 0.5 ); // @suppress("Invalid arguments")
+  Herd::SSE::MetallicityGrid grid( rRange, step );
+
+  for( unsigned int trial = 0; trial < 100; ++trial )
+  {
+    Herd::Generic::Metallicity z( std::pow( 10., GenerateNumber( std::log10( rRange.Lower() ), std::log10( rRange.Upper() ) ) ) ); // @suppress("Invalid arguments")
+    Herd::Generic::Metallicity snapped = grid.Snap( z );
+
+    BOOST_TEST_CONTEXT( "Z=" << z.Value() << " snapped=" << snapped.Value() )
+    {
+      BOOST_TEST( grid.Snap( snapped ) == snapped ); // @suppress("Invalid arguments")
+      BOOST_TEST( std::abs( std::log10( snapped / z ) ) <= step * ( 1 + 1e-12 ) ); // @suppress("Invalid arguments")
+
+      for( double branchPoint : Herd::SSE::Constants::s_MetallicityBranchPoints )
+      {
+        BOOST_TEST( ( z < branchPoint ) == ( snapped < branchPoint ) ); // @suppress("Invalid arguments")
+        BOOST_TEST( ( z > branchPoint ) == ( snapped > branchPoint ) ); // @suppress("Invalid arguments")
+      }
+    }
+  }
+
+  // Branch points are not moved
+  for( double branchPoint : Herd::SSE::Constants::s_MetallicityBranchPoints )
+  {
+    Herd::Generic::Metallicity z( branchPoint );
+    BOOST_TEST( grid.Snap( z ) == z ); // @suppress("Invalid arguments")
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,188 @@
+/**
+ * @file OutputFilterUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "SSETestUtils.h"
+
+#include <SSE/ColumnarTrajectory.h>
+#include <SSE/EvolutionStage.h>
+#include <SSE/OutputFilter.h>
+#include <SSE/TrackPoint.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Generates a track with increasing ages, and luminosity and radius linear in age
+ * @param io_rFixture Random number generator
+ * @param i_Length Number of track points
+ * @return Track
+ */
+std::vector< Herd::SSE::TrackPoint > GenerateTrack( Herd::UnitTestUtils::RandomTestFixture& io_rFixture, std::size_t i_Length )
+{
+  std::vector< Herd::SSE::TrackPoint > track( i_Length, Herd::SSE::UnitTests::GenerateRandomTrackPoint( io_rFixture.Rng() ) );
+  for( std::size_t index = 0; index < i_Length; ++index )
+  {
+    track[ index ].m_Age.Set( index == 0 ? 0. : track[ index - 1 ].m_Age + io_rFixture.GenerateNumber( 0.1, 1. ) ); // @suppress("Invalid arguments")
+    track[ index ].m_Luminosity.Set( 1. + 2. * track[ index ].m_Age );
+    track[ index ].m_Radius.Set( 3. + 0.5 * track[ index ].m_Age );
+  }
+
+  return track;
+}
+
+/**
+ * @brief Passes a track through a filter
+ * @param io_rFilter Filter
+ * @param i_rTrack Track
+ * @return Filtered trajectory
+ */
+Herd::SSE::ColumnarTrajectory Filter( Herd::SSE::OutputFilter& io_rFilter, const std::vector< Herd::SSE::TrackPoint >& i_rTrack )
+{
+  Herd::SSE::ColumnarTrajectory trajectory;
+  for( const auto& rTrackPoint : i_rTrack )
+  {
+    io_rFilter.Push( rTrackPoint, trajectory );
+  }
+  io_rFilter.Flush( trajectory );
+
+  return trajectory;
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE( OutputFilterUnitTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  using enum Herd::SSE::OutputPolicy;
+
+  std::vector< Herd::Generic::Time > valid { Herd::Generic::Time( 0. ), Herd::Generic::Time( 1. ) };
+  BOOST_CHECK_NO_THROW( Herd::SSE::OutputFilter( e_OutputAges, valid, 0.1 ) );
+
+  std::vector< Herd::Generic::Time > negative { Herd::Generic::Time( -1. ), Herd::Generic::Time( 1. ) };
+  BOOST_CHECK_THROW( Herd::SSE::OutputFilter( e_OutputAges, negative, 0.1 ), Herd::Exceptions::PreconditionError );
+
+  std::vector< Herd::Generic::Time > repeated { Herd::Generic::Time( 1. ), Herd::Generic::Time( 1. ) };
+  BOOST_CHECK_THROW( Herd::SSE::OutputFilter( e_OutputAges, repeated, 0.1 ), Herd::Exceptions::PreconditionError );
+
+  BOOST_CHECK_THROW( Herd::SSE::OutputFilter( e_RelativeChange, valid, 0. ), Herd::Exceptions::PreconditionError );
+}
+
+BOOST_AUTO_TEST_CASE( EveryStepTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  auto track = GenerateTrack( *this, GenerateNumber( 1, 100 ) ); // @suppress("Invalid arguments")
+
+  Herd::SSE::OutputFilter filter( Herd::SSE::OutputPolicy::e_EveryStep, {}, 0.1 );
+  auto trajectory = Filter( filter, track );
+
+  BOOST_TEST_REQUIRE( trajectory.size() == track.size() );  // @suppress("Invalid arguments")
+  for( std::size_t index = 0; index < track.size(); ++index )
+  {
+    BOOST_TEST( trajectory[ index ].m_Age == track[ index ].m_Age ); // @suppress("Invalid arguments")
+  }
+}
+
+BOOST_AUTO_TEST_CASE( StageBoundariesTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  auto track = GenerateTrack( *this, 100 );
+  std::size_t boundary = GenerateNumber( 1, 98 ); // @suppress("Invalid arguments")
+  for( std::size_t index = 0; index < track.size(); ++index )
+  {
+    track[ index ].m_Stage = index < boundary ? Herd::SSE::EvolutionStage::e_MSLM : Herd::SSE::EvolutionStage::e_MS;
+  }
+
+  Herd::SSE::OutputFilter filter( Herd::SSE::OutputPolicy::e_StageBoundaries, {}, 0.1 );
+  auto trajectory = Filter( filter, track );
+
+  // First, the two sides of the boundary, last
+  std::vector< std::size_t > expected { 0, boundary - 1, boundary, track.size() - 1 };
+  if( boundary == 1 )
+  {
+    expected.erase( expected.begin() );
+  }
+
+  BOOST_TEST_REQUIRE( trajectory.size() == expected.size() ); // @suppress("Invalid arguments")
+  for( std::size_t index = 0; index < expected.size(); ++index )
+  {
+    BOOST_TEST( trajectory[ index ].m_Age == track[ expected[ index ] ].m_Age ); // @suppress("Invalid arguments")
+    BOOST_TEST( ( trajectory[ index ].m_Stage == track[ expected[ index ] ].m_Stage ) );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( OutputAgesTest, *Herd::UnitTestUtils::Labels::s_Compile * boost::unit_test::tolerance( 1e-10 ) )
+{
+  auto track = GenerateTrack( *this, 100 );
+
+  // The last output age is beyond the end of the track
+  std::vector< Herd::Generic::Time > outputAges;
+  for( double age = GenerateNumber( 0.1, 1. ); age < track.back().m_Age + 10.; age += GenerateNumber( 0.1, 5. ) ) // @suppress("Invalid arguments")
+  {
+    outputAges.emplace_back( age );
+  }
+
+  Herd::SSE::OutputFilter filter( Herd::SSE::OutputPolicy::e_OutputAges, outputAges, 0.1 );
+  auto trajectory = Filter( filter, track );
+
+  // First, output ages within the track, last
+  std::size_t inRange = 0;
+  for( auto age : outputAges )
+  {
+    inRange += age <= track.back().m_Age ? 1 : 0;
+  }
+
+  BOOST_TEST_REQUIRE( trajectory.size() == inRange + ( outputAges[ inRange - 1 ] == track.back().m_Age ? 1 : 2 ) ); // @suppress("Invalid arguments")
+  BOOST_TEST( trajectory[ 0 ].m_Age == track.front().m_Age ); // @suppress("Invalid arguments")
+  BOOST_TEST( trajectory.back().m_Age == track.back().m_Age ); // @suppress("Invalid arguments")
+
+  // Luminosity and radius are linear in age, so the interpolation is exact
+  for( std::size_t index = 0; index < inRange; ++index )
+  {
+    auto trackPoint = trajectory[ index + 1 ];
+    BOOST_TEST( trackPoint.m_Age == outputAges[ index ] ); // @suppress("Invalid arguments")
+    BOOST_TEST( trackPoint.m_Luminosity.Value() == 1. + 2. * outputAges[ index ] ); // @suppress("Invalid arguments")
+    BOOST_TEST( trackPoint.m_Radius.Value() == 3. + 0.5 * outputAges[ index ] ); // @suppress("Invalid arguments")
+  }
+}
+
+BOOST_AUTO_TEST_CASE( RelativeChangeTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  auto track = GenerateTrack( *this, 100 );
+  double threshold = GenerateNumber( 0.2, 0.5 ); // @suppress("Invalid arguments")
+
+  Herd::SSE::OutputFilter filter( Herd::SSE::OutputPolicy::e_RelativeChange, {}, threshold );
+  auto trajectory = Filter( filter, track );
+
+  BOOST_TEST_REQUIRE( trajectory.size() >= 2 ); // @suppress("Invalid arguments")
+  BOOST_TEST_REQUIRE( trajectory.size() < track.size() ); // @suppress("Invalid arguments")
+  BOOST_TEST( trajectory[ 0 ].m_Age == track.front().m_Age ); // @suppress("Invalid arguments")
+  BOOST_TEST( trajectory.back().m_Age == track.back().m_Age ); // @suppress("Invalid arguments")
+
+  // Between two stored track points, except for the last, the change exceeds the threshold
+  for( std::size_t index = 1; index + 1 < trajectory.size(); ++index )
+  {
+    double previous = trajectory[ index - 1 ].m_Luminosity;
+    double current = trajectory[ index ].m_Luminosity;
+    BOOST_TEST( current - previous > threshold * previous ); // @suppress("Invalid arguments")
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
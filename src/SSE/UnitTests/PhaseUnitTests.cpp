@@ -18,6 +18,7 @@
 
 #include <Exceptions/PreconditionError.h>
 #include <Generic/Quantity.h>
+#include <Generic/ValidationPolicy.h>
 #include <SSE/EvolutionState.h>
 #include <SSE/IPhase.h>
 #include <SSE/MainSequence.h>
@@ -65,8 +66,30 @@ BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
     BOOST_CHECK_NO_THROW( pPhase->Evolve( validState ) );
     BOOST_CHECK_NO_THROW( pPhase->EndsAt() );
 
-    BOOST_CHECK_THROW( pPhase->Evolve( invalidState ), Herd::Exceptions::PreconditionError );
+    if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
+    {
+      BOOST_CHECK_THROW( pPhase->Evolve( invalidState ), Herd::Exceptions::PreconditionError );
+    }
   }
 }
 
+// Static and dynamic dispatch should produce the same results
+BOOST_AUTO_TEST_CASE( DispatchTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  static_assert( Herd::SSE::Phase< Herd::SSE::IPhase > );
+  static_assert( Herd::SSE::Phase< Herd::SSE::MainSequence > );
+
+  Herd::SSE::MainSequence ms { Herd::Generic::Metallicity( GenerateMetallicity() ) };
+  Herd::SSE::IPhase& rPhase = ms;
+
+  Herd::SSE::EvolutionState state = Herd::SSE::UnitTests::GenerateRandomEvolutionState( Rng() );
+  Herd::SSE::EvolutionState staticState = state;
+  Herd::SSE::EvolutionState dynamicState = state;
+
+  BOOST_TEST( ( ms.Evolve( staticState ) == rPhase.Evolve( dynamicState ) ) );
+  BOOST_TEST( staticState.m_TrackPoint.m_Luminosity.Value() == dynamicState.m_TrackPoint.m_Luminosity.Value() ); // @suppress("Invalid arguments")
+  BOOST_TEST( staticState.m_TrackPoint.m_Radius.Value() == dynamicState.m_TrackPoint.m_Radius.Value() ); // @suppress("Invalid arguments")
+  BOOST_TEST( ms.EndsAt() == rPhase.EndsAt() ); // @suppress("Invalid arguments")
+}
+
 BOOST_AUTO_TEST_SUITE_END( )
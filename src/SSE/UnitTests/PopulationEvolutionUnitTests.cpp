@@ -0,0 +1,127 @@
+/**
+ * @file PopulationEvolutionUnitTests.cpp
+ * @author Evren Imre
+ * @date 17 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <Exceptions/PreconditionError.h>
+#include <SSE/PopulationEvolution.h>
+#include <SSE/SingleStarEvolution.h>
+#include <SSE/TrackPoint.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+BOOST_FIXTURE_TEST_SUITE( PopulationEvolutionTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( ValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  std::vector< Herd::SSE::PopulationEvolution::InitialConditions > population( 2 );
+  std::vector< Herd::SSE::TrackPoint > finalStates( 1 );
+
+  Herd::SSE::PopulationEvolution simulator;
+  BOOST_CHECK_THROW( simulator.Evolve( population, Herd::SSE::SingleStarEvolutuion::Parameters(), finalStates ), Herd::Exceptions::PreconditionError );
+}
+
+// The population results should be identical to that of evolving each star separately
+BOOST_AUTO_TEST_CASE( ConsistencyTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  const auto& rMassRange = Herd::SSE::SingleStarEvolutuionSpecs::s_EvolvableMassRange;
+  const auto& rMetallicityRange = Herd::SSE::SingleStarEvolutuionSpecs::s_MetallicityRange;
+
+  // Two metallicity groups, interleaved
+  std::array< Herd::Generic::Metallicity, 2 > metallicities { Herd::Generic::Metallicity( GenerateNumber( rMetallicityRange.Lower(), rMetallicityRange.Upper() ) ), // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity( GenerateNumber( rMetallicityRange.Lower(), rMetallicityRange.Upper() ) ) }; // @suppress("Invalid arguments")
+
+  constexpr std::size_t populationSize = 6;
+  std::vector< Herd::SSE::PopulationEvolution::InitialConditions > population( populationSize );
+  for( std::size_t idx = 0; idx < populationSize; ++idx )
+  {
+    auto& rStar = population[ idx ];
+    rStar.m_Mass.Set( GenerateNumber( rMassRange.Lower(), rMassRange.Upper() ) ); // @suppress("Invalid arguments")
+    rStar.m_Z = metallicities[ idx % 2 ];
+    rStar.m_EvolveUntil.Set( GenerateNumber( 0., 13800. ) ); // @suppress("Invalid arguments")
+  }
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  std::vector< Herd::SSE::TrackPoint > finalStates( populationSize );
+  Herd::SSE::PopulationEvolution simulator;
+  simulator.Evolve( population, parameters, finalStates );
+
+  for( std::size_t idx = 0; idx < populationSize; ++idx )
+  {
+    const auto& rStar = population[ idx ];
+
+    Herd::SSE::SingleStarEvolutuion sse;
+    sse.Evolve( rStar.m_Mass, rStar.m_Z, rStar.m_EvolveUntil, parameters );
+    const Herd::SSE::TrackPoint& rExpected = sse.Trajectory().back();
+    const Herd::SSE::TrackPoint& rActual = finalStates[ idx ];
+
+    BOOST_TEST_CONTEXT( "Star index " << idx )
+    {
+      BOOST_TEST( rActual.m_Age.Value() == rExpected.m_Age.Value() );
+      BOOST_TEST( rActual.m_Mass.Value() == rExpected.m_Mass.Value() );
+      BOOST_TEST( rActual.m_Radius.Value() == rExpected.m_Radius.Value() );
+      BOOST_TEST( rActual.m_Luminosity.Value() == rExpected.m_Luminosity.Value() );
+      BOOST_TEST( rActual.m_EnvelopeMass.Value() == rExpected.m_EnvelopeMass.Value() );
+      BOOST_TEST( rActual.m_AngularVelocity.Value() == rExpected.m_AngularVelocity.Value() );
+      BOOST_TEST( ( rActual.m_Stage == rExpected.m_Stage ) );
+    }
+  }
+}
+
+// Results should not depend on the number of threads
+BOOST_AUTO_TEST_CASE( ThreadCountTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  const auto& rMassRange = Herd::SSE::SingleStarEvolutuionSpecs::s_EvolvableMassRange;
+  const auto& rMetallicityRange = Herd::SSE::SingleStarEvolutuionSpecs::s_MetallicityRange;
+
+  constexpr std::size_t populationSize = 16;
+  std::vector< Herd::SSE::PopulationEvolution::InitialConditions > population( populationSize );
+  for( auto& rStar : population )
+  {
+    rStar.m_Mass.Set( GenerateNumber( rMassRange.Lower(), rMassRange.Upper() ) ); // @suppress("Invalid arguments")
+    rStar.m_Z.Set( GenerateNumber( rMetallicityRange.Lower(), rMetallicityRange.Upper() ) ); // @suppress("Invalid arguments")
+    rStar.m_EvolveUntil.Set( GenerateNumber( 0., 13800. ) ); // @suppress("Invalid arguments")
+  }
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  std::vector< Herd::SSE::TrackPoint > serial( populationSize );
+  Herd::SSE::PopulationEvolution( 1 ).Evolve( population, parameters, serial );
+
+  std::vector< Herd::SSE::TrackPoint > parallel( populationSize );
+  Herd::SSE::PopulationEvolution( GenerateNumber( 2u, 8u ) ).Evolve( population, parameters, parallel ); // @suppress("Invalid arguments")
+
+  for( std::size_t idx = 0; idx < populationSize; ++idx )
+  {
+    BOOST_TEST_CONTEXT( "Star index " << idx )
+    {
+      BOOST_TEST( parallel[ idx ].m_Age.Value() == serial[ idx ].m_Age.Value() );
+      BOOST_TEST( parallel[ idx ].m_Mass.Value() == serial[ idx ].m_Mass.Value() );
+      BOOST_TEST( parallel[ idx ].m_Radius.Value() == serial[ idx ].m_Radius.Value() );
+      BOOST_TEST( parallel[ idx ].m_Luminosity.Value() == serial[ idx ].m_Luminosity.Value() );
+      BOOST_TEST( parallel[ idx ].m_AngularVelocity.Value() == serial[ idx ].m_AngularVelocity.Value() );
+    }
+  }
+
+  // Seeds depend only on the population seed and the index of the star
+  BOOST_TEST( Herd::SSE::PopulationEvolution::ComputeSeed( parameters.m_Seed, 3 ) == Herd::SSE::PopulationEvolution::ComputeSeed( parameters.m_Seed, 3 ) );
+  BOOST_TEST( Herd::SSE::PopulationEvolution::ComputeSeed( parameters.m_Seed, 3 ) != Herd::SSE::PopulationEvolution::ComputeSeed( parameters.m_Seed, 4 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END( )
@@ -0,0 +1,269 @@
+/**
+ * @file ReferenceTrackCache.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include "ReferenceTrackCache.h"
+
+#include "SSETestDataManager.h"
+
+#include <SSE/EvolutionStage.h>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <type_traits>
+
+#include <boost/test/unit_test.hpp>
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+constexpr std::array< char, 8 > s_Magic { 'H', 'E', 'R', 'D', 'R', 'E', 'F', 'T' }; ///< Identifies a reference track cache
+constexpr uint32_t s_FormatVersion = 1; ///< Format version. Increment when the layout changes
+constexpr uint32_t s_ByteOrderMark = 0x01020304; ///< Reads differently on a platform with a different byte order
+
+const std::string s_ParentTag = "Track"; ///< Parent tag for the track points
+
+/**
+ * @brief Writes the object representation of a value
+ * @tparam T Trivially copyable type
+ * @param i_Value Value
+ * @param io_rStream Stream
+ */
+template< class T >
+  requires std::is_trivially_copyable_v< T >
+void WriteValue( T i_Value, std::ostream& io_rStream )
+{
+  io_rStream.write( reinterpret_cast< const char* >( &i_Value ), sizeof(T) );
+}
+
+/**
+ * @brief Reads the object representation of a value
+ * @tparam T Trivially copyable type
+ * @param io_rStream Stream
+ * @return Value. Unspecified if the stream fails
+ */
+template< class T >
+  requires std::is_trivially_copyable_v< T >
+T ReadValue( std::istream& io_rStream )
+{
+  T value {};
+  io_rStream.read( reinterpret_cast< char* >( &value ), sizeof(T) );
+  return value;
+}
+
+/**
+ * @brief Writes a string, prefixed by its length
+ * @param i_rValue Value
+ * @param io_rStream Stream
+ */
+void WriteString( const std::string& i_rValue, std::ostream& io_rStream )
+{
+  WriteValue( static_cast< uint64_t >( i_rValue.size() ), io_rStream );
+  io_rStream.write( i_rValue.data(), i_rValue.size() );
+}
+
+/**
+ * @brief Reads a string written by WriteString
+ * @param io_rStream Stream
+ * @return Value. Unspecified if the stream fails
+ */
+std::string ReadString( std::istream& io_rStream )
+{
+  std::string value;
+  uint64_t length = ReadValue< uint64_t >( io_rStream );
+  for( uint64_t index = 0; index < length && io_rStream; ++index )
+  {
+    value.push_back( ReadValue< char >( io_rStream ) );
+  }
+
+  return value;
+}
+
+/**
+ * @brief Writes or reads the fields of a track point, in a fixed order
+ * @tparam TTrackPoint TrackPoint, \c const for writing
+ * @tparam TProcess Callable
+ * @param io_rTrackPoint Track point, \c const for writing
+ * @param i_Process Callable that processes a reference to a quantity
+ */
+template< class TTrackPoint, class TProcess >
+void VisitFields( TTrackPoint& io_rTrackPoint, TProcess i_Process )
+{
+  i_Process( io_rTrackPoint.m_Mass );
+  i_Process( io_rTrackPoint.m_InitialMetallicity );
+  i_Process( io_rTrackPoint.m_Radius );
+  i_Process( io_rTrackPoint.m_Luminosity );
+  i_Process( io_rTrackPoint.m_Temperature );
+  i_Process( io_rTrackPoint.m_Age );
+  i_Process( io_rTrackPoint.m_CoreMass );
+  i_Process( io_rTrackPoint.m_EnvelopeMass );
+  i_Process( io_rTrackPoint.m_AngularVelocity );
+}
+}
+
+namespace Herd::SSE::UnitTests
+{
+
+/**
+ * @param i_rFiles Property trees for the XML files, indexed by the file name
+ * @return Reference tracks, sorted by name
+ * @remarks The initial metallicity of each track point is that of the first track point, as the metallicity evolution is not computed
+ */
+std::vector< Herd::SSE::UnitTests::ReferenceTrack > ConvertReferenceTracks( const std::unordered_map< std::string, boost::property_tree::ptree >& i_rFiles )
+{
+  std::vector< Herd::SSE::UnitTests::ReferenceTrack > tracks;
+  tracks.reserve( i_rFiles.size() );
+  for( const auto& [ rName, rRoot ] : i_rFiles )
+  {
+    Herd::SSE::UnitTests::SSETestDataManager dataManager;
+    dataManager.SetData( rRoot.get_child( s_ParentTag ) );
+    dataManager.CheckVersionInfo();
+    dataManager.PopulateTrackPoints();
+
+    tracks.push_back( { rName, dataManager.TrackPoints() } );
+  }
+
+  ranges::cpp20::sort( tracks, {}, &Herd::SSE::UnitTests::ReferenceTrack::m_Name );
+  return tracks;
+}
+
+/**
+ * @param i_rCacheDir Cache directory
+ * @return Path of the cache file for DefaultVersionInfo::s_UUID
+ */
+std::filesystem::path MakeReferenceTrackCachePath( const std::filesystem::path& i_rCacheDir )
+{
+  return i_rCacheDir / ( "ReferenceTracks." + Herd::SSE::UnitTests::DefaultVersionInfo::s_UUID + ".bin" );
+}
+
+/**
+ * @param i_rTracks Reference tracks
+ * @param i_rPath Path to the cache file. Overwritten if it exists
+ * @remarks The file is written under a temporary name and then renamed, so a reader never sees a partial cache
+ * @remarks Values are stored in their native representation
+ */
+void WriteReferenceTrackCache( const std::vector< Herd::SSE::UnitTests::ReferenceTrack >& i_rTracks, const std::filesystem::path& i_rPath )
+{
+  std::filesystem::path temporary = i_rPath;
+  temporary += ".tmp" + std::to_string( std::random_device()() );
+
+  {
+    std::ofstream file( temporary, std::ios::binary | std::ios::trunc );
+    BOOST_TEST_REQUIRE( static_cast< bool >( file ), "Unable to create " + temporary.string() );
+
+    file.write( s_Magic.data(), s_Magic.size() );
+    WriteValue( s_FormatVersion, file );
+    WriteValue( s_ByteOrderMark, file );
+    WriteString( Herd::SSE::UnitTests::DefaultVersionInfo::s_UUID, file );
+    WriteString( Herd::SSE::UnitTests::DefaultVersionInfo::s_Version, file );
+
+    WriteValue( static_cast< uint64_t >( i_rTracks.size() ), file );
+    for( const auto& rTrack : i_rTracks )
+    {
+      WriteString( rTrack.m_Name, file );
+      WriteValue( static_cast< uint64_t >( rTrack.m_TrackPoints.size() ), file );
+      for( const auto& rTrackPoint : rTrack.m_TrackPoints )
+      {
+        VisitFields( rTrackPoint, [ & ]( const auto& i_rField )
+        {
+          WriteValue( i_rField.Value(), file );
+        } );
+        WriteValue( rTrackPoint.m_Stage, file );
+      }
+    }
+
+    BOOST_TEST_REQUIRE( static_cast< bool >( file ), "Unable to write " + temporary.string() );
+  }
+
+  std::filesystem::rename( temporary, i_rPath );
+}
+
+/**
+ * @param i_rPath Path to the cache file
+ * @return Reference tracks, sorted by name. Unset if the file does not exist, is malformed, or is for a different dataset
+ */
+std::optional< std::vector< Herd::SSE::UnitTests::ReferenceTrack > > ReadReferenceTrackCache( const std::filesystem::path& i_rPath )
+{
+  std::ifstream file( i_rPath, std::ios::binary );
+  if( !file )
+  {
+    return std::nullopt;
+  }
+
+  std::array< char, 8 > magic {};
+  file.read( magic.data(), magic.size() );
+  if( magic != s_Magic || ReadValue< uint32_t >( file ) != s_FormatVersion || ReadValue< uint32_t >( file ) != s_ByteOrderMark
+      || ReadString( file ) != Herd::SSE::UnitTests::DefaultVersionInfo::s_UUID || ReadString( file ) != Herd::SSE::UnitTests::DefaultVersionInfo::s_Version )
+  {
+    return std::nullopt;
+  }
+
+  // Counts are not trusted for preallocation, as the file may be malformed
+  std::vector< Herd::SSE::UnitTests::ReferenceTrack > tracks;
+  uint64_t trackCount = ReadValue< uint64_t >( file );
+  for( uint64_t trackIndex = 0; trackIndex < trackCount && file; ++trackIndex )
+  {
+    Herd::SSE::UnitTests::ReferenceTrack& rTrack = tracks.emplace_back();
+    rTrack.m_Name = ReadString( file );
+
+    uint64_t trackPointCount = ReadValue< uint64_t >( file );
+    for( uint64_t trackPointIndex = 0; trackPointIndex < trackPointCount && file; ++trackPointIndex )
+    {
+      Herd::SSE::TrackPoint& rTrackPoint = rTrack.m_TrackPoints.emplace_back();
+      VisitFields( rTrackPoint, [ & ]( auto& o_rField )
+      {
+        o_rField.Set( ReadValue< double >( file ) );
+      } );
+      rTrackPoint.m_Stage = ReadValue< Herd::SSE::EvolutionStage >( file );
+    }
+  }
+
+  if( !file || file.peek() != std::ifstream::traits_type::eof() )
+  {
+    return std::nullopt;
+  }
+
+  return tracks;
+}
+
+/**
+ * @return A constant reference to the reference tracks
+ */
+const std::vector< Herd::SSE::UnitTests::ReferenceTrack >& ReferenceTrackFixture::ReferenceTracks()
+{
+  if( s_Tracks )
+  {
+    return *s_Tracks;
+  }
+
+  if( CacheDir() )
+  {
+    std::filesystem::path path = MakeReferenceTrackCachePath( *CacheDir() );
+    s_Tracks = ReadReferenceTrackCache( path );
+    if( !s_Tracks )
+    {
+      s_Tracks = ConvertReferenceTracks( ReadAsXML( s_TrackRegex ) );
+      WriteReferenceTrackCache( *s_Tracks, path );
+    }
+  } else
+  {
+    s_Tracks = ConvertReferenceTracks( ReadAsXML( s_TrackRegex ) );
+  }
+
+  BOOST_TEST_REQUIRE( !s_Tracks->empty() );
+  return *s_Tracks;
+}
+
+}
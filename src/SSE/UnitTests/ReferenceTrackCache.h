@@ -0,0 +1,64 @@
+/**
+ * @file ReferenceTrackCache.h
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#ifndef HC4F6A133_3CED_4342_91DD_7B99F1A184EB
+#define HC4F6A133_3CED_4342_91DD_7B99F1A184EB
+
+#include <SSE/TrackPoint.h>
+#include <UnitTestUtils/DataLoaderFixture.h>
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+namespace Herd::SSE::UnitTests
+{
+/**
+ * @brief A reference evolutionary track
+ */
+struct ReferenceTrack
+{
+  std::string m_Name; ///< Name of the source file
+  std::vector< Herd::SSE::TrackPoint > m_TrackPoints; ///< Track points
+};
+
+std::vector< Herd::SSE::UnitTests::ReferenceTrack > ConvertReferenceTracks(
+    const std::unordered_map< std::string, boost::property_tree::ptree >& i_rFiles ); ///< Converts the XML reference tracks, sorted by name
+std::filesystem::path MakeReferenceTrackCachePath( const std::filesystem::path& i_rCacheDir ); ///< Path of the cache for the current dataset
+void WriteReferenceTrackCache( const std::vector< Herd::SSE::UnitTests::ReferenceTrack >& i_rTracks, const std::filesystem::path& i_rPath ); ///< Writes the reference tracks to a binary cache
+std::optional< std::vector< Herd::SSE::UnitTests::ReferenceTrack > > ReadReferenceTrackCache( const std::filesystem::path& i_rPath ); ///< Reads the reference tracks from a binary cache
+
+/**
+ * @brief Fixture for the reference tracks
+ * @remarks The tracks are loaded once per process. If a cache directory is provided, they are loaded from the binary cache for the dataset, which is built from the XML files on the first run. Otherwise, they are loaded from the XML files
+ * @remarks The cache is keyed by DefaultVersionInfo::s_UUID and DefaultVersionInfo::s_Version, so a regenerated dataset is never served from a stale cache
+ */
+class ReferenceTrackFixture : public Herd::UnitTestUtils::DataLoaderFixture
+{
+public:
+
+  const std::vector< Herd::SSE::UnitTests::ReferenceTrack >& ReferenceTracks(); ///< Reference tracks, sorted by name
+
+  inline static const std::string s_TrackRegex = "track\\.xml"; ///< Regex for track files
+
+private:
+
+  inline static std::optional< std::vector< Herd::SSE::UnitTests::ReferenceTrack > > s_Tracks; ///< Reference tracks, once loaded
+};
+
+}
+
+#endif /* HC4F6A133_3CED_4342_91DD_7B99F1A184EB */
@@ -0,0 +1,106 @@
+/**
+ * @file ReferenceTrackCacheUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "ReferenceTrackCache.h"
+
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * @brief Unit test fixture for the reference track cache
+ */
+class ReferenceTrackCacheTestFixture : public Herd::UnitTestUtils::RandomTestFixture, public Herd::SSE::UnitTests::ReferenceTrackFixture
+{
+public:
+
+  ReferenceTrackCacheTestFixture()
+  {
+    m_Path = std::filesystem::temp_directory_path() / ( "HerdReferenceTracks" + std::to_string( Seed() ) + "_" + std::to_string( Rng()() ) + ".bin" );
+  }
+
+  ~ReferenceTrackCacheTestFixture()
+  {
+    std::error_code error;
+    std::filesystem::remove( m_Path, error );
+  }
+
+  std::filesystem::path m_Path; ///< Temporary file
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE( ReferenceTrackCacheTests, ReferenceTrackCacheTestFixture )
+
+BOOST_AUTO_TEST_CASE( RoundTripTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  BOOST_TEST( !Herd::SSE::UnitTests::ReadReferenceTrackCache( m_Path ) );
+
+  // A random subset of the reference tracks
+  const auto& rTracks = ReferenceTracks();
+  std::vector< Herd::SSE::UnitTests::ReferenceTrack > expected;
+  for( std::size_t idx = GenerateNumber( static_cast< std::size_t >( 0 ), rTracks.size() - 1 ); idx < rTracks.size(); idx += 17 ) // @suppress("Invalid arguments")
+  {
+    expected.push_back( rTracks[ idx ] );
+  }
+
+  Herd::SSE::UnitTests::WriteReferenceTrackCache( expected, m_Path );
+  auto actual = Herd::SSE::UnitTests::ReadReferenceTrackCache( m_Path );
+  BOOST_TEST_REQUIRE( actual.has_value() );
+  BOOST_TEST_REQUIRE( actual->size() == expected.size() );
+
+  for( std::size_t idx = 0; idx < expected.size(); ++idx )
+  {
+    const auto& rActual = ( *actual )[ idx ];
+    const auto& rExpected = expected[ idx ];
+
+    BOOST_TEST_CONTEXT( rExpected.m_Name )
+    {
+      BOOST_TEST( rActual.m_Name == rExpected.m_Name );
+      BOOST_TEST_REQUIRE( rActual.m_TrackPoints.size() == rExpected.m_TrackPoints.size() );
+      for( std::size_t pointIndex = 0; pointIndex < rExpected.m_TrackPoints.size(); ++pointIndex )
+      {
+        const auto& rActualPoint = rActual.m_TrackPoints[ pointIndex ];
+        const auto& rExpectedPoint = rExpected.m_TrackPoints[ pointIndex ];
+        BOOST_TEST( rActualPoint.m_Age.Value() == rExpectedPoint.m_Age.Value() );
+        BOOST_TEST( rActualPoint.m_Mass.Value() == rExpectedPoint.m_Mass.Value() );
+        BOOST_TEST( rActualPoint.m_Radius.Value() == rExpectedPoint.m_Radius.Value() );
+        BOOST_TEST( rActualPoint.m_Luminosity.Value() == rExpectedPoint.m_Luminosity.Value() );
+        BOOST_TEST( rActualPoint.m_InitialMetallicity.Value() == rExpectedPoint.m_InitialMetallicity.Value() );
+        BOOST_TEST( ( rActualPoint.m_Stage == rExpectedPoint.m_Stage ) );
+      }
+    }
+  }
+
+  // Truncated caches are rejected
+  std::filesystem::resize_file( m_Path, std::filesystem::file_size( m_Path ) - 1 );
+  BOOST_TEST( !Herd::SSE::UnitTests::ReadReferenceTrackCache( m_Path ) );
+
+  // As are files that are not caches
+  {
+    std::ofstream file( m_Path, std::ios::binary | std::ios::trunc );
+    file << std::string( 100, 'x' );
+  }
+  BOOST_TEST( !Herd::SSE::UnitTests::ReadReferenceTrackCache( m_Path ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
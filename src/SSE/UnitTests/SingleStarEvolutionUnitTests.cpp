@@ -14,67 +14,64 @@
 
 #include <boost/test/unit_test.hpp>
 
-#include "SSETestDataManager.h"
+#include "ReferenceTrackCache.h"
 
-#include <UnitTestUtils/DataLoaderFixture.h>
 #include <UnitTestUtils/RandomTestFixture.h>
 #include <UnitTestUtils/UnitTestUtilityFunctions.h>
 
+#include <SSE/Checkpoint.h>
+#include <SSE/ColumnarTrajectory.h>
+#include <SSE/DenseTrajectory.h>
 #include <SSE/EvolutionStage.h>
+#include <SSE/IStepController.h>
+#include <SSE/OutputFilter.h>
 #include <SSE/SingleStarEvolution.h>
+#include <SSE/TimestepStatistics.h>
 #include <SSE/TrackPoint.h>
 #include <SSE/Landmarks/Constants.h>
+#include <SSE/Landmarks/MetallicityCache.h>
 
 #include <Exceptions/PreconditionError.h>
 #include <Physics/Constants.h>
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
+#include <sstream>
 #include <tuple>
 
 #include <boost/container/flat_set.hpp>
 
+#include <range/v3/algorithm.hpp>
+
 namespace
 {
 
 /**
  * @brief Unit test fixture for SingleStarEvolution
  */
-class SSETestFixture : public Herd::UnitTestUtils::RandomTestFixture, public Herd::UnitTestUtils::DataLoaderFixture, public Herd::SSE::SingleStarEvolutuionSpecs
+class SSETestFixture : public Herd::UnitTestUtils::RandomTestFixture, public Herd::SSE::UnitTests::ReferenceTrackFixture, public Herd::SSE::SingleStarEvolutuionSpecs
 {
 public:
 
-  std::vector< Herd::SSE::TrackPoint > MakeTestCase( std::size_t i_FileIndex ); ///< Makes a test case from a file
+  const std::vector< Herd::SSE::TrackPoint >& MakeTestCase( std::size_t i_TrackIndex ); ///< Makes a test case from a reference track
 
   void TestFidelity( const std::vector< Herd::SSE::TrackPoint >& i_rTrack ); ///< Compares the computed and the actual evolution tracks
 
-  inline static std::string s_TrackRegex = "track\\.xml"; ///< Regex for track files
-
 private:
 
   static void TestTrackPoint( const Herd::SSE::TrackPoint& i_rActual, const Herd::SSE::TrackPoint& i_rExpected ); ///< Tests whether the difference is within permissible bounds
-
-  inline static std::string s_ParentTag = "Track"; ///< Parent tag for the track points
 };
 
 /**
- * @brief Makes a test case from a file
- * @param i_FileIndex Index of the file in the directory
+ * @brief Makes a test case from a reference track
+ * @param i_TrackIndex Index of the reference track
  * @return An evolution track
  */
-std::vector< Herd::SSE::TrackPoint > SSETestFixture::MakeTestCase( std::size_t i_FileIndex )
+const std::vector< Herd::SSE::TrackPoint >& SSETestFixture::MakeTestCase( std::size_t i_TrackIndex )
 {
-
-  // Load the file at the indicated index
-  boost::property_tree::ptree data = ReadAsXML( s_TrackRegex, i_FileIndex );
-
-  // Initialise the data manager
-  Herd::SSE::UnitTests::SSETestDataManager dataManager;
-  dataManager.SetData( data.get_child( s_ParentTag ) );
-  dataManager.CheckVersionInfo();
-
-  dataManager.PopulateTrackPoints();
-  return dataManager.TrackPoints();
+  BOOST_TEST_REQUIRE( i_TrackIndex < ReferenceTracks().size() );
+  return ReferenceTracks()[ i_TrackIndex ].m_TrackPoints;
 }
 
 /**
@@ -212,28 +209,277 @@ BOOST_AUTO_TEST_CASE( InvalidParameters, *Herd::UnitTestUtils::Labels::s_Compile
     invalid.m_MinRemnantTimestep = GenerateNumber( -1.0, 0.0 ); // @suppress("Invalid arguments")
     BOOST_CHECK_THROW( simulator.Evolve( initialMass, initialMetallicity, evolveUntil, invalid ), Herd::Exceptions::PreconditionError );
   }
+
+  {
+    Herd::SSE::SingleStarEvolutuion::Parameters invalid = defaultParameters;
+    invalid.m_OutputAges = { Herd::Generic::Time( 2. ), Herd::Generic::Time( 1. ) };
+    BOOST_CHECK_THROW( simulator.Evolve( initialMass, initialMetallicity, evolveUntil, invalid ), Herd::Exceptions::PreconditionError );
+  }
+
+  {
+    Herd::SSE::SingleStarEvolutuion::Parameters invalid = defaultParameters;
+    invalid.m_OutputRelativeChange = GenerateNumber( -1.0, 0.0 ); // @suppress("Invalid arguments")
+    BOOST_CHECK_THROW( simulator.Evolve( initialMass, initialMetallicity, evolveUntil, invalid ), Herd::Exceptions::PreconditionError );
+  }
+
+  {
+    Herd::SSE::SingleStarEvolutuion::Parameters invalid = defaultParameters;
+    invalid.m_StepTolerance = GenerateNumber( -1.0, 0.0 ); // @suppress("Invalid arguments")
+    BOOST_CHECK_THROW( simulator.Evolve( initialMass, initialMetallicity, evolveUntil, invalid ), Herd::Exceptions::PreconditionError );
+  }
+
+  {
+    Herd::SSE::SingleStarEvolutuion::Parameters invalid = defaultParameters;
+    invalid.m_MetallicityGridStep = GenerateNumber( -1.0, -0.1 ); // @suppress("Invalid arguments")
+    BOOST_CHECK_THROW( simulator.Evolve( initialMass, initialMetallicity, evolveUntil, invalid ), Herd::Exceptions::PreconditionError );
+  }
+}
+
+/// The PI controller integrates the mass loss as accurately as the fixed fractions
+BOOST_AUTO_TEST_CASE( PIStepControl, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Mass initialMass( GenerateNumber( 0.5, 50. ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity initialMetallicity( GenerateMetallicity() ); // @suppress("Invalid arguments")
+  Herd::Generic::Time evolveUntil( 13800. );
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+  Herd::SSE::SingleStarEvolutuion simulator;
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  Herd::SSE::ColumnarTrajectory fixedFraction = simulator.Trajectory();
+
+  parameters.m_StepControl = Herd::SSE::StepControl::e_PI;
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  const Herd::SSE::ColumnarTrajectory& pi = simulator.Trajectory();
+  BOOST_TEST_REQUIRE( pi.size() > 1 ); // @suppress("Invalid arguments")
+
+  // Mass at the end of the shorter trajectory
+  auto ComputeMassAt = []( const Herd::SSE::ColumnarTrajectory& i_rTrajectory, Herd::Generic::Time i_Age )
+  {
+    std::size_t index = 1;
+    while( i_rTrajectory[ index ].m_Age < i_Age )
+    {
+      ++index;
+    }
+
+    return Herd::SSE::InterpolateTrackPoints( i_rTrajectory[ index - 1 ], i_rTrajectory[ index ], i_Age ).m_Mass.Value();
+  };
+
+  Herd::Generic::Time age = std::min( fixedFraction.back().m_Age, pi.back().m_Age );
+  BOOST_TEST( ComputeMassAt( pi, age ) == ComputeMassAt( fixedFraction, age ), boost::test_tools::tolerance( 1e-3 ) ); // @suppress("Invalid arguments")
+
+  for( auto stage : pi.Stages() )
+  {
+    BOOST_TEST( Herd::SSE::IsMS( stage ) ); // @suppress("Invalid arguments")
+  }
+}
+
+/// The output policy does not affect the integration
+BOOST_AUTO_TEST_CASE( OutputPolicies, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Mass initialMass( GenerateNumber( 0.5, 50. ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity initialMetallicity( GenerateMetallicity() ); // @suppress("Invalid arguments")
+  Herd::Generic::Time evolveUntil( 13800. );
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+  Herd::SSE::SingleStarEvolutuion simulator;
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  Herd::SSE::ColumnarTrajectory everyStep = simulator.Trajectory();
+  BOOST_TEST_REQUIRE( everyStep.size() > 2 ); // @suppress("Invalid arguments")
+
+  // First and last track points are common to all policies
+  auto IsSpanSame = [ & ]( const Herd::SSE::ColumnarTrajectory& i_rTrajectory )
+  {
+    return i_rTrajectory[ 0 ].m_Age == everyStep[ 0 ].m_Age && i_rTrajectory.back().m_Age == everyStep.back().m_Age
+        && i_rTrajectory.back().m_Mass == everyStep.back().m_Mass && i_rTrajectory.back().m_Luminosity == everyStep.back().m_Luminosity;
+  };
+
+  parameters.m_OutputPolicy = Herd::SSE::OutputPolicy::e_StageBoundaries;
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  BOOST_TEST( IsSpanSame( simulator.Trajectory() ) ); // @suppress("Invalid arguments")
+  BOOST_TEST( simulator.Trajectory().size() < everyStep.size() ); // @suppress("Invalid arguments")
+
+  parameters.m_OutputPolicy = Herd::SSE::OutputPolicy::e_OutputAges;
+  parameters.m_OutputAges = { Herd::Generic::Time( 0.25 * everyStep.back().m_Age ), Herd::Generic::Time( 0.5 * everyStep.back().m_Age ) };
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  BOOST_TEST( IsSpanSame( simulator.Trajectory() ) ); // @suppress("Invalid arguments")
+  BOOST_TEST_REQUIRE( simulator.Trajectory().size() == 4 ); // @suppress("Invalid arguments")
+  BOOST_TEST( simulator.Trajectory()[ 1 ].m_Age == parameters.m_OutputAges[ 0 ] ); // @suppress("Invalid arguments")
+  BOOST_TEST( simulator.Trajectory()[ 2 ].m_Age == parameters.m_OutputAges[ 1 ] ); // @suppress("Invalid arguments")
+
+  parameters.m_OutputPolicy = Herd::SSE::OutputPolicy::e_RelativeChange;
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  BOOST_TEST( IsSpanSame( simulator.Trajectory() ) ); // @suppress("Invalid arguments")
+  BOOST_TEST( simulator.Trajectory().size() <= everyStep.size() ); // @suppress("Invalid arguments")
+}
+
+/// Timestep counts are consistent with the trajectory
+BOOST_AUTO_TEST_CASE( TimestepTelemetry, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Mass initialMass( GenerateNumber( 0.5, 50. ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity initialMetallicity( GenerateMetallicity() ); // @suppress("Invalid arguments")
+  Herd::Generic::Time evolveUntil( 13800. );
+
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+  Herd::SSE::SingleStarEvolutuion simulator;
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  BOOST_TEST_REQUIRE( simulator.Trajectory().size() > 2 ); // @suppress("Invalid arguments")
+
+  auto TestConsistency = [ & ]()
+  {
+    Herd::SSE::StageTimestepStatistics total = simulator.TimestepStatistics().Total();
+    BOOST_TEST( total.m_AcceptedSteps == simulator.Trajectory().size() - 1 ); // @suppress("Invalid arguments")
+    BOOST_TEST( total.m_PhaseEvaluations >= total.m_AcceptedSteps + total.m_RejectedTrials ); // @suppress("Invalid arguments")
+
+    uint64_t limitedSteps = 0;
+    for( uint64_t count : total.m_LimitedBy )
+    {
+      limitedSteps += count;
+    }
+    BOOST_TEST( limitedSteps == total.m_AcceptedSteps ); // @suppress("Invalid arguments")
+
+    // Only the MS stages are implemented
+    const Herd::SSE::TimestepStatistics& rStatistics = simulator.TimestepStatistics();
+    BOOST_TEST( rStatistics[ Herd::SSE::EvolutionStage::e_MSLM ].m_AcceptedSteps + rStatistics[ Herd::SSE::EvolutionStage::e_MS ].m_AcceptedSteps == total.m_AcceptedSteps ); // @suppress("Invalid arguments")
+
+    return total;
+  };
+
+  TestConsistency();
+
+  // The last step of an interrupted evolution is limited by the end of the evolution
+  Herd::Generic::Time halfway( 0.5 * simulator.Trajectory().back().m_Age );
+  simulator.Evolve( initialMass, initialMetallicity, halfway, parameters );
+  BOOST_TEST_REQUIRE( simulator.Trajectory().size() > 1 ); // @suppress("Invalid arguments")
+  BOOST_TEST( simulator.Trajectory().back().m_Age == halfway ); // @suppress("Invalid arguments")
+  BOOST_TEST( TestConsistency().LimitedBy( Herd::SSE::StepLimit::e_EndOfEvolution ) == 1 ); // @suppress("Invalid arguments")
+
+  // The counts are reset for each star
+  simulator.Evolve( initialMass, initialMetallicity, Herd::Generic::Time( 0 ), parameters );
+  BOOST_TEST( simulator.TimestepStatistics().Total().m_PhaseEvaluations == 0 ); // @suppress("Invalid arguments")
+}
+
+/// Resuming from a checkpoint, in memory and through a stream
+BOOST_AUTO_TEST_CASE( CheckpointResume, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::Generic::Mass initialMass( GenerateNumber( 0.5, 50. ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity initialMetallicity( GenerateMetallicity() ); // @suppress("Invalid arguments")
+  Herd::Generic::Time evolveUntil( 13800. );
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+
+  Herd::SSE::SingleStarEvolutuion simulator;
+  BOOST_CHECK_THROW( simulator.MakeCheckpoint(), Herd::Exceptions::PreconditionError );
+
+  simulator.Evolve( initialMass, initialMetallicity, evolveUntil, parameters );
+  Herd::SSE::ColumnarTrajectory uninterrupted = simulator.Trajectory();
+  BOOST_TEST_REQUIRE( uninterrupted.size() > 2 ); // @suppress("Invalid arguments")
+
+  // Pause
+  Herd::Generic::Time pauseAt( GenerateNumber( 0.2, 0.8 ) * uninterrupted.back().m_Age ); // @suppress("Invalid arguments")
+  simulator.Evolve( initialMass, initialMetallicity, pauseAt, parameters );
+  Herd::SSE::Checkpoint checkpoint = simulator.MakeCheckpoint();
+  BOOST_TEST( checkpoint.m_State.m_TrackPoint.m_Age == pauseAt ); // @suppress("Invalid arguments")
+  BOOST_TEST( checkpoint.m_InitialMass == initialMass ); // @suppress("Invalid arguments")
+
+  std::stringstream stream( std::ios::in | std::ios::out | std::ios::binary );
+  Herd::SSE::WriteCheckpoint( checkpoint, stream );
+
+  // Resume in place, and in a new simulator with a different metallicity history
+  simulator.Resume( checkpoint, evolveUntil, parameters );
+  const Herd::SSE::ColumnarTrajectory& resumed = simulator.Trajectory();
+
+  Herd::SSE::SingleStarEvolutuion other;
+  other.Evolve( initialMass, Herd::Generic::Metallicity( GenerateMetallicity() ), evolveUntil, parameters ); // @suppress("Invalid arguments")
+  other.Resume( Herd::SSE::ReadCheckpoint( stream ), evolveUntil, parameters );
+
+  BOOST_TEST_REQUIRE( resumed.size() == other.Trajectory().size() ); // @suppress("Invalid arguments")
+  for( std::size_t field = 0; field < static_cast< std::size_t >( Herd::SSE::TrackPointField::e_Count ); ++field )
+  {
+    auto column = resumed.Column( static_cast< Herd::SSE::TrackPointField >( field ) );
+    auto otherColumn = other.Trajectory().Column( static_cast< Herd::SSE::TrackPointField >( field ) );
+    BOOST_TEST( ranges::cpp20::equal( column, otherColumn ) ); // @suppress("Invalid arguments")
+  }
+
+  // The continuation starts at the checkpoint, and follows the uninterrupted evolution
+  BOOST_TEST( resumed[ 0 ].m_Age == pauseAt ); // @suppress("Invalid arguments")
+  BOOST_TEST( resumed[ 0 ].m_Mass == checkpoint.m_State.m_TrackPoint.m_Mass ); // @suppress("Invalid arguments")
+
+  Herd::Generic::Time commonAge = std::min( resumed.back().m_Age, uninterrupted.back().m_Age );
+  Herd::Generic::Mass expected = Herd::SSE::DenseTrajectory( uninterrupted ).At( commonAge ).m_Mass;
+  Herd::Generic::Mass actual = Herd::SSE::DenseTrajectory( resumed ).At( commonAge ).m_Mass;
+  BOOST_TEST( actual.Value() == expected.Value(), boost::test_tools::tolerance( 1e-3 ) ); // @suppress("Invalid arguments")
+}
+
+// After precomputation, the evolution at a canonical metallicity should not add any coefficients to the cache
+BOOST_AUTO_TEST_CASE( CanonicalMetallicities, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::SingleStarEvolutuion::PrecomputeCanonicalMetallicities();
+  Herd::SSE::MetallicityCache::Prune();
+  std::size_t cacheSize = Herd::SSE::MetallicityCache::Size();
+
+  Herd::Generic::Metallicity z( Herd::SSE::Constants::s_CanonicalMetallicities[ GenerateNumber( 0u, 4u ) ] ); // @suppress("Invalid arguments")
+  Herd::SSE::SingleStarEvolutuion sse;
+  sse.Evolve( Herd::Generic::Mass( GenerateNumber( s_EvolvableMassRange.Lower(), s_EvolvableMassRange.Upper() ) ), z, Herd::Generic::Time( 13800. ), // @suppress("Invalid arguments")
+      Herd::SSE::SingleStarEvolutuion::Parameters() );
+
+  BOOST_TEST( Herd::SSE::MetallicityCache::Size() == cacheSize ); // @suppress("Invalid arguments")
+}
+
+// On a metallicity grid, the star should be evolved exactly as at the grid metallicity, and the coefficients should come from the cache
+BOOST_AUTO_TEST_CASE( MetallicityGrid, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::SingleStarEvolutuion::Parameters parameters;
+  parameters.m_MetallicityGridStep = GenerateNumber( 0.01, 0.1 ); // @suppress("Invalid arguments")
+  Herd::SSE::MetallicityCache::Handles handles = Herd::SSE::SingleStarEvolutuion::PrecomputeMetallicityGrid( parameters.m_MetallicityGridStep );
+  std::size_t cacheSize = Herd::SSE::MetallicityCache::Size();
+
+  Herd::Generic::Mass mass( GenerateNumber( s_EvolvableMassRange.Lower(), s_EvolvableMassRange.Upper() ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity z( GenerateNumber( s_MetallicityRange.Lower(), s_MetallicityRange.Upper() ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Time until( 13800. );
+
+  Herd::SSE::SingleStarEvolutuion simulator;
+  simulator.Evolve( mass, z, until, parameters );
+  BOOST_TEST( Herd::SSE::MetallicityCache::Size() == cacheSize ); // @suppress("Invalid arguments")
+
+  const auto& rTrajectory = simulator.Trajectory();
+  BOOST_TEST_REQUIRE( !rTrajectory.empty() ); // @suppress("Invalid arguments")
+  Herd::Generic::Metallicity snapped = rTrajectory[ 0 ].m_InitialMetallicity;
+  BOOST_TEST( std::abs( std::log10( snapped / z ) ) <= parameters.m_MetallicityGridStep ); // @suppress("Invalid arguments")
+
+  Herd::SSE::SingleStarEvolutuion::Parameters reference = parameters;
+  reference.m_MetallicityGridStep = 0;
+  Herd::SSE::SingleStarEvolutuion referenceSimulator;
+  referenceSimulator.Evolve( mass, snapped, until, reference );
+
+  const auto& rExpected = referenceSimulator.Trajectory();
+  BOOST_TEST_REQUIRE( rTrajectory.size() == rExpected.size() ); // @suppress("Invalid arguments")
+  BOOST_TEST( ranges::cpp20::equal( rTrajectory.Column( Herd::SSE::TrackPointField::e_Luminosity ), rExpected.Column( Herd::SSE::TrackPointField::e_Luminosity ) ) ); // @suppress("Invalid arguments")
+  BOOST_TEST( ranges::cpp20::equal( rTrajectory.Column( Herd::SSE::TrackPointField::e_Radius ), rExpected.Column( Herd::SSE::TrackPointField::e_Radius ) ) ); // @suppress("Invalid arguments")
+
+  // Resumes at the same metallicity
+  Herd::SSE::Checkpoint checkpoint = simulator.MakeCheckpoint();
+  simulator.Resume( checkpoint, Herd::Generic::Time( until + 1000. ), parameters );
+  BOOST_TEST( simulator.Trajectory().back().m_InitialMetallicity == snapped ); // @suppress("Invalid arguments")
+
+  Herd::SSE::MetallicityCache::Prune();
 }
 
 /// Test single star evolution on a random track
 BOOST_AUTO_TEST_CASE( RandomReferenceTrack, *Herd::UnitTestUtils::Labels::s_Compile )
 {
-  std::size_t fileCount = GetFileCount( s_TrackRegex );
-  BOOST_TEST_REQUIRE( fileCount != 0 );
-  std::size_t fileIndex = GenerateNumber( static_cast< std::size_t >( 0 ), fileCount - 1 ); // @suppress("Invalid arguments")
-  TestFidelity( MakeTestCase( fileIndex ) );
+  std::size_t trackCount = ReferenceTracks().size();
+  std::size_t trackIndex = GenerateNumber( static_cast< std::size_t >( 0 ), trackCount - 1 ); // @suppress("Invalid arguments")
+  TestFidelity( MakeTestCase( trackIndex ) );
 }
 
 /// Test single star evolution over the entire reference set
 BOOST_AUTO_TEST_CASE( AllReferenceTracks, *Herd::UnitTestUtils::Labels::s_Continuous )
 {
-  // TODO Review the decision to load one file at a time
-  // Reading one file at a time. Alternative is loading all files, which is more amenable to parallel processing, but with a higher up-front cost. More suitable when we are not expecting any failures
+  // The tracks come from the shared cached fixture, ReferenceTrackFixture
 
-  std::size_t fileCount = GetFileCount( s_TrackRegex );
-  BOOST_TEST_REQUIRE( fileCount != 0 );
-  for( std::size_t idx = 0; idx < fileCount; ++idx )
+  std::size_t trackCount = ReferenceTracks().size();
+  for( std::size_t idx = 0; idx < trackCount; ++idx )
   {
-    BOOST_TEST_CONTEXT( "File index "<<idx )
+    BOOST_TEST_CONTEXT( ReferenceTracks()[ idx ].m_Name )
     {
       TestFidelity( MakeTestCase( idx ) );
     }
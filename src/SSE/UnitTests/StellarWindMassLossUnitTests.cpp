@@ -14,62 +14,32 @@
 
 #include <boost/test/unit_test.hpp>
 
-#include "SSETestDataManager.h"
+#include "ReferenceTrackCache.h"
 
 #include <Exceptions/PreconditionError.h>
+#include <Generic/ValidationPolicy.h>
 #include <SSE/EvolutionStage.h>
 #include <SSE/StellarWindMassLoss.h>
 #include <SSE/TrackPoint.h>
-#include <UnitTestUtils/DataLoaderFixture.h>
 #include <UnitTestUtils/RandomTestFixture.h>
 #include <UnitTestUtils/UnitTestUtilityFunctions.h>
 
-#include <string>
-#include <unordered_map>
 #include <vector>
 
-#include <boost/property_tree/ptree.hpp>
-
 namespace
 {
 /**
  * @brief Unit test fixture for StellarWindMassLoss
  */
-class StellarWindMassLossTestFixture : public Herd::UnitTestUtils::RandomTestFixture, public Herd::UnitTestUtils::DataLoaderFixture
+class StellarWindMassLossTestFixture : public Herd::UnitTestUtils::RandomTestFixture, public Herd::SSE::UnitTests::ReferenceTrackFixture
 {
 public:
 
-  static std::vector< Herd::SSE::TrackPoint > MakeTestCase( const boost::property_tree::ptree& i_rRoot ); ///< Makes a test case from a property tree
-  std::vector< Herd::SSE::TrackPoint > MakeTestCase(); ///< Makes a test case from a random file
+  const std::vector< Herd::SSE::TrackPoint >& MakeTestCase(); ///< Makes a test case from a random reference track
 
   static void TestFidelity( const std::vector< Herd::SSE::TrackPoint >& i_rTrack, std::size_t i_Start = 0, double i_SampleSize = 1. ); ///< Compares the computed and the actual mass loss
-
-  static const std::string& TrackRegex(); ///< Returns a constant reference to StellarWindMassLossTestFixture::s_TrackRegex
-
-private:
-
-  inline static std::string s_ParentTag = "Track"; ///< Parent tag for the track points
-  inline static std::string s_TrackRegex = "track\\.xml"; ///< Regex for track files
 };
 
-/**
- * @param i_rRoot Tree root
- * @return Test case
- */
-std::vector< Herd::SSE::TrackPoint > StellarWindMassLossTestFixture::MakeTestCase( const boost::property_tree::ptree& i_rRoot )
-{
-  // Initialise the data manager
-  Herd::SSE::UnitTests::SSETestDataManager dataManager;
-  dataManager.SetData( i_rRoot.get_child( s_ParentTag ) );
-  dataManager.CheckVersionInfo();
-
-  // Track points
-  Herd::SSE::TrackPoint zams = dataManager.MakeTrackPoint( 0 );
-  dataManager.PopulateTrackPoints( zams.m_InitialMetallicity );
-
-  return dataManager.TrackPoints();
-}
-
 /**
  * @param i_rTrack An evolutionary track
  * @param i_Start First track point to be tested
@@ -121,25 +91,16 @@ void StellarWindMassLossTestFixture::TestFidelity( const std::vector< Herd::SSE:
   }
 }
 
-std::vector< Herd::SSE::TrackPoint > StellarWindMassLossTestFixture::MakeTestCase()
-{
-  // Pick a random file
-  std::size_t fileCount = GetFileCount( s_TrackRegex );
-  BOOST_TEST_REQUIRE( fileCount != 0 );
-  boost::property_tree::ptree data = ReadAsXML( s_TrackRegex, GenerateNumber( static_cast< std::size_t >( 0 ), fileCount - 1 ) ); // @suppress("Invalid arguments")
-
-  std::vector< Herd::SSE::TrackPoint > track = MakeTestCase( data );
-  BOOST_TEST_REQUIRE( track.size() >= 2 );
-
-  return track;
-}
-
 /**
- * @return A constant reference to StellarWindMassLossTestFixture::s_TrackRegex
+ * @return A random reference track
  */
-const std::string& StellarWindMassLossTestFixture::TrackRegex()
+const std::vector< Herd::SSE::TrackPoint >& StellarWindMassLossTestFixture::MakeTestCase()
 {
-  return s_TrackRegex;
+  std::size_t trackCount = ReferenceTracks().size();
+  const std::vector< Herd::SSE::TrackPoint >& rTrack = ReferenceTracks()[ GenerateNumber( static_cast< std::size_t >( 0 ), trackCount - 1 ) ].m_TrackPoints; // @suppress("Invalid arguments")
+  BOOST_TEST_REQUIRE( rTrack.size() >= 2 );
+
+  return rTrack;
 }
 
 }
@@ -181,6 +142,7 @@ BOOST_AUTO_TEST_CASE( InvalidParameters, *Herd::UnitTestUtils::Labels::s_Compile
   }
 
   // Check invalid track points
+  if constexpr( Herd::Generic::InnerValidation::s_IsEnabled )
   {
     Herd::SSE::TrackPoint invalid;
     BOOST_CHECK_THROW( Herd::SSE::StellarWindMassLoss::Compute( invalid, eta, heWind, binaryWind, rocheLobe ), Herd::Exceptions::PreconditionError );
@@ -191,22 +153,18 @@ BOOST_AUTO_TEST_CASE( InvalidParameters, *Herd::UnitTestUtils::Labels::s_Compile
 /// Test on random points of a single track
 BOOST_AUTO_TEST_CASE( RandomReferenceTrackSampled, *Herd::UnitTestUtils::Labels::s_Compile )
 {
-  std::vector< Herd::SSE::TrackPoint > track = MakeTestCase();
+  const std::vector< Herd::SSE::TrackPoint >& track = MakeTestCase();
   TestFidelity( track, GenerateNumber( static_cast< std::size_t >( 0 ), track.size() - 2 ), 0.02 ); // @suppress("Invalid arguments")
 }
 
 /// Test over the entire dataset
 BOOST_AUTO_TEST_CASE( AllReferenceTracks, *Herd::UnitTestUtils::Labels::s_Continuous )
 {
-  // Read all files
-  std::unordered_map< std::string, boost::property_tree::ptree > data = ReadAsXML( TrackRegex() );
-  BOOST_TEST_REQUIRE( !data.empty() );
-
-  for( const auto& current : data )
+  for( const auto& rTrack : ReferenceTracks() )
   {
-    BOOST_TEST_CONTEXT( current.first )
+    BOOST_TEST_CONTEXT( rTrack.m_Name )
     {
-      TestFidelity( MakeTestCase( current.second ) );
+      TestFidelity( rTrack.m_TrackPoints );
     }
   }
 }
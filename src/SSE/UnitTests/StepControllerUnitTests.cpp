@@ -0,0 +1,107 @@
+/**
+ * @file StepControllerUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include "SSETestUtils.h"
+
+#include <SSE/EvolutionStage.h>
+#include <SSE/EvolutionState.h>
+#include <SSE/FixedFractionStepController.h>
+#include <SSE/PIStepController.h>
+#include <SSE/TrackPoint.h>
+
+#include <Exceptions/PreconditionError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+namespace
+{
+/**
+ * @brief Makes a track point after a step with a given relative change in luminosity
+ * @param i_rPrevious Track point before the step
+ * @param i_RelativeChange Relative change in luminosity
+ * @return Track point after the step
+ */
+Herd::SSE::TrackPoint MakeNext( const Herd::SSE::TrackPoint& i_rPrevious, double i_RelativeChange )
+{
+  Herd::SSE::TrackPoint next = i_rPrevious;
+  next.m_Luminosity.Set( i_rPrevious.m_Luminosity * ( 1. + i_RelativeChange ) );
+  return next;
+}
+}
+
+BOOST_FIXTURE_TEST_SUITE( StepControllerUnitTests, Herd::UnitTestUtils::RandomTestFixture )
+
+BOOST_AUTO_TEST_CASE( FixedFractionTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::EvolutionState state = Herd::SSE::UnitTests::GenerateRandomEvolutionState( Rng() );
+  Herd::Generic::Time base( GenerateNumber( 0.1, 100. ) ); // @suppress("Invalid arguments")
+
+  Herd::SSE::FixedFractionStepController controller;
+  BOOST_TEST( controller.Propose( state, base ) == base ); // @suppress("Invalid arguments")
+
+  controller.Accept( state.m_TrackPoint, MakeNext( state.m_TrackPoint, 0.5 ), base );
+  BOOST_TEST( controller.Propose( state, base ) == base ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( PIValidationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  BOOST_CHECK_THROW( Herd::SSE::PIStepController( 0. ), Herd::Exceptions::PreconditionError );
+  BOOST_CHECK_THROW( Herd::SSE::PIStepController( GenerateNumber( -1., -0.1 ) ), Herd::Exceptions::PreconditionError ); // @suppress("Invalid arguments")
+
+  double tolerance = GenerateNumber( 0.01, 0.2 ); // @suppress("Invalid arguments")
+  BOOST_TEST( Herd::SSE::PIStepController( tolerance ).Tolerance() == tolerance ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( PIOperationTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  using Controller = Herd::SSE::PIStepController;
+
+  double tolerance = GenerateNumber( 0.01, 0.2 ); // @suppress("Invalid arguments")
+  Herd::SSE::EvolutionState state = Herd::SSE::UnitTests::GenerateRandomEvolutionState( Rng() );
+  Herd::Generic::Time base( GenerateNumber( 0.1, 100. ) ); // @suppress("Invalid arguments")
+  Herd::Generic::Time deltaT( GenerateNumber( 0.1, 100. ) ); // @suppress("Invalid arguments")
+
+  Controller controller( tolerance );
+
+  // No history
+  BOOST_TEST( controller.Propose( state, base ) == base ); // @suppress("Invalid arguments")
+
+  // Small change: the step grows
+  controller.Accept( state.m_TrackPoint, MakeNext( state.m_TrackPoint, 0.1 * tolerance ), deltaT );
+  BOOST_TEST( controller.Propose( state, base ) > deltaT ); // @suppress("Invalid arguments")
+
+  // Large change: the step shrinks
+  controller.Reset();
+  controller.Accept( state.m_TrackPoint, MakeNext( state.m_TrackPoint, 3. * tolerance ), deltaT );
+  BOOST_TEST( controller.Propose( state, base ) < deltaT ); // @suppress("Invalid arguments")
+
+  // No change: the growth is bounded
+  controller.Reset();
+  controller.Accept( state.m_TrackPoint, state.m_TrackPoint, deltaT );
+  BOOST_TEST( controller.Propose( state, base ).Value() == Controller::s_MaxFactor * deltaT.Value(), boost::test_tools::tolerance( 1e-12 ) ); // @suppress("Invalid arguments")
+
+  // Stage change: the history does not apply
+  Herd::SSE::EvolutionState nextStage = state;
+  nextStage.m_TrackPoint.m_Stage = state.m_TrackPoint.m_Stage == Herd::SSE::EvolutionStage::e_MS ? Herd::SSE::EvolutionStage::e_HG : Herd::SSE::EvolutionStage::e_MS;
+  BOOST_TEST( controller.Propose( nextStage, base ) == base ); // @suppress("Invalid arguments")
+
+  // Reset discards the history
+  controller.Reset();
+  BOOST_TEST( controller.Propose( state, base ) == base ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_SUITE_END()
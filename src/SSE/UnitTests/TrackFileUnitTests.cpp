@@ -0,0 +1,136 @@
+/**
+ * @file TrackFileUnitTests.cpp
+ * @author Evren Imre
+ * @date 18 Oct 2026
+ */
+/* This file is a part of HeRD, a stellar evolution library
+ * Copyright © 2026 Evren Imre
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at https://mozilla.org/MPL/2.0/. */
+
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <SSE/ColumnarTrajectory.h>
+#include <SSE/SingleStarEvolution.h>
+#include <SSE/TrackFile.h>
+
+#include <Exceptions/RuntimeError.h>
+#include <Generic/Quantity.h>
+#include <UnitTestUtils/RandomTestFixture.h>
+#include <UnitTestUtils/UnitTestUtilityFunctions.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include <range/v3/algorithm.hpp>
+
+namespace
+{
+/**
+ * @brief Fixture with an evolved star and a temporary file
+ */
+class TrackFileTestFixture : public Herd::UnitTestUtils::RandomTestFixture
+{
+public:
+
+  TrackFileTestFixture()
+  {
+    m_Path = std::filesystem::temp_directory_path() / ( "HerdTrackFile" + std::to_string( Seed() ) + "_" + std::to_string( Rng()() ) + ".trk" );
+
+    m_Simulator.Evolve( Herd::Generic::Mass( GenerateNumber( 0.5, 50. ) ), Herd::Generic::Metallicity( GenerateMetallicity() ), Herd::Generic::Time( 13800. ), // @suppress("Invalid arguments")
+        m_Parameters );
+  }
+
+  ~TrackFileTestFixture()
+  {
+    std::error_code error;
+    std::filesystem::remove( m_Path, error );
+  }
+
+  /**
+   * @brief Checks whether a file holds the trajectory of the simulator exactly
+   * @param i_rReader Reader
+   */
+  void TestContents( const Herd::SSE::TrackFileReader& i_rReader ) const
+  {
+    const Herd::SSE::ColumnarTrajectory& rTrajectory = m_Simulator.Trajectory();
+    BOOST_TEST_REQUIRE( i_rReader.size() == rTrajectory.size() ); // @suppress("Invalid arguments")
+    for( std::size_t field = 0; field < static_cast< std::size_t >( Herd::SSE::TrackPointField::e_Count ); ++field )
+    {
+      auto expected = rTrajectory.Column( static_cast< Herd::SSE::TrackPointField >( field ) );
+      auto actual = i_rReader.Column( static_cast< Herd::SSE::TrackPointField >( field ) );
+      BOOST_TEST( ranges::cpp20::equal( actual, expected ) ); // @suppress("Invalid arguments")
+    }
+
+    BOOST_TEST( ranges::cpp20::equal( i_rReader.Stages(), rTrajectory.Stages() ) ); // @suppress("Invalid arguments")
+  }
+
+  std::filesystem::path m_Path; ///< Temporary file
+  Herd::SSE::SingleStarEvolutuion::Parameters m_Parameters; ///< Evolution parameters
+  Herd::SSE::SingleStarEvolutuion m_Simulator; ///< Simulator with an evolved star
+};
+}
+
+BOOST_FIXTURE_TEST_SUITE( TrackFileUnitTests, TrackFileTestFixture )
+
+BOOST_AUTO_TEST_CASE( RoundTripTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  for( auto compression : { Herd::SSE::TrackCompression::e_None, Herd::SSE::TrackCompression::e_XORDelta } )
+  {
+    Herd::SSE::WriteTrackFile( m_Path, m_Simulator, m_Parameters, compression );
+    Herd::SSE::TrackFileReader reader( m_Path );
+
+    const Herd::SSE::TrackFileHeader& rHeader = reader.Header();
+    BOOST_TEST( rHeader.m_InitialMass == m_Simulator.Trajectory()[ 0 ].m_Mass ); // @suppress("Invalid arguments")
+    BOOST_TEST( rHeader.m_Metallicity == m_Simulator.Trajectory()[ 0 ].m_InitialMetallicity ); // @suppress("Invalid arguments")
+    BOOST_TEST( rHeader.m_ParametersHash == m_Parameters.Hash() ); // @suppress("Invalid arguments")
+    BOOST_TEST( ( rHeader.m_Compression == compression ) );
+
+    TestContents( reader );
+  }
+}
+
+BOOST_AUTO_TEST_CASE( CompressionTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::WriteTrackFile( m_Path, m_Simulator, m_Parameters, Herd::SSE::TrackCompression::e_None );
+  std::uintmax_t uncompressed = std::filesystem::file_size( m_Path );
+
+  Herd::SSE::WriteTrackFile( m_Path, m_Simulator, m_Parameters, Herd::SSE::TrackCompression::e_XORDelta );
+  BOOST_TEST( std::filesystem::file_size( m_Path ) < uncompressed ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( ParametersHashTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  Herd::SSE::SingleStarEvolutuion::Parameters other = m_Parameters;
+  BOOST_TEST( other.Hash() == m_Parameters.Hash() ); // @suppress("Invalid arguments")
+
+  other.m_RelativeTimeStepSizes[ Herd::SSE::EvolutionStage::e_MS ] *= 0.5;
+  BOOST_TEST( other.Hash() != m_Parameters.Hash() ); // @suppress("Invalid arguments")
+}
+
+BOOST_AUTO_TEST_CASE( InvalidFileTest, *Herd::UnitTestUtils::Labels::s_Compile )
+{
+  BOOST_CHECK_THROW( Herd::SSE::TrackFileReader { m_Path }, Herd::Exceptions::RuntimeError );
+
+  {
+    std::ofstream file( m_Path, std::ios::binary );
+    file << std::string( 100, 'x' );
+  }
+  BOOST_CHECK_THROW( Herd::SSE::TrackFileReader { m_Path }, Herd::Exceptions::RuntimeError );
+
+  // Truncated
+  for( auto compression : { Herd::SSE::TrackCompression::e_None, Herd::SSE::TrackCompression::e_XORDelta } )
+  {
+    Herd::SSE::WriteTrackFile( m_Path, m_Simulator, m_Parameters, compression );
+    std::filesystem::resize_file( m_Path, std::filesystem::file_size( m_Path ) - 1 );
+    BOOST_CHECK_THROW( Herd::SSE::TrackFileReader { m_Path }, Herd::Exceptions::RuntimeError );
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -40,6 +40,15 @@ DataLoaderFixture::DataLoaderFixture()
     BOOST_TEST_REQUIRE( std::filesystem::exists( m_DataDir ), "Does not exist: " + *dataDir );
     BOOST_TEST_REQUIRE( std::filesystem::is_directory( m_DataDir ), "Not a directory: " + *dataDir );
   }
+
+  std::optional< std::string > cacheDir = Herd::UnitTestUtils::GetCommandLineArgument( s_CacheDirArgumentName );
+  if( cacheDir )
+  {
+    m_CacheDir = *cacheDir;
+    std::error_code error;
+    std::filesystem::create_directories( *m_CacheDir, error );
+    BOOST_TEST_REQUIRE( std::filesystem::is_directory( *m_CacheDir ), "Not a directory: " + *cacheDir );
+  }
 }
 
 /**
@@ -116,6 +125,15 @@ unsigned int DataLoaderFixture::GetFileCount( const std::string& i_rRegex ) cons
   { return IsMatchingFile(i_rEntry, filename_regex);} );
 }
 
+/**
+ * @return A constant reference to DataLoaderFixture::m_CacheDir
+ * @remarks If set, the directory exists. The constructor creates it if necessary
+ */
+const std::optional< std::filesystem::path >& DataLoaderFixture::CacheDir() const
+{
+  return m_CacheDir;
+}
+
 /**
  * @param i_Path Path to the xml file
  * @return Property tree
@@ -14,6 +14,7 @@
 #define HCCFFE697_C182_4118_946F_17FE9544A7BF
 
 #include <filesystem>
+#include <optional>
 #include <regex>
 #include <string>
 #include <unordered_map>
@@ -38,14 +39,18 @@ public:
   std::unordered_map< std::string, boost::property_tree::ptree > ReadAsXML( const std::string& i_rRegex ) const; ///< Reads each file in DataLoaderFixture::m_DataDir matching the regex into a property tree
   unsigned int GetFileCount( const std::string& i_rRegex ) const; ///< Number of files in DataLoaderFixture::m_DataDir matching the regex
 
+  const std::optional< std::filesystem::path >& CacheDir() const; ///< Accessor for DataLoaderFixture::m_CacheDir
+
 private:
 
   static boost::property_tree::ptree ReadAsXML( const std::filesystem::path& i_Path );  ///< Reads an XML file to a property tree
   static bool IsMatchingFile( const std::filesystem::directory_entry& i_rEntry, const std::regex& i_rRegex ); ///< Checks whether a path is a regular file with a name having a substring that matches the regex
 
   std::filesystem::path m_DataDir; ///< Value of the command line argument DataLoaderFixture::s_DataDirArgumentName
+  std::optional< std::filesystem::path > m_CacheDir; ///< Value of the command line argument DataLoaderFixture::s_CacheDirArgumentName. Unset if not provided
 
   inline static const std::string s_DataDirArgumentName = "--data-dir";  ///< Command line argument for the test data dir
+  inline static const std::string s_CacheDirArgumentName = "--cache-dir";  ///< Command line argument for the directory of the preprocessed test data
 };
 }
 
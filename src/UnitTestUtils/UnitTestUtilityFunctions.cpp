@@ -22,7 +22,7 @@
 
 namespace
 {
-const std::unordered_set< std::string > s_RegisteredArguments { "--seed", "--data-dir" };
+const std::unordered_set< std::string > s_RegisteredArguments { "--seed", "--data-dir", "--cache-dir" };
 }
 
 namespace Herd::UnitTestUtils